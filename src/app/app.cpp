@@ -1,6 +1,7 @@
 #include "app/app.h"
 
 #include <string.h>
+#include <wchar.h>
 #include <windows.h>
 
 #include "config.h"
@@ -13,6 +14,8 @@ static RawBitAppConfig build_default_config(const RawBitAppConfig* config)
     RawBitAppConfig result;
     result.http_port = 32145;
     result.engine_tick_ms = 500;
+    result.http_loops = 1;
+    result.http_local_socket[0] = L'\0';
 
     if(config)
     {
@@ -24,6 +27,11 @@ static RawBitAppConfig build_default_config(const RawBitAppConfig* config)
         {
             result.engine_tick_ms = config->engine_tick_ms;
         }
+        if(config->http_loops != 0)
+        {
+            result.http_loops = config->http_loops;
+        }
+        wcsncpy_s(result.http_local_socket, MAX_PATH, config->http_local_socket, _TRUNCATE);
     }
     if(result.engine_tick_ms < 250)
     {
@@ -58,6 +66,8 @@ int rawbit_app_init(RawBitApp* app, const RawBitAppConfig* config, HINSTANCE ins
     http_server_config_default(&http_cfg);
     http_cfg.port = app->config.http_port;
     http_cfg.broadcast_interval_ms = app->config.engine_tick_ms;
+    http_cfg.loop_count = app->config.http_loops;
+    wcscpy_s(http_cfg.local_socket_path, MAX_PATH, app->config.http_local_socket);
     http_cfg.engine = &app->engine;
     if(http_server_init(&app->http, &http_cfg) != 0)
     {
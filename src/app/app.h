@@ -11,6 +11,10 @@ struct RawBitAppConfig
 {
     unsigned short http_port;
     unsigned int engine_tick_ms;
+    // HTTP event loops; see HttpServerConfig::loop_count.
+    unsigned int http_loops;
+    // Optional local socket; see HttpServerConfig::local_socket_path.
+    wchar_t http_local_socket[MAX_PATH];
 };
 
 struct RawBitApp
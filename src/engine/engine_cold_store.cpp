@@ -0,0 +1,151 @@
+#include "engine/engine_cold_store.h"
+
+#include <algorithm>
+
+#include <string.h>
+
+namespace
+{
+    static bool record_id_less(const EngineColdRecord& a, const EngineColdRecord& b)
+    {
+        return a.id < b.id;
+    }
+
+    static bool record_less_than_id(const EngineColdRecord& record, unsigned int id)
+    {
+        return record.id < id;
+    }
+
+    static unsigned int push_string(std::vector<char>& arena, const char* text)
+    {
+        const unsigned int offset = static_cast<unsigned int>(arena.size());
+        const size_t len = text ? strlen(text) : 0;
+        if(len != 0)
+        {
+            arena.insert(arena.end(), text, text + len);
+        }
+        arena.push_back('\0');
+        return offset;
+    }
+
+    static size_t string_bytes(const EngineColdStore* store, unsigned int offset)
+    {
+        return strlen(&store->strings[offset]) + 1;
+    }
+
+    static void compact(EngineColdStore* store)
+    {
+        std::vector<EngineColdRecord> records;
+        std::vector<char> strings;
+        records.reserve(store->records.size() - store->dead_records);
+        strings.reserve(store->strings.size() - store->dead_string_bytes);
+
+        for(size_t i = 0; i < store->records.size(); ++i)
+        {
+            EngineColdRecord record = store->records[i];
+            if(record.flags & EngineColdFlag_Removed)
+            {
+                continue;
+            }
+            record.name_offset = push_string(strings, &store->strings[store->records[i].name_offset]);
+            record.magnet_offset = push_string(strings, &store->strings[store->records[i].magnet_offset]);
+            records.push_back(record);
+        }
+
+        store->records.swap(records);
+        store->strings.swap(strings);
+        store->sorted_count = store->records.size();
+        store->dead_records = 0;
+        store->dead_string_bytes = 0;
+    }
+}
+
+void engine_cold_store_append(EngineColdStore* store, const EngineColdRecord& record, const char* name, const char* magnet_uri)
+{
+    if(!store)
+    {
+        return;
+    }
+
+    EngineColdRecord packed = record;
+    packed.flags = static_cast<unsigned char>(record.flags & ~EngineColdFlag_Removed);
+    packed.name_offset = push_string(store->strings, name);
+    packed.magnet_offset = push_string(store->strings, magnet_uri);
+    store->records.push_back(packed);
+}
+
+void engine_cold_store_seal(EngineColdStore* store)
+{
+    if(!store || store->sorted_count == store->records.size())
+    {
+        return;
+    }
+
+    std::vector<EngineColdRecord>::iterator middle = store->records.begin() + static_cast<std::ptrdiff_t>(store->sorted_count);
+    std::sort(middle, store->records.end(), record_id_less);
+    std::inplace_merge(store->records.begin(), middle, store->records.end(), record_id_less);
+    store->sorted_count = store->records.size();
+}
+
+const EngineColdRecord* engine_cold_store_find(const EngineColdStore* store, unsigned int id)
+{
+    if(!store)
+    {
+        return nullptr;
+    }
+
+    const EngineColdRecord* begin = store->records.data();
+    const EngineColdRecord* end = begin + store->sorted_count;
+    const EngineColdRecord* it = std::lower_bound(begin, end, id, record_less_than_id);
+    if(it != end && it->id == id && !(it->flags & EngineColdFlag_Removed))
+    {
+        return it;
+    }
+    return nullptr;
+}
+
+bool engine_cold_store_erase(EngineColdStore* store, unsigned int id)
+{
+    EngineColdRecord* record = const_cast<EngineColdRecord*>(engine_cold_store_find(store, id));
+    if(!record)
+    {
+        return false;
+    }
+
+    record->flags |= EngineColdFlag_Removed;
+    store->dead_records++;
+    store->dead_string_bytes += string_bytes(store, record->name_offset) + string_bytes(store, record->magnet_offset);
+
+    if(store->dead_records * 2 > store->records.size())
+    {
+        compact(store);
+    }
+    return true;
+}
+
+const char* engine_cold_store_string(const EngineColdStore* store, unsigned int offset)
+{
+    if(!store || offset >= store->strings.size())
+    {
+        return "";
+    }
+    return &store->strings[offset];
+}
+
+size_t engine_cold_store_live_count(const EngineColdStore* store)
+{
+    if(!store)
+    {
+        return 0;
+    }
+    return store->records.size() - store->dead_records;
+}
+
+size_t engine_cold_store_bytes(const EngineColdStore* store)
+{
+    if(!store)
+    {
+        return 0;
+    }
+    return store->records.capacity() * sizeof(EngineColdRecord) + store->strings.capacity();
+}
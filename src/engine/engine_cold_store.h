@@ -0,0 +1,46 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+enum EngineColdFlags
+{
+    EngineColdFlag_Paused = 1 << 0,
+    EngineColdFlag_Complete = 1 << 1,
+    EngineColdFlag_Removed = 1 << 2
+};
+
+// Frozen copy of an archived torrent. Strings live NUL-terminated in the
+// store's shared arena; rates are implicitly zero.
+struct EngineColdRecord
+{
+    unsigned int id;
+    unsigned int name_offset;
+    unsigned int magnet_offset;
+    float progress;
+    unsigned long long size_bytes;
+    unsigned long long downloaded_bytes;
+    unsigned char flags;
+};
+
+// Packed, read-mostly tier for long-idle completed torrents. Records stay
+// sorted by ID; removals leave tombstones that are compacted in bulk.
+struct EngineColdStore
+{
+    std::vector<EngineColdRecord> records;
+    std::vector<char> strings;
+    size_t sorted_count;
+    size_t dead_records;
+    size_t dead_string_bytes;
+};
+
+// Appends stay unsorted until engine_cold_store_seal() merges them in.
+void engine_cold_store_append(EngineColdStore* store, const EngineColdRecord& record, const char* name, const char* magnet_uri);
+void engine_cold_store_seal(EngineColdStore* store);
+const EngineColdRecord* engine_cold_store_find(const EngineColdStore* store, unsigned int id);
+bool engine_cold_store_erase(EngineColdStore* store, unsigned int id);
+const char* engine_cold_store_string(const EngineColdStore* store, unsigned int offset);
+size_t engine_cold_store_live_count(const EngineColdStore* store);
+size_t engine_cold_store_bytes(const EngineColdStore* store);
@@ -0,0 +1,157 @@
+#include "engine/engine_event_ring.h"
+
+#include <new>
+
+#include <string.h>
+
+namespace
+{
+    const unsigned int kMaxEventCapacity = 1u << 20;
+    // 100 ns FILETIME ticks between 1601-01-01 and 1970-01-01.
+    const unsigned long long kUnixEpochFileTime = 116444736000000000ull;
+
+    static unsigned long long unix_time_ms()
+    {
+        FILETIME now;
+        GetSystemTimeAsFileTime(&now);
+        const unsigned long long ticks = (static_cast<unsigned long long>(now.dwHighDateTime) << 32) | now.dwLowDateTime;
+        return ticks > kUnixEpochFileTime ? (ticks - kUnixEpochFileTime) / 10000ull : 0;
+    }
+
+    static unsigned long long oldest_kept(const EngineEventRing* ring, unsigned long long head)
+    {
+        return head >= ring->capacity ? head - ring->capacity + 1 : 1;
+    }
+}
+
+int engine_event_ring_init(EngineEventRing* ring, unsigned int capacity)
+{
+    if(!ring)
+    {
+        return -1;
+    }
+    ZeroMemory(ring, sizeof(*ring));
+    if(capacity == 0 || capacity > kMaxEventCapacity)
+    {
+        return -1;
+    }
+
+    unsigned int rounded = 1;
+    while(rounded < capacity)
+    {
+        rounded <<= 1;
+    }
+    ring->slots = new (std::nothrow) EngineEventSlot[rounded]();
+    if(!ring->slots)
+    {
+        return -2;
+    }
+    ring->capacity = rounded;
+    return 0;
+}
+
+void engine_event_ring_destroy(EngineEventRing* ring)
+{
+    if(!ring)
+    {
+        return;
+    }
+    delete[] ring->slots;
+    ZeroMemory(ring, sizeof(*ring));
+}
+
+void engine_event_ring_push(EngineEventRing* ring, EngineEventType type, unsigned int torrent_id, const char* name, unsigned int error_code)
+{
+    if(!ring || !ring->slots)
+    {
+        return;
+    }
+
+    // Head moves first, so a reader that finds a slot not holding the
+    // sequence it expects can tell from head whether it was lapped or is
+    // just early. Interlocked* is a full barrier.
+    const unsigned long long seq = static_cast<unsigned long long>(ring->head) + 1;
+    InterlockedExchange64(&ring->head, static_cast<LONGLONG>(seq));
+    EngineEventSlot* slot = &ring->slots[seq & (ring->capacity - 1)];
+    InterlockedExchange64(&slot->seq, 0);
+
+    EngineEvent& event = slot->event;
+    event.seq = seq;
+    event.time_ms = unix_time_ms();
+    event.type = type;
+    event.torrent_id = torrent_id;
+    event.error_code = error_code;
+    event.name[0] = '\0';
+    if(name)
+    {
+        strncpy_s(event.name, sizeof(event.name), name, _TRUNCATE);
+    }
+
+    InterlockedExchange64(&slot->seq, static_cast<LONGLONG>(seq));
+}
+
+unsigned long long engine_event_ring_head(const EngineEventRing* ring)
+{
+    return ring ? static_cast<unsigned long long>(ring->head) : 0;
+}
+
+unsigned int engine_event_ring_read(const EngineEventRing* ring, unsigned long long since, EngineEvent* events,
+    unsigned int max_events, unsigned long long* out_next, bool* out_gap)
+{
+    bool gap = false;
+    unsigned long long seq = since + 1;
+    unsigned int count = 0;
+    if(ring && ring->slots)
+    {
+        unsigned long long head = engine_event_ring_head(ring);
+        if(since > head)
+        {
+            gap = true;
+            seq = 1;
+        }
+        while(count < max_events && seq <= head)
+        {
+            const unsigned long long oldest = oldest_kept(ring, head);
+            if(seq < oldest)
+            {
+                gap = true;
+                seq = oldest;
+            }
+
+            // Per-slot seqlock: the copy counts only if the slot held this
+            // sequence both before and after it.
+            const EngineEventSlot* slot = &ring->slots[seq & (ring->capacity - 1)];
+            const unsigned long long before = static_cast<unsigned long long>(slot->seq);
+            MemoryBarrier();
+            if(before == seq)
+            {
+                events[count] = slot->event;
+                MemoryBarrier();
+                if(static_cast<unsigned long long>(slot->seq) == seq)
+                {
+                    ++count;
+                    ++seq;
+                    continue;
+                }
+            }
+
+            // Either the writer lapped this slot, which head now shows, or
+            // it has claimed `seq` but not finished writing it.
+            head = engine_event_ring_head(ring);
+            if(seq >= oldest_kept(ring, head))
+            {
+                break;
+            }
+        }
+    }
+
+    if(out_next)
+    {
+        *out_next = seq - 1;
+    }
+    if(out_gap)
+    {
+        *out_gap = gap;
+    }
+    return count;
+}
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <windows.h>
+
+// Fixed-size journal of engine events for clients that follow changes
+// rather than state. Sequence numbers start at 1 and never repeat or skip
+// within a session; once the ring wraps, the oldest events are overwritten
+// and a reader that fell that far behind is told it missed some.
+
+enum EngineEventType
+{
+    EngineEvent_None = 0,
+    EngineEvent_TorrentAdded,
+    EngineEvent_TorrentRemoved,
+    EngineEvent_TorrentPaused,
+    EngineEvent_TorrentResumed,
+    EngineEvent_TorrentFinished,
+    // Reserved for torrent errors reported by libtorrent; `error_code`
+    // carries its value.
+    EngineEvent_TorrentError,
+    EngineEvent_Count
+};
+
+struct EngineEvent
+{
+    unsigned long long seq;
+    // Wall-clock time, milliseconds since the Unix epoch.
+    unsigned long long time_ms;
+    EngineEventType type;
+    unsigned int torrent_id;
+    unsigned int error_code;
+    char name[128];
+};
+
+struct EngineEventSlot
+{
+    // Sequence of the event held, or 0 while it is being written.
+    volatile LONGLONG seq;
+    EngineEvent event;
+};
+
+struct EngineEventRing
+{
+    EngineEventSlot* slots;
+    // Power of two; 0 when the ring could not be allocated.
+    unsigned int capacity;
+    // Sequence of the newest event. Stored before its slot is written.
+    volatile LONGLONG head;
+};
+
+// `capacity` is rounded up to a power of two.
+int engine_event_ring_init(EngineEventRing* ring, unsigned int capacity);
+void engine_event_ring_destroy(EngineEventRing* ring);
+
+// Writer side. Pushes must be serialized by the caller (the engine holds
+// its state lock); readers never block them.
+void engine_event_ring_push(EngineEventRing* ring, EngineEventType type, unsigned int torrent_id, const char* name, unsigned int error_code);
+
+// Reader side, lock-free and safe from any thread.
+unsigned long long engine_event_ring_head(const EngineEventRing* ring);
+
+// Copies up to `max_events` events with a sequence above `since`, oldest
+// first, and stores in `out_next` the sequence to pass as `since` next
+// time. `out_gap` is set when events after `since` were overwritten before
+// they could be read, or when `since` is ahead of the ring (a sequence
+// from an earlier session); the copy then resumes at the oldest event kept.
+unsigned int engine_event_ring_read(const EngineEventRing* ring, unsigned long long since, EngineEvent* events,
+    unsigned int max_events, unsigned long long* out_next, bool* out_gap);
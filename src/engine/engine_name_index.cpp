@@ -0,0 +1,243 @@
+#include "engine/engine_name_index.h"
+
+#include <algorithm>
+
+#include <string.h>
+
+namespace
+{
+    struct PostingCursor
+    {
+        const unsigned int* current;
+        const unsigned int* end;
+    };
+
+    struct CursorGreater
+    {
+        bool operator()(const PostingCursor& a, const PostingCursor& b) const
+        {
+            return *a.current > *b.current;
+        }
+    };
+
+    static unsigned int make_trigram(char a, char b, char c)
+    {
+        return (static_cast<unsigned int>(static_cast<unsigned char>(a)) << 16) |
+            (static_cast<unsigned int>(static_cast<unsigned char>(b)) << 8) |
+            static_cast<unsigned int>(static_cast<unsigned char>(c));
+    }
+
+    static void collect_trigrams(const char* text, std::vector<unsigned int>& out)
+    {
+        out.clear();
+        if(!text)
+        {
+            return;
+        }
+
+        const size_t len = strlen(text);
+        if(len < 3)
+        {
+            return;
+        }
+
+        out.reserve(len - 2);
+        char a = engine_name_fold(text[0]);
+        char b = engine_name_fold(text[1]);
+        for(size_t i = 2; i < len; ++i)
+        {
+            const char c = engine_name_fold(text[i]);
+            out.push_back(make_trigram(a, b, c));
+            a = b;
+            b = c;
+        }
+
+        std::sort(out.begin(), out.end());
+        out.erase(std::unique(out.begin(), out.end()), out.end());
+    }
+}
+
+char engine_name_fold(char ch)
+{
+    if(ch >= 'A' && ch <= 'Z')
+    {
+        return static_cast<char>(ch - 'A' + 'a');
+    }
+    return ch;
+}
+
+bool engine_name_contains(const char* haystack, const char* folded_needle, size_t needle_len, bool* out_prefix)
+{
+    if(out_prefix)
+    {
+        *out_prefix = false;
+    }
+    if(!haystack || !folded_needle)
+    {
+        return false;
+    }
+    if(needle_len == 0)
+    {
+        return true;
+    }
+
+    for(const char* start = haystack; *start; ++start)
+    {
+        size_t i = 0;
+        while(i < needle_len && start[i] && engine_name_fold(start[i]) == folded_needle[i])
+        {
+            ++i;
+        }
+        if(i == needle_len)
+        {
+            if(out_prefix)
+            {
+                *out_prefix = (start == haystack);
+            }
+            return true;
+        }
+    }
+    return false;
+}
+
+void engine_name_index_add(EngineNameIndex* index, unsigned int id, const char* name)
+{
+    if(!index)
+    {
+        return;
+    }
+
+    std::vector<unsigned int> trigrams;
+    collect_trigrams(name, trigrams);
+    for(size_t i = 0; i < trigrams.size(); ++i)
+    {
+        std::vector<unsigned int>& ids = index->postings[trigrams[i]];
+        if(ids.empty() || ids.back() < id)
+        {
+            ids.push_back(id);
+        }
+        else
+        {
+            std::vector<unsigned int>::iterator it = std::lower_bound(ids.begin(), ids.end(), id);
+            if(it == ids.end() || *it != id)
+            {
+                ids.insert(it, id);
+            }
+        }
+    }
+}
+
+void engine_name_index_remove(EngineNameIndex* index, unsigned int id, const char* name)
+{
+    if(!index)
+    {
+        return;
+    }
+
+    std::vector<unsigned int> trigrams;
+    collect_trigrams(name, trigrams);
+    for(size_t i = 0; i < trigrams.size(); ++i)
+    {
+        std::unordered_map<unsigned int, std::vector<unsigned int>>::iterator found = index->postings.find(trigrams[i]);
+        if(found == index->postings.end())
+        {
+            continue;
+        }
+
+        std::vector<unsigned int>& ids = found->second;
+        std::vector<unsigned int>::iterator it = std::lower_bound(ids.begin(), ids.end(), id);
+        if(it != ids.end() && *it == id)
+        {
+            ids.erase(it);
+        }
+        if(ids.empty())
+        {
+            index->postings.erase(found);
+        }
+    }
+}
+
+unsigned int engine_name_index_query(const EngineNameIndex* index, const char* query, unsigned int min_matched_percent, std::vector<EngineNameMatch>& out)
+{
+    out.clear();
+    if(!index)
+    {
+        return 0;
+    }
+
+    std::vector<unsigned int> trigrams;
+    collect_trigrams(query, trigrams);
+    const unsigned int total = static_cast<unsigned int>(trigrams.size());
+    if(total == 0)
+    {
+        return 0;
+    }
+
+    if(min_matched_percent > 100)
+    {
+        min_matched_percent = 100;
+    }
+    unsigned int min_matched = (total * min_matched_percent + 99) / 100;
+    if(min_matched == 0)
+    {
+        min_matched = 1;
+    }
+
+    std::vector<PostingCursor> heap;
+    heap.reserve(total);
+    for(unsigned int i = 0; i < total; ++i)
+    {
+        std::unordered_map<unsigned int, std::vector<unsigned int>>::const_iterator found = index->postings.find(trigrams[i]);
+        if(found == index->postings.end() || found->second.empty())
+        {
+            continue;
+        }
+        PostingCursor cursor;
+        cursor.current = found->second.data();
+        cursor.end = found->second.data() + found->second.size();
+        heap.push_back(cursor);
+    }
+    if(heap.size() < min_matched)
+    {
+        return total;
+    }
+
+    // k-way merge over the ID-ordered postings; equal IDs surface consecutively,
+    // so each run length is the number of query trigrams that name contains.
+    std::make_heap(heap.begin(), heap.end(), CursorGreater());
+    while(!heap.empty())
+    {
+        const unsigned int id = *heap.front().current;
+        unsigned int matched = 0;
+        while(!heap.empty() && *heap.front().current == id)
+        {
+            std::pop_heap(heap.begin(), heap.end(), CursorGreater());
+            PostingCursor& cursor = heap.back();
+            ++matched;
+            ++cursor.current;
+            if(cursor.current == cursor.end)
+            {
+                heap.pop_back();
+            }
+            else
+            {
+                std::push_heap(heap.begin(), heap.end(), CursorGreater());
+            }
+        }
+
+        if(matched >= min_matched)
+        {
+            EngineNameMatch match;
+            match.id = id;
+            match.matched_trigrams = matched;
+            out.push_back(match);
+        }
+
+        if(heap.size() < min_matched)
+        {
+            break;
+        }
+    }
+
+    return total;
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <unordered_map>
+#include <vector>
+
+// Trigram inverted index over torrent names. Keys are three case-folded bytes,
+// postings are torrent IDs kept in ascending order (IDs are handed out
+// monotonically, so adds are plain appends).
+struct EngineNameIndex
+{
+    std::unordered_map<unsigned int, std::vector<unsigned int>> postings;
+};
+
+struct EngineNameMatch
+{
+    unsigned int id;
+    unsigned int matched_trigrams;
+};
+
+void engine_name_index_add(EngineNameIndex* index, unsigned int id, const char* name);
+void engine_name_index_remove(EngineNameIndex* index, unsigned int id, const char* name);
+
+// Collects every ID sharing at least `min_matched_percent` of the distinct trigrams with the
+// query, ordered by ID. Returns the number of distinct trigrams in the query
+// (0 when the query is shorter than three bytes and the index cannot help).
+unsigned int engine_name_index_query(const EngineNameIndex* index, const char* query, unsigned int min_matched_percent, std::vector<EngineNameMatch>& out);
+
+char engine_name_fold(char ch);
+bool engine_name_contains(const char* haystack, const char* folded_needle, size_t needle_len, bool* out_prefix);
@@ -0,0 +1,227 @@
+#include "engine/engine_order_index.h"
+
+namespace
+{
+    const unsigned int kNullNode = 0;
+
+    static bool key_less(unsigned long long a_value, unsigned int a_id, unsigned long long b_value, unsigned int b_id)
+    {
+        if(a_value != b_value)
+        {
+            return a_value < b_value;
+        }
+        return a_id < b_id;
+    }
+
+    static unsigned int next_priority(EngineOrderIndex* index)
+    {
+        unsigned int x = index->seed;
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        index->seed = x;
+        return x;
+    }
+
+    static void update_size(EngineOrderIndex* index, unsigned int node)
+    {
+        EngineOrderNode& n = index->nodes[node];
+        n.size = 1 + index->nodes[n.left].size + index->nodes[n.right].size;
+    }
+
+    // Splits `node` into keys below (value, id) and the rest. With `inclusive`
+    // the key itself goes to the left side.
+    static void split(EngineOrderIndex* index, unsigned int node, unsigned long long value, unsigned int id, bool inclusive,
+        unsigned int* out_left, unsigned int* out_right)
+    {
+        if(node == kNullNode)
+        {
+            *out_left = kNullNode;
+            *out_right = kNullNode;
+            return;
+        }
+
+        EngineOrderNode& n = index->nodes[node];
+        const bool goes_left = inclusive
+            ? !key_less(value, id, n.value, n.id)
+            : key_less(n.value, n.id, value, id);
+        if(goes_left)
+        {
+            unsigned int left = kNullNode;
+            split(index, n.right, value, id, inclusive, &left, out_right);
+            index->nodes[node].right = left;
+            update_size(index, node);
+            *out_left = node;
+        }
+        else
+        {
+            unsigned int right = kNullNode;
+            split(index, n.left, value, id, inclusive, out_left, &right);
+            index->nodes[node].left = right;
+            update_size(index, node);
+            *out_right = node;
+        }
+    }
+
+    static unsigned int merge(EngineOrderIndex* index, unsigned int left, unsigned int right)
+    {
+        if(left == kNullNode)
+        {
+            return right;
+        }
+        if(right == kNullNode)
+        {
+            return left;
+        }
+
+        if(index->nodes[left].priority > index->nodes[right].priority)
+        {
+            const unsigned int merged = merge(index, index->nodes[left].right, right);
+            index->nodes[left].right = merged;
+            update_size(index, left);
+            return left;
+        }
+
+        const unsigned int merged = merge(index, left, index->nodes[right].left);
+        index->nodes[right].left = merged;
+        update_size(index, right);
+        return right;
+    }
+
+    static void walk_page(const EngineOrderIndex* index, unsigned int node, bool descending,
+        unsigned int* offset, unsigned int* remaining, std::vector<unsigned int>& out)
+    {
+        if(node == kNullNode || *remaining == 0)
+        {
+            return;
+        }
+
+        const EngineOrderNode& n = index->nodes[node];
+        const unsigned int near_child = descending ? n.right : n.left;
+        const unsigned int far_child = descending ? n.left : n.right;
+
+        const unsigned int near_size = index->nodes[near_child].size;
+        if(*offset >= near_size)
+        {
+            *offset -= near_size;
+        }
+        else
+        {
+            walk_page(index, near_child, descending, offset, remaining, out);
+        }
+
+        if(*remaining == 0)
+        {
+            return;
+        }
+        if(*offset > 0)
+        {
+            --*offset;
+        }
+        else
+        {
+            out.push_back(n.id);
+            --*remaining;
+        }
+
+        walk_page(index, far_child, descending, offset, remaining, out);
+    }
+}
+
+void engine_order_index_init(EngineOrderIndex* index, unsigned int seed)
+{
+    if(!index)
+    {
+        return;
+    }
+
+    EngineOrderNode sentinel;
+    sentinel.value = 0;
+    sentinel.id = 0;
+    sentinel.priority = 0;
+    sentinel.left = kNullNode;
+    sentinel.right = kNullNode;
+    sentinel.size = 0;
+
+    index->nodes.assign(1, sentinel);
+    index->free_nodes.clear();
+    index->root = kNullNode;
+    index->seed = seed ? seed : 0x9E3779B9u;
+}
+
+void engine_order_index_insert(EngineOrderIndex* index, unsigned long long value, unsigned int id)
+{
+    if(!index || index->nodes.empty())
+    {
+        return;
+    }
+
+    unsigned int node = kNullNode;
+    if(!index->free_nodes.empty())
+    {
+        node = index->free_nodes.back();
+        index->free_nodes.pop_back();
+    }
+    else
+    {
+        node = static_cast<unsigned int>(index->nodes.size());
+        index->nodes.push_back(index->nodes[kNullNode]);
+    }
+
+    EngineOrderNode& n = index->nodes[node];
+    n.value = value;
+    n.id = id;
+    n.priority = next_priority(index);
+    n.left = kNullNode;
+    n.right = kNullNode;
+    n.size = 1;
+
+    unsigned int left = kNullNode;
+    unsigned int right = kNullNode;
+    split(index, index->root, value, id, false, &left, &right);
+    index->root = merge(index, merge(index, left, node), right);
+}
+
+void engine_order_index_erase(EngineOrderIndex* index, unsigned long long value, unsigned int id)
+{
+    if(!index || index->root == kNullNode)
+    {
+        return;
+    }
+
+    unsigned int left = kNullNode;
+    unsigned int rest = kNullNode;
+    split(index, index->root, value, id, false, &left, &rest);
+
+    unsigned int match = kNullNode;
+    unsigned int right = kNullNode;
+    split(index, rest, value, id, true, &match, &right);
+
+    if(match != kNullNode)
+    {
+        index->nodes[match].left = kNullNode;
+        index->nodes[match].right = kNullNode;
+        index->nodes[match].size = 0;
+        index->free_nodes.push_back(match);
+    }
+
+    index->root = merge(index, left, right);
+}
+
+unsigned int engine_order_index_size(const EngineOrderIndex* index)
+{
+    if(!index || index->nodes.empty())
+    {
+        return 0;
+    }
+    return index->nodes[index->root].size;
+}
+
+void engine_order_index_page(const EngineOrderIndex* index, unsigned int offset, unsigned int count, bool descending, std::vector<unsigned int>& out)
+{
+    if(!index || index->nodes.empty() || count == 0)
+    {
+        return;
+    }
+    walk_page(index, index->root, descending, &offset, &count, out);
+}
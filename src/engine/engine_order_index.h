@@ -0,0 +1,37 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <vector>
+
+// Order-statistic treap keyed by (value, id). Nodes live in one vector and are
+// linked by index, so updates never touch the allocator once it has grown to
+// the library size. Every node carries its subtree size, which makes rank
+// lookups and page walks O(log n + page).
+struct EngineOrderNode
+{
+    unsigned long long value;
+    unsigned int id;
+    unsigned int priority;
+    unsigned int left;
+    unsigned int right;
+    unsigned int size;
+};
+
+struct EngineOrderIndex
+{
+    std::vector<EngineOrderNode> nodes;
+    std::vector<unsigned int> free_nodes;
+    unsigned int root;
+    unsigned int seed;
+};
+
+void engine_order_index_init(EngineOrderIndex* index, unsigned int seed);
+void engine_order_index_insert(EngineOrderIndex* index, unsigned long long value, unsigned int id);
+void engine_order_index_erase(EngineOrderIndex* index, unsigned long long value, unsigned int id);
+unsigned int engine_order_index_size(const EngineOrderIndex* index);
+
+// Appends up to `count` IDs starting at rank `offset` (ascending, or from the
+// largest value when `descending` is set) to `out`.
+void engine_order_index_page(const EngineOrderIndex* index, unsigned int offset, unsigned int count, bool descending, std::vector<unsigned int>& out);
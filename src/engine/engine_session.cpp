@@ -4,10 +4,15 @@
 #include <new>
 #include <string>
 
+#include <limits.h>
 #include <wchar.h>
 #include <string.h>
 
 #include "debug.h"
+#include "engine/engine_cold_store.h"
+#include "engine/engine_name_index.h"
+#include "engine/engine_order_index.h"
+#include "engine/engine_stats_shm.h"
 
 namespace
 {
@@ -23,16 +28,46 @@ namespace
         float progress;
         bool paused;
         bool complete;
+        ULONGLONG last_activity_tick;
     };
 
+    // Sort keys from EngineSortKey_Size upwards have a maintained order index.
+    const int kFirstIndexedSortKey = EngineSortKey_Size;
+    const int kOrderIndexCount = EngineSortKey_Count - kFirstIndexedSortKey;
+
     struct EngineSessionState
     {
         std::vector<EngineTorrentEntry> torrents;
+        EngineNameIndex name_index;
+        EngineOrderIndex order_indexes[kOrderIndexCount];
+        EngineColdStore cold;
+        EngineStatsShm stats_shm;
+        // Export rows of the cold tier, in ID order. Cold torrents are frozen,
+        // so the rows only change when torrents enter or leave the tier.
+        std::vector<RawBitShmTorrent> shm_cold_rows;
+        // Stats of the hot tier, kept current by tally_entry/untally_entry
+        // around every change to a hot entry, so no stats read walks it.
+        EngineSessionStats hot_totals;
+        // Session version of the last export; nothing is republished until
+        // it moves.
+        unsigned long long shm_version;
+        bool shm_published;
         unsigned int next_torrent_id;
     };
 
     const unsigned long long kDefaultTorrentSize = 512ull * 1024ull * 1024ull;
     const unsigned int kActiveDownloadRate = 256u * 1024u;
+    const unsigned int kSearchFuzzyPercent = 50;
+    const unsigned int kSearchSubstringScore = 2000;
+    const unsigned int kSearchPrefixScore = 500;
+    const unsigned int kSearchTrigramScore = 1000;
+
+    // Lightweight view used where hot and cold torrents are handled alike.
+    struct EngineNameRef
+    {
+        const char* name;
+        unsigned int id;
+    };
 
     static EngineSessionState* create_state()
     {
@@ -40,12 +75,20 @@ namespace
         if(state)
         {
             state->next_torrent_id = 1;
+            for(int i = 0; i < kOrderIndexCount; ++i)
+            {
+                engine_order_index_init(&state->order_indexes[i], 0x2545F491u + static_cast<unsigned int>(i));
+            }
         }
         return state;
     }
 
     static void destroy_state(EngineSessionState* state)
     {
+        if(state)
+        {
+            engine_stats_shm_close(&state->stats_shm);
+        }
         delete state;
     }
 
@@ -54,6 +97,13 @@ namespace
         return reinterpret_cast<EngineSessionState*>(session->state);
     }
 
+    static bool entry_id_less(const EngineTorrentEntry& entry, unsigned int id)
+    {
+        return entry.id < id;
+    }
+
+    // Entries are appended with increasing IDs and erased in place, so the
+    // vector stays sorted by ID and lookups can bisect.
     static EngineTorrentEntry* find_entry(EngineSessionState* state, unsigned int id)
     {
         if(!state)
@@ -61,16 +111,168 @@ namespace
             return nullptr;
         }
 
-        for(size_t i = 0; i < state->torrents.size(); ++i)
+        std::vector<EngineTorrentEntry>::iterator it =
+            std::lower_bound(state->torrents.begin(), state->torrents.end(), id, entry_id_less);
+        if(it != state->torrents.end() && it->id == id)
+        {
+            return &*it;
+        }
+        return nullptr;
+    }
+
+    // String bytes count by length, not capacity: entries shifted inside the
+    // vector keep their length but not always their capacity.
+    static unsigned long long entry_string_bytes(const EngineTorrentEntry& entry)
+    {
+        return entry.name.size() + entry.magnet_uri.size();
+    }
+
+    static void tally_entry(EngineSessionState* state, const EngineTorrentEntry& entry)
+    {
+        EngineSessionStats* totals = &state->hot_totals;
+        totals->torrent_count++;
+        if(!entry.complete && !entry.paused)
+        {
+            totals->active_count++;
+        }
+        totals->download_rate += entry.download_rate;
+        totals->upload_rate += entry.upload_rate;
+        totals->hot_bytes += entry_string_bytes(entry);
+    }
+
+    static void untally_entry(EngineSessionState* state, const EngineTorrentEntry& entry)
+    {
+        EngineSessionStats* totals = &state->hot_totals;
+        totals->torrent_count--;
+        if(!entry.complete && !entry.paused)
+        {
+            totals->active_count--;
+        }
+        totals->download_rate -= entry.download_rate;
+        totals->upload_rate -= entry.upload_rate;
+        totals->hot_bytes -= entry_string_bytes(entry);
+    }
+
+    static unsigned long long sort_value(unsigned long long size_bytes, float progress,
+        unsigned int download_rate, unsigned int upload_rate, int sort_key)
+    {
+        switch(sort_key)
         {
-            if(state->torrents[i].id == id)
+            case EngineSortKey_Size:
+                return size_bytes;
+            case EngineSortKey_Progress:
             {
-                return &state->torrents[i];
+                // Non-negative IEEE floats order the same as their bit patterns.
+                const float clamped = progress > 0.0f ? progress : 0.0f;
+                unsigned int bits = 0;
+                memcpy(&bits, &clamped, sizeof(bits));
+                return bits;
             }
+            case EngineSortKey_DownloadRate:
+                return download_rate;
+            case EngineSortKey_UploadRate:
+                return upload_rate;
+            default:
+                return 0;
+        }
+    }
+
+    static unsigned long long entry_sort_value(const EngineTorrentEntry& entry, int sort_key)
+    {
+        return sort_value(entry.size_bytes, entry.progress, entry.download_rate, entry.upload_rate, sort_key);
+    }
+
+    static unsigned long long cold_sort_value(const EngineColdRecord& record, int sort_key)
+    {
+        return sort_value(record.size_bytes, record.progress, 0, 0, sort_key);
+    }
+
+    static void capture_sort_values(const EngineTorrentEntry& entry, unsigned long long* values)
+    {
+        for(int i = 0; i < kOrderIndexCount; ++i)
+        {
+            values[i] = entry_sort_value(entry, kFirstIndexedSortKey + i);
+        }
+    }
+
+    static void reindex_changed(EngineSessionState* state, const EngineTorrentEntry& entry, const unsigned long long* before)
+    {
+        for(int i = 0; i < kOrderIndexCount; ++i)
+        {
+            const unsigned long long after = entry_sort_value(entry, kFirstIndexedSortKey + i);
+            if(after != before[i])
+            {
+                engine_order_index_erase(&state->order_indexes[i], before[i], entry.id);
+                engine_order_index_insert(&state->order_indexes[i], after, entry.id);
+            }
+        }
+    }
+
+    static void index_entry(EngineSessionState* state, const EngineTorrentEntry& entry)
+    {
+        for(int i = 0; i < kOrderIndexCount; ++i)
+        {
+            engine_order_index_insert(&state->order_indexes[i], entry_sort_value(entry, kFirstIndexedSortKey + i), entry.id);
+        }
+    }
+
+    static void unindex_entry(EngineSessionState* state, const EngineTorrentEntry& entry)
+    {
+        for(int i = 0; i < kOrderIndexCount; ++i)
+        {
+            engine_order_index_erase(&state->order_indexes[i], entry_sort_value(entry, kFirstIndexedSortKey + i), entry.id);
+        }
+    }
+
+    static bool name_ref_less(const EngineNameRef& a, const EngineNameRef& b)
+    {
+        const int cmp = _stricmp(a.name, b.name);
+        if(cmp != 0)
+        {
+            return cmp < 0;
+        }
+        return a.id < b.id;
+    }
+
+    static bool name_ref_greater(const EngineNameRef& a, const EngineNameRef& b)
+    {
+        return name_ref_less(b, a);
+    }
+
+    static const char* lookup_name(EngineSessionState* state, unsigned int id)
+    {
+        const EngineTorrentEntry* entry = find_entry(state, id);
+        if(entry)
+        {
+            return entry->name.c_str();
+        }
+        const EngineColdRecord* record = engine_cold_store_find(&state->cold, id);
+        if(record)
+        {
+            return engine_cold_store_string(&state->cold, record->name_offset);
         }
         return nullptr;
     }
 
+    static bool search_hit_better(const EngineSearchHit& a, const EngineSearchHit& b)
+    {
+        if(a.score != b.score)
+        {
+            return a.score > b.score;
+        }
+        return a.id < b.id;
+    }
+
+    static unsigned int score_name(const char* name, const char* folded_query, size_t query_len)
+    {
+        bool prefix = false;
+        if(!engine_name_contains(name, folded_query, query_len, &prefix))
+        {
+            return 0;
+        }
+        return kSearchSubstringScore + (prefix ? kSearchPrefixScore : 0);
+    }
+
     static void clamp_string(std::string& value, size_t max_len)
     {
         if(value.length() > max_len)
@@ -200,6 +402,617 @@ namespace
         status.is_complete = entry.complete ? 1 : 0;
     }
 
+    static void copy_cold_status(const EngineColdStore* store, const EngineColdRecord& record, EngineTorrentStatus& status)
+    {
+        status.id = record.id;
+        strncpy_s(status.name, engine_cold_store_string(store, record.name_offset), _TRUNCATE);
+        strncpy_s(status.magnet_uri, engine_cold_store_string(store, record.magnet_offset), _TRUNCATE);
+        status.progress = record.progress;
+        status.size_bytes = record.size_bytes;
+        status.downloaded_bytes = record.downloaded_bytes;
+        status.download_rate = 0;
+        status.upload_rate = 0;
+        status.is_paused = (record.flags & EngineColdFlag_Paused) ? 1 : 0;
+        status.is_complete = (record.flags & EngineColdFlag_Complete) ? 1 : 0;
+    }
+
+    static void push_hot_status(const EngineTorrentEntry& entry, EngineSessionSnapshot* snapshot)
+    {
+        EngineTorrentStatus status;
+        ZeroMemory(&status, sizeof(status));
+        copy_status(entry, status);
+        snapshot->torrents.push_back(status);
+    }
+
+    static void push_cold_status(const EngineColdStore* store, const EngineColdRecord& record, EngineSessionSnapshot* snapshot)
+    {
+        EngineTorrentStatus status;
+        ZeroMemory(&status, sizeof(status));
+        copy_cold_status(store, record, status);
+        snapshot->torrents.push_back(status);
+    }
+
+    static void push_status_by_id(EngineSessionState* state, unsigned int id, EngineSessionSnapshot* snapshot)
+    {
+        const EngineTorrentEntry* entry = find_entry(state, id);
+        if(entry)
+        {
+            push_hot_status(*entry, snapshot);
+            return;
+        }
+        const EngineColdRecord* record = engine_cold_store_find(&state->cold, id);
+        if(record)
+        {
+            push_cold_status(&state->cold, *record, snapshot);
+        }
+    }
+
+    static void fill_shm_hot(const EngineTorrentEntry& entry, RawBitShmTorrent* row)
+    {
+        row->id = entry.id;
+        row->flags = 0;
+        if(entry.paused)
+        {
+            row->flags |= RawBitShmTorrent_Paused;
+        }
+        if(entry.complete)
+        {
+            row->flags |= RawBitShmTorrent_Complete;
+        }
+        row->progress = entry.progress;
+        row->download_rate = entry.download_rate;
+        row->upload_rate = entry.upload_rate;
+        row->reserved = 0;
+        row->size_bytes = entry.size_bytes;
+        row->downloaded_bytes = entry.downloaded_bytes;
+    }
+
+    static void fill_shm_cold(const EngineColdRecord& record, RawBitShmTorrent* row)
+    {
+        row->id = record.id;
+        row->flags = RawBitShmTorrent_Cold;
+        if(record.flags & EngineColdFlag_Paused)
+        {
+            row->flags |= RawBitShmTorrent_Paused;
+        }
+        if(record.flags & EngineColdFlag_Complete)
+        {
+            row->flags |= RawBitShmTorrent_Complete;
+        }
+        row->progress = record.progress;
+        row->download_rate = 0;
+        row->upload_rate = 0;
+        row->reserved = 0;
+        row->size_bytes = record.size_bytes;
+        row->downloaded_bytes = record.downloaded_bytes;
+    }
+
+    static bool shm_row_id_less(const RawBitShmTorrent& row, unsigned int id)
+    {
+        return row.id < id;
+    }
+
+    static bool shm_row_less(const RawBitShmTorrent& left, const RawBitShmTorrent& right)
+    {
+        return left.id < right.id;
+    }
+
+    static void forget_shm_cold_row(EngineSessionState* state, unsigned int id)
+    {
+        std::vector<RawBitShmTorrent>& rows = state->shm_cold_rows;
+        std::vector<RawBitShmTorrent>::iterator it = std::lower_bound(rows.begin(), rows.end(), id, shm_row_id_less);
+        if(it != rows.end() && it->id == id)
+        {
+            rows.erase(it);
+        }
+    }
+
+    // Moves a cold torrent back into the hot vector (kept in ID order). Its
+    // sort values are unchanged, so the order indexes need no update.
+    static EngineTorrentEntry* promote_entry(EngineSessionState* state, unsigned int id)
+    {
+        const EngineColdRecord* record = engine_cold_store_find(&state->cold, id);
+        if(!record)
+        {
+            return nullptr;
+        }
+
+        EngineTorrentEntry entry;
+        entry.id = record->id;
+        entry.name = engine_cold_store_string(&state->cold, record->name_offset);
+        entry.magnet_uri = engine_cold_store_string(&state->cold, record->magnet_offset);
+        entry.size_bytes = record->size_bytes;
+        entry.downloaded_bytes = record->downloaded_bytes;
+        entry.download_rate = 0;
+        entry.upload_rate = 0;
+        entry.progress = record->progress;
+        entry.paused = (record->flags & EngineColdFlag_Paused) != 0;
+        entry.complete = (record->flags & EngineColdFlag_Complete) != 0;
+        entry.last_activity_tick = GetTickCount64();
+        engine_cold_store_erase(&state->cold, id);
+        forget_shm_cold_row(state, id);
+
+        std::vector<EngineTorrentEntry>::iterator it =
+            std::lower_bound(state->torrents.begin(), state->torrents.end(), id, entry_id_less);
+        it = state->torrents.insert(it, entry);
+        tally_entry(state, *it);
+        return &*it;
+    }
+
+    static EngineTorrentEntry* touch_entry(EngineSessionState* state, unsigned int id)
+    {
+        if(!state)
+        {
+            return nullptr;
+        }
+        EngineTorrentEntry* entry = find_entry(state, id);
+        if(!entry)
+        {
+            entry = promote_entry(state, id);
+        }
+        if(entry)
+        {
+            entry->last_activity_tick = GetTickCount64();
+        }
+        return entry;
+    }
+
+    // Freezes complete, paused torrents that saw no activity for `idle_ms` into
+    // the cold store. Returns the number archived.
+    static unsigned int archive_idle_entries(EngineSessionState* state, unsigned int idle_ms, ULONGLONG now)
+    {
+        if(idle_ms == 0)
+        {
+            return 0;
+        }
+
+        unsigned int archived = 0;
+        size_t write = 0;
+        const bool exporting = state->stats_shm.header != nullptr;
+        const size_t exported_cold = state->shm_cold_rows.size();
+        for(size_t i = 0; i < state->torrents.size(); ++i)
+        {
+            EngineTorrentEntry& entry = state->torrents[i];
+            if(entry.complete && entry.paused && (now - entry.last_activity_tick) >= idle_ms)
+            {
+                untally_entry(state, entry);
+                unsigned long long before[kOrderIndexCount];
+                capture_sort_values(entry, before);
+                entry.download_rate = 0;
+                entry.upload_rate = 0;
+                reindex_changed(state, entry, before);
+
+                EngineColdRecord record;
+                ZeroMemory(&record, sizeof(record));
+                record.id = entry.id;
+                record.progress = entry.progress;
+                record.size_bytes = entry.size_bytes;
+                record.downloaded_bytes = entry.downloaded_bytes;
+                record.flags = EngineColdFlag_Paused | EngineColdFlag_Complete;
+                engine_cold_store_append(&state->cold, record, entry.name.c_str(), entry.magnet_uri.c_str());
+                if(exporting)
+                {
+                    state->shm_cold_rows.resize(state->shm_cold_rows.size() + 1);
+                    fill_shm_cold(record, &state->shm_cold_rows.back());
+                }
+                ++archived;
+                continue;
+            }
+
+            if(write != i)
+            {
+                state->torrents[write] = std::move(entry);
+            }
+            ++write;
+        }
+
+        if(archived != 0)
+        {
+            state->torrents.erase(state->torrents.begin() + static_cast<std::ptrdiff_t>(write), state->torrents.end());
+            engine_cold_store_seal(&state->cold);
+            // The new rows arrive in ID order, as the hot vector is kept.
+            std::inplace_merge(state->shm_cold_rows.begin(), state->shm_cold_rows.begin() + static_cast<std::ptrdiff_t>(exported_cold),
+                state->shm_cold_rows.end(), shm_row_less);
+        }
+        return archived;
+    }
+
+    static void reset_stats(EngineSessionStats* stats)
+    {
+        ZeroMemory(stats, sizeof(*stats));
+    }
+
+    // Hot totals plus the cold tier. Cold torrents are always complete,
+    // paused and idle: they only add to the totals and memory figures.
+    static void collect_stats(const EngineSessionState* state, EngineSessionStats* stats)
+    {
+        *stats = state->hot_totals;
+        const size_t cold_count = engine_cold_store_live_count(&state->cold);
+        stats->hot_count = static_cast<unsigned int>(state->torrents.size());
+        stats->cold_count = static_cast<unsigned int>(cold_count);
+        stats->torrent_count += static_cast<unsigned int>(cold_count);
+        stats->hot_bytes += state->torrents.capacity() * sizeof(EngineTorrentEntry);
+        stats->cold_bytes = engine_cold_store_bytes(&state->cold);
+    }
+
+    // Returns whether anything visible to clients changed.
+    static bool tick_entry(EngineSessionState* state, EngineTorrentEntry& entry, ULONGLONG now)
+    {
+        unsigned long long before[kOrderIndexCount];
+        capture_sort_values(entry, before);
+
+        const bool was_complete = entry.complete;
+        const unsigned long long was_downloaded = entry.downloaded_bytes;
+        untally_entry(state, entry);
+        simulate_progress(entry);
+        tally_entry(state, entry);
+        if(entry.complete != was_complete)
+        {
+            entry.last_activity_tick = now;
+        }
+
+        reindex_changed(state, entry, before);
+
+        bool changed = entry.complete != was_complete || entry.downloaded_bytes != was_downloaded;
+        for(int i = 0; i < kOrderIndexCount && !changed; ++i)
+        {
+            changed = entry_sort_value(entry, kFirstIndexedSortKey + i) != before[i];
+        }
+        return changed;
+    }
+
+    static void push_id_order_page(EngineSessionState* state, size_t offset, size_t count, bool descending, EngineSessionSnapshot* snapshot)
+    {
+        const std::vector<EngineTorrentEntry>& hot = state->torrents;
+        const std::vector<EngineColdRecord>& cold = state->cold.records;
+
+        if(engine_cold_store_live_count(&state->cold) == 0)
+        {
+            for(size_t i = 0; i < count; ++i)
+            {
+                const size_t row = descending ? (hot.size() - 1 - offset - i) : (offset + i);
+                push_hot_status(hot[row], snapshot);
+            }
+            return;
+        }
+
+        // h and c count records consumed from the chosen end of each tier.
+        size_t h = 0;
+        size_t c = 0;
+        size_t rank = 0;
+        while(snapshot->torrents.size() < count && (h < hot.size() || c < cold.size()))
+        {
+            const size_t hi = descending ? hot.size() - 1 - h : h;
+            const size_t ci = descending ? cold.size() - 1 - c : c;
+            if(c < cold.size() && (cold[ci].flags & EngineColdFlag_Removed))
+            {
+                ++c;
+                continue;
+            }
+
+            bool take_hot = false;
+            if(c == cold.size())
+            {
+                take_hot = true;
+            }
+            else if(h < hot.size())
+            {
+                take_hot = descending ? (hot[hi].id > cold[ci].id) : (hot[hi].id < cold[ci].id);
+            }
+
+            if(rank++ >= offset)
+            {
+                if(take_hot)
+                {
+                    push_hot_status(hot[hi], snapshot);
+                }
+                else
+                {
+                    push_cold_status(&state->cold, cold[ci], snapshot);
+                }
+            }
+            if(take_hot)
+            {
+                ++h;
+            }
+            else
+            {
+                ++c;
+            }
+        }
+    }
+
+    static bool cold_record_id_less(const EngineColdRecord& record, unsigned int id)
+    {
+        return record.id < id;
+    }
+
+    // Ascending ID order from just past `after_id`. Both tiers are sorted by
+    // ID under the lock, so the start is two bisections rather than a walk.
+    static void push_id_after_page(EngineSessionState* state, unsigned int after_id, size_t count, EngineSessionSnapshot* snapshot)
+    {
+        const std::vector<EngineTorrentEntry>& hot = state->torrents;
+        const std::vector<EngineColdRecord>& cold = state->cold.records;
+        if(after_id == UINT_MAX)
+        {
+            return;
+        }
+
+        size_t h = static_cast<size_t>(std::lower_bound(hot.begin(), hot.end(), after_id + 1, entry_id_less) - hot.begin());
+        size_t c = static_cast<size_t>(std::lower_bound(cold.begin(), cold.end(), after_id + 1, cold_record_id_less) - cold.begin());
+        while(snapshot->torrents.size() < count && (h < hot.size() || c < cold.size()))
+        {
+            if(c < cold.size() && (cold[c].flags & EngineColdFlag_Removed))
+            {
+                ++c;
+                continue;
+            }
+            if(c == cold.size() || (h < hot.size() && hot[h].id < cold[c].id))
+            {
+                push_hot_status(hot[h++], snapshot);
+            }
+            else
+            {
+                push_cold_status(&state->cold, cold[c++], snapshot);
+            }
+        }
+    }
+
+    // Callers hold state_lock, which also guards the change callback.
+    static void bump_version(EngineSession* session)
+    {
+        InterlockedIncrement64(&session->version);
+        if(session->on_change)
+        {
+            session->on_change(session->on_change_context);
+        }
+    }
+
+    // Builds everything but the ID, so the strings are allocated before the
+    // state lock is taken.
+    static void make_entry(const EngineAddTorrentOptions* options, EngineTorrentEntry& entry)
+    {
+        entry.id = 0;
+        entry.name = determine_display_name(options);
+        clamp_string(entry.name, 120);
+        entry.magnet_uri.clear();
+        if(options->magnet_uri && options->magnet_uri[0] != '\0')
+        {
+            entry.magnet_uri = options->magnet_uri;
+            clamp_string(entry.magnet_uri, 200);
+        }
+        entry.size_bytes = determine_size_bytes(options);
+        entry.downloaded_bytes = 0;
+        entry.download_rate = 0;
+        entry.upload_rate = 0;
+        entry.progress = 0.0f;
+        entry.paused = false;
+        entry.complete = false;
+        entry.last_activity_tick = GetTickCount64();
+    }
+
+    // The *_locked mutations are shared by the single-torrent calls and
+    // command batches. Callers hold state_lock and bump the version after
+    // any change.
+    static unsigned int add_locked(EngineSession* session, EngineSessionState* state, EngineTorrentEntry& entry)
+    {
+        entry.id = state->next_torrent_id++;
+        state->torrents.push_back(entry);
+        tally_entry(state, state->torrents.back());
+        engine_name_index_add(&state->name_index, entry.id, entry.name.c_str());
+        index_entry(state, entry);
+        engine_event_ring_push(&session->events, EngineEvent_TorrentAdded, entry.id, entry.name.c_str(), 0);
+        return entry.id;
+    }
+
+    // Reads whether a torrent is paused wherever it lives, without promoting it.
+    static bool read_paused(EngineSessionState* state, unsigned int id, bool* paused)
+    {
+        const EngineTorrentEntry* entry = find_entry(state, id);
+        if(entry)
+        {
+            *paused = entry->paused;
+            return true;
+        }
+        const EngineColdRecord* record = engine_cold_store_find(state ? &state->cold : nullptr, id);
+        if(record)
+        {
+            *paused = (record->flags & EngineColdFlag_Paused) != 0;
+            return true;
+        }
+        return false;
+    }
+
+    // Pause and resume return false for an unknown torrent and set `changed`
+    // only when the state flips; a no-op leaves a cold torrent cold. Resuming
+    // a complete torrent starts it seeding, which is how a cold torrent comes
+    // back to the hot tier.
+    static bool pause_locked(EngineSession* session, EngineSessionState* state, unsigned int id, bool* changed)
+    {
+        *changed = false;
+        bool paused = false;
+        if(!read_paused(state, id, &paused))
+        {
+            return false;
+        }
+        if(!paused)
+        {
+            EngineTorrentEntry* entry = touch_entry(state, id);
+            untally_entry(state, *entry);
+            entry->paused = true;
+            tally_entry(state, *entry);
+            engine_event_ring_push(&session->events, EngineEvent_TorrentPaused, entry->id, entry->name.c_str(), 0);
+            *changed = true;
+        }
+        return true;
+    }
+
+    static bool resume_locked(EngineSession* session, EngineSessionState* state, unsigned int id, bool* changed)
+    {
+        *changed = false;
+        bool paused = false;
+        if(!read_paused(state, id, &paused))
+        {
+            return false;
+        }
+        if(paused)
+        {
+            EngineTorrentEntry* entry = touch_entry(state, id);
+            untally_entry(state, *entry);
+            entry->paused = false;
+            tally_entry(state, *entry);
+            engine_event_ring_push(&session->events, EngineEvent_TorrentResumed, entry->id, entry->name.c_str(), 0);
+            *changed = true;
+        }
+        return true;
+    }
+
+    static bool remove_locked(EngineSession* session, EngineSessionState* state, unsigned int id)
+    {
+        EngineTorrentEntry* entry = find_entry(state, id);
+        const EngineColdRecord* record = entry ? nullptr : engine_cold_store_find(state ? &state->cold : nullptr, id);
+        if(entry)
+        {
+            engine_name_index_remove(&state->name_index, entry->id, entry->name.c_str());
+            engine_event_ring_push(&session->events, EngineEvent_TorrentRemoved, entry->id, entry->name.c_str(), 0);
+            unindex_entry(state, *entry);
+            untally_entry(state, *entry);
+            state->torrents.erase(state->torrents.begin() + (entry - state->torrents.data()));
+            return true;
+        }
+        if(record)
+        {
+            const char* name = engine_cold_store_string(&state->cold, record->name_offset);
+            engine_name_index_remove(&state->name_index, record->id, name);
+            engine_event_ring_push(&session->events, EngineEvent_TorrentRemoved, record->id, name, 0);
+            for(int i = 0; i < kOrderIndexCount; ++i)
+            {
+                engine_order_index_erase(&state->order_indexes[i], cold_sort_value(*record, kFirstIndexedSortKey + i), record->id);
+            }
+            engine_cold_store_erase(&state->cold, id);
+            forget_shm_cold_row(state, id);
+            return true;
+        }
+        return false;
+    }
+
+    static bool torrent_exists(EngineSessionState* state, unsigned int id)
+    {
+        return find_entry(state, id) || engine_cold_store_find(&state->cold, id);
+    }
+
+    // Reads without promoting, so a query leaves a cold torrent cold.
+    static bool copy_status_by_id(EngineSessionState* state, unsigned int id, EngineTorrentStatus* status)
+    {
+        ZeroMemory(status, sizeof(*status));
+        const EngineTorrentEntry* entry = find_entry(state, id);
+        if(entry)
+        {
+            copy_status(*entry, *status);
+            return true;
+        }
+        const EngineColdRecord* record = engine_cold_store_find(&state->cold, id);
+        if(record)
+        {
+            copy_cold_status(&state->cold, *record, *status);
+            return true;
+        }
+        return false;
+    }
+
+    // Replays the batch's effect on which torrents exist: adds always
+    // succeed, every other command needs a torrent no earlier command in the
+    // batch removed. Marks the failures; returns whether there were none.
+    static bool validate_commands(EngineSessionState* state, EngineCommand* commands, size_t count, std::vector<unsigned int>& removed)
+    {
+        bool valid = true;
+        for(size_t i = 0; i < count; ++i)
+        {
+            EngineCommand& command = commands[i];
+            if(command.type == EngineCommand_Add || (command.type == EngineCommand_Query && command.torrent_id == 0))
+            {
+                continue;
+            }
+            const bool exists = command.torrent_id != 0 && torrent_exists(state, command.torrent_id) &&
+                std::find(removed.begin(), removed.end(), command.torrent_id) == removed.end();
+            if(!exists)
+            {
+                command.result = kEngineCommandNotFound;
+                valid = false;
+            }
+            else if(command.type == EngineCommand_Remove)
+            {
+                removed.push_back(command.torrent_id);
+            }
+        }
+        return valid;
+    }
+
+    // Copies the stats and every torrent, hot and cold merged by ID, into the
+    // shared region whenever the session version has moved. Called on the
+    // engine thread under the state lock, so the seqlock only has to guard
+    // against readers. Hot rows are rebuilt; cold rows are copied in runs
+    // from shm_cold_rows.
+    static void publish_stats_shm(EngineSession* session, EngineSessionState* state, ULONGLONG now)
+    {
+        const unsigned long long version = static_cast<unsigned long long>(session->version);
+        if(state->shm_published && version == state->shm_version)
+        {
+            return;
+        }
+
+        EngineStatsShm* shm = &state->stats_shm;
+        RawBitShmTorrent* rows = engine_stats_shm_begin(shm);
+        if(!rows)
+        {
+            return;
+        }
+
+        EngineSessionStats stats;
+        collect_stats(state, &stats);
+
+        const std::vector<EngineTorrentEntry>& hot = state->torrents;
+        const std::vector<RawBitShmTorrent>& cold = state->shm_cold_rows;
+        unsigned int written = 0;
+        size_t h = 0;
+        size_t c = 0;
+        while(written < shm->capacity && (h < hot.size() || c < cold.size()))
+        {
+            if(c == cold.size() || (h < hot.size() && hot[h].id < cold[c].id))
+            {
+                fill_shm_hot(hot[h++], &rows[written++]);
+                continue;
+            }
+
+            std::vector<RawBitShmTorrent>::const_iterator run_end = cold.end();
+            if(h < hot.size())
+            {
+                run_end = std::lower_bound(cold.begin() + static_cast<std::ptrdiff_t>(c), cold.end(), hot[h].id, shm_row_id_less);
+            }
+            size_t run = static_cast<size_t>(run_end - cold.begin()) - c;
+            if(run > shm->capacity - written)
+            {
+                run = shm->capacity - written;
+            }
+            memcpy(&rows[written], &cold[c], run * sizeof(RawBitShmTorrent));
+            written += static_cast<unsigned int>(run);
+            c += run;
+        }
+
+        RawBitShmHeader header;
+        ZeroMemory(&header, sizeof(header));
+        header.publish_tick_ms = now;
+        header.torrent_count = stats.torrent_count;
+        header.active_count = stats.active_count;
+        header.hot_count = stats.hot_count;
+        header.cold_count = stats.cold_count;
+        header.download_rate = stats.download_rate;
+        header.upload_rate = stats.upload_rate;
+        engine_stats_shm_end(shm, &header, written, written < stats.torrent_count ? 1u : 0u);
+        state->shm_version = version;
+        state->shm_published = true;
+    }
+
     DWORD WINAPI engine_session_thread(LPVOID context)
     {
         EngineSession* session = reinterpret_cast<EngineSession*>(context);
@@ -217,20 +1030,36 @@ namespace
             }
 
             unsigned int torrent_count = 0;
+            unsigned int archived = 0;
+            bool changed = false;
+            const ULONGLONG now = GetTickCount64();
 
             EnterCriticalSection(&session->state_lock);
             EngineSessionState* state = session_state(session);
             if(state)
             {
+                // Only the hot tier is simulated; cold torrents are frozen.
                 torrent_count = static_cast<unsigned int>(state->torrents.size());
                 for(size_t i = 0; i < state->torrents.size(); ++i)
                 {
-                    simulate_progress(state->torrents[i]);
+                    EngineTorrentEntry& entry = state->torrents[i];
+                    const bool was_complete = entry.complete;
+                    changed |= tick_entry(state, entry, now);
+                    if(entry.complete && !was_complete)
+                    {
+                        engine_event_ring_push(&session->events, EngineEvent_TorrentFinished, entry.id, entry.name.c_str(), 0);
+                    }
                 }
+                archived = archive_idle_entries(state, session->config.cold_after_ms, now);
+                if(changed || archived != 0)
+                {
+                    bump_version(session);
+                }
+                publish_stats_shm(session, state, now);
             }
             LeaveCriticalSection(&session->state_lock);
 
-            DebugOut("engine_session: tick (%u torrents)\n", torrent_count);
+            DebugOut("engine_session: tick (%u hot torrents, %u archived)\n", torrent_count, archived);
         }
 
         InterlockedExchange(&session->running, 0);
@@ -245,6 +1074,10 @@ void engine_session_config_default(EngineSessionConfig* config)
         return;
     }
     config->alert_interval_ms = 500;
+    config->cold_after_ms = 10u * 60u * 1000u;
+    config->stats_shm_capacity = 65536;
+    config->stats_shm_name = RAWBIT_SHM_DEFAULT_NAME;
+    config->event_capacity = 4096;
 }
 
 int engine_session_init(EngineSession* session, const EngineSessionConfig* config)
@@ -289,6 +1122,18 @@ int engine_session_init(EngineSession* session, const EngineSessionConfig* confi
         return -3;
     }
 
+    // The export is best effort: a failed mapping only disables it.
+    if(session->config.stats_shm_capacity != 0 &&
+        engine_stats_shm_open(&session_state(session)->stats_shm, session->config.stats_shm_name, session->config.stats_shm_capacity) != 0)
+    {
+        DebugOut("engine_session: stats export disabled.\n");
+    }
+    // So is the event journal.
+    if(session->config.event_capacity != 0 && engine_event_ring_init(&session->events, session->config.event_capacity) != 0)
+    {
+        DebugOut("engine_session: event journal disabled.\n");
+    }
+
     session->running = 1;
     session->thread_handle = CreateThread(nullptr, 0, engine_session_thread, session, 0, nullptr);
     if(!session->thread_handle)
@@ -298,6 +1143,7 @@ int engine_session_init(EngineSession* session, const EngineSessionConfig* confi
         session->running = 0;
         destroy_state(session_state(session));
         session->state = nullptr;
+        engine_event_ring_destroy(&session->events);
         DeleteCriticalSection(&session->state_lock);
         session->state_lock_initialized = 0;
         return -4;
@@ -337,10 +1183,13 @@ void engine_session_shutdown(EngineSession* session)
         EnterCriticalSection(&session->state_lock);
         destroy_state(session_state(session));
         session->state = nullptr;
+        session->on_change = nullptr;
+        session->on_change_context = nullptr;
         LeaveCriticalSection(&session->state_lock);
         DeleteCriticalSection(&session->state_lock);
         session->state_lock_initialized = 0;
     }
+    engine_event_ring_destroy(&session->events);
 
     session->running = 0;
     DebugOut("engine_session: stopped.\n");
@@ -354,21 +1203,7 @@ int engine_session_add_torrent(EngineSession* session, const EngineAddTorrentOpt
     }
 
     EngineTorrentEntry entry;
-    entry.id = 0;
-    entry.name = determine_display_name(options);
-    clamp_string(entry.name, 120);
-    if(options->magnet_uri && options->magnet_uri[0] != '\0')
-    {
-        entry.magnet_uri = options->magnet_uri;
-        clamp_string(entry.magnet_uri, 200);
-    }
-    entry.size_bytes = determine_size_bytes(options);
-    entry.downloaded_bytes = 0;
-    entry.download_rate = 0;
-    entry.upload_rate = 0;
-    entry.progress = 0.0f;
-    entry.paused = false;
-    entry.complete = false;
+    make_entry(options, entry);
 
     int result = -2;
 
@@ -376,12 +1211,12 @@ int engine_session_add_torrent(EngineSession* session, const EngineAddTorrentOpt
     EngineSessionState* state = session_state(session);
     if(state)
     {
-        entry.id = state->next_torrent_id++;
-        state->torrents.push_back(entry);
+        const unsigned int torrent_id = add_locked(session, state, entry);
         if(out_torrent_id)
         {
-            *out_torrent_id = entry.id;
+            *out_torrent_id = torrent_id;
         }
+        bump_version(session);
         result = 0;
     }
     LeaveCriticalSection(&session->state_lock);
@@ -397,12 +1232,14 @@ int engine_session_pause_torrent(EngineSession* session, unsigned int torrent_id
     }
 
     int result = -2;
+    bool changed = false;
     EnterCriticalSection(&session->state_lock);
-    EngineSessionState* state = session_state(session);
-    EngineTorrentEntry* entry = find_entry(state, torrent_id);
-    if(entry)
+    if(pause_locked(session, session_state(session), torrent_id, &changed))
     {
-        entry->paused = true;
+        if(changed)
+        {
+            bump_version(session);
+        }
         result = 0;
     }
     LeaveCriticalSection(&session->state_lock);
@@ -417,14 +1254,13 @@ int engine_session_resume_torrent(EngineSession* session, unsigned int torrent_i
     }
 
     int result = -2;
+    bool changed = false;
     EnterCriticalSection(&session->state_lock);
-    EngineSessionState* state = session_state(session);
-    EngineTorrentEntry* entry = find_entry(state, torrent_id);
-    if(entry)
+    if(resume_locked(session, session_state(session), torrent_id, &changed))
     {
-        if(!entry->complete)
+        if(changed)
         {
-            entry->paused = false;
+            bump_version(session);
         }
         result = 0;
     }
@@ -439,19 +1275,104 @@ int engine_session_remove_torrent(EngineSession* session, unsigned int torrent_i
         return -1;
     }
 
+    int result = -2;
+    EnterCriticalSection(&session->state_lock);
+    if(remove_locked(session, session_state(session), torrent_id))
+    {
+        bump_version(session);
+        result = 0;
+    }
+    LeaveCriticalSection(&session->state_lock);
+
+    return result;
+}
+
+int engine_session_run_commands(EngineSession* session, EngineCommand* commands, size_t count, bool all_or_nothing)
+{
+    if(!session || (!commands && count != 0))
+    {
+        return -1;
+    }
+
+    // Entries for the adds are built up front, like a single add, so the
+    // lock is held only for the inserts.
+    std::vector<EngineTorrentEntry> entries;
+    std::vector<unsigned int> removed;
+    size_t add_count = 0;
+    for(size_t i = 0; i < count; ++i)
+    {
+        commands[i].result = kEngineCommandNotRun;
+        add_count += commands[i].type == EngineCommand_Add ? 1 : 0;
+    }
+    entries.resize(add_count);
+    for(size_t i = 0, next = 0; i < count; ++i)
+    {
+        if(commands[i].type == EngineCommand_Add)
+        {
+            make_entry(&commands[i].add, entries[next++]);
+        }
+    }
+    if(all_or_nothing)
+    {
+        removed.reserve(count);
+    }
+
     int result = -2;
     EnterCriticalSection(&session->state_lock);
     EngineSessionState* state = session_state(session);
     if(state)
     {
-        const size_t original = state->torrents.size();
-        state->torrents.erase(
-            std::remove_if(state->torrents.begin(), state->torrents.end(),
-                [torrent_id](const EngineTorrentEntry& entry) { return entry.id == torrent_id; }),
-            state->torrents.end());
-        if(state->torrents.size() != original)
+        result = 0;
+        if(all_or_nothing && !validate_commands(state, commands, count, removed))
         {
-            result = 0;
+            result = -3;
+        }
+    }
+    if(result == 0)
+    {
+        bool changed = false;
+        size_t next_entry = 0;
+        for(size_t i = 0; i < count; ++i)
+        {
+            EngineCommand& command = commands[i];
+            bool applied = false;
+            bool flipped = false;
+            switch(command.type)
+            {
+                case EngineCommand_Add:
+                    command.torrent_id = add_locked(session, state, entries[next_entry++]);
+                    applied = flipped = true;
+                    break;
+                case EngineCommand_Pause:
+                    applied = pause_locked(session, state, command.torrent_id, &flipped);
+                    break;
+                case EngineCommand_Resume:
+                    applied = resume_locked(session, state, command.torrent_id, &flipped);
+                    break;
+                case EngineCommand_Remove:
+                    applied = flipped = remove_locked(session, state, command.torrent_id);
+                    break;
+                case EngineCommand_Query:
+                    if(command.torrent_id == 0)
+                    {
+                        collect_stats(state, &command.stats);
+                        command.result = kEngineCommandOk;
+                    }
+                    else
+                    {
+                        command.result = copy_status_by_id(state, command.torrent_id, &command.status) ? kEngineCommandOk : kEngineCommandNotFound;
+                    }
+                    continue;
+                default:
+                    break;
+            }
+            command.result = applied ? kEngineCommandOk : kEngineCommandNotFound;
+            changed = changed || flipped;
+        }
+        // One version step for the batch: no snapshot sees part of it.
+        if(changed)
+        {
+            bump_version(session);
         }
     }
     LeaveCriticalSection(&session->state_lock);
@@ -467,38 +1388,277 @@ void engine_session_snapshot(EngineSession* session, EngineSessionSnapshot* snap
     }
 
     snapshot->torrents.clear();
-    snapshot->stats.torrent_count = 0;
-    snapshot->stats.active_count = 0;
-    snapshot->stats.download_rate = 0;
-    snapshot->stats.upload_rate = 0;
+    reset_stats(&snapshot->stats);
+    snapshot->version = 0;
 
     EnterCriticalSection(&session->state_lock);
     EngineSessionState* state = session_state(session);
     if(state)
     {
-        snapshot->torrents.reserve(state->torrents.size());
-        for(size_t i = 0; i < state->torrents.size(); ++i)
+        snapshot->version = engine_session_version(session);
+        const std::vector<EngineTorrentEntry>& hot = state->torrents;
+        const std::vector<EngineColdRecord>& cold = state->cold.records;
+        snapshot->torrents.reserve(hot.size() + engine_cold_store_live_count(&state->cold));
+
+        // Both tiers are ID-ordered; merge them so clients see one list.
+        size_t h = 0;
+        size_t c = 0;
+        while(h < hot.size() || c < cold.size())
         {
-            EngineTorrentStatus status;
-            ZeroMemory(&status, sizeof(status));
-            copy_status(state->torrents[i], status);
-            snapshot->torrents.push_back(status);
+            if(c < cold.size() && (cold[c].flags & EngineColdFlag_Removed))
+            {
+                ++c;
+                continue;
+            }
+            if(c == cold.size() || (h < hot.size() && hot[h].id < cold[c].id))
+            {
+                push_hot_status(hot[h], snapshot);
+                ++h;
+            }
+            else
+            {
+                push_cold_status(&state->cold, cold[c], snapshot);
+                ++c;
+            }
         }
+        collect_stats(state, &snapshot->stats);
     }
     LeaveCriticalSection(&session->state_lock);
+}
 
-    snapshot->stats.torrent_count = static_cast<unsigned int>(snapshot->torrents.size());
-    snapshot->stats.active_count = 0;
-    snapshot->stats.download_rate = 0;
-    snapshot->stats.upload_rate = 0;
-    for(size_t i = 0; i < snapshot->torrents.size(); ++i)
+void engine_session_snapshot_page(EngineSession* session, const EngineTorrentQuery* query, EngineSessionSnapshot* snapshot, unsigned int* out_total)
+{
+    if(out_total)
+    {
+        *out_total = 0;
+    }
+    if(!session || !query || !snapshot)
     {
-        const EngineTorrentStatus& status = snapshot->torrents[i];
-        if(status.is_complete == 0 && status.is_paused == 0)
+        return;
+    }
+
+    snapshot->torrents.clear();
+    reset_stats(&snapshot->stats);
+    snapshot->version = 0;
+
+    const bool descending = query->descending != 0;
+    std::vector<unsigned int> page_ids;
+    std::vector<EngineNameRef> by_name;
+
+    EnterCriticalSection(&session->state_lock);
+    EngineSessionState* state = session_state(session);
+    if(state)
+    {
+        snapshot->version = engine_session_version(session);
+        collect_stats(state, &snapshot->stats);
+
+        const size_t total = snapshot->stats.torrent_count;
+        const bool keyset = query->after_id != 0 && query->sort_key == EngineSortKey_Id && !descending;
+        const size_t offset = keyset ? 0 : (query->offset < total ? query->offset : total);
+        size_t count = total - offset;
+        if(query->limit != 0 && query->limit < count)
+        {
+            count = query->limit;
+        }
+        snapshot->torrents.reserve(count);
+
+        if(keyset)
+        {
+            push_id_after_page(state, query->after_id, count, snapshot);
+        }
+        else if(query->sort_key >= kFirstIndexedSortKey && query->sort_key < EngineSortKey_Count)
+        {
+            const EngineOrderIndex* index = &state->order_indexes[query->sort_key - kFirstIndexedSortKey];
+            page_ids.reserve(count);
+            engine_order_index_page(index, static_cast<unsigned int>(offset), static_cast<unsigned int>(count), descending, page_ids);
+            for(size_t i = 0; i < page_ids.size(); ++i)
+            {
+                push_status_by_id(state, page_ids[i], snapshot);
+            }
+        }
+        else if(query->sort_key == EngineSortKey_Name)
+        {
+            // Names rarely change and are never hot sort keys; a partial sort
+            // of name references is cheaper than maintaining another index.
+            by_name.reserve(total);
+            for(size_t i = 0; i < state->torrents.size(); ++i)
+            {
+                EngineNameRef ref;
+                ref.name = state->torrents[i].name.c_str();
+                ref.id = state->torrents[i].id;
+                by_name.push_back(ref);
+            }
+            for(size_t i = 0; i < state->cold.records.size(); ++i)
+            {
+                const EngineColdRecord& record = state->cold.records[i];
+                if(record.flags & EngineColdFlag_Removed)
+                {
+                    continue;
+                }
+                EngineNameRef ref;
+                ref.name = engine_cold_store_string(&state->cold, record.name_offset);
+                ref.id = record.id;
+                by_name.push_back(ref);
+            }
+            const size_t end = offset + count;
+            std::partial_sort(by_name.begin(), by_name.begin() + end, by_name.end(),
+                descending ? name_ref_greater : name_ref_less);
+            for(size_t i = offset; i < end; ++i)
+            {
+                push_status_by_id(state, by_name[i].id, snapshot);
+            }
+        }
+        else
+        {
+            push_id_order_page(state, offset, count, descending, snapshot);
+        }
+
+        if(out_total)
         {
-            snapshot->stats.active_count++;
+            *out_total = static_cast<unsigned int>(total);
         }
-        snapshot->stats.download_rate += status.download_rate;
-        snapshot->stats.upload_rate += status.upload_rate;
     }
+    LeaveCriticalSection(&session->state_lock);
+}
+
+unsigned long long engine_session_version(EngineSession* session)
+{
+    if(!session)
+    {
+        return 0;
+    }
+    return static_cast<unsigned long long>(InterlockedCompareExchange64(&session->version, 0, 0));
+}
+
+unsigned long long engine_session_event_head(EngineSession* session)
+{
+    return session ? engine_event_ring_head(&session->events) : 0;
+}
+
+unsigned int engine_session_read_events(EngineSession* session, unsigned long long since, EngineEvent* events,
+    unsigned int max_events, unsigned long long* out_next, bool* out_gap)
+{
+    if(!session || !events)
+    {
+        if(out_next)
+        {
+            *out_next = since;
+        }
+        if(out_gap)
+        {
+            *out_gap = false;
+        }
+        return 0;
+    }
+    return engine_event_ring_read(&session->events, since, events, max_events, out_next, out_gap);
+}
+
+void engine_session_set_change_callback(EngineSession* session, EngineChangeCallback callback, void* context)
+{
+    if(!session || !session->state_lock_initialized)
+    {
+        return;
+    }
+
+    EnterCriticalSection(&session->state_lock);
+    session->on_change = callback;
+    session->on_change_context = context;
+    LeaveCriticalSection(&session->state_lock);
+}
+
+unsigned int engine_session_search(EngineSession* session, const char* query, EngineSearchHit* hits, unsigned int max_hits, unsigned int* out_total)
+{
+    if(out_total)
+    {
+        *out_total = 0;
+    }
+    if(!session || !query || !hits || max_hits == 0)
+    {
+        return 0;
+    }
+
+    char folded[kEngineSearchMaxQuery + 1];
+    size_t query_len = 0;
+    while(query[query_len] && query_len < kEngineSearchMaxQuery)
+    {
+        folded[query_len] = engine_name_fold(query[query_len]);
+        ++query_len;
+    }
+    folded[query_len] = '\0';
+    // Searching a prefix would answer a different query than was asked.
+    if(query_len == 0 || query[query_len] != '\0')
+    {
+        return 0;
+    }
+
+    std::vector<EngineSearchHit> ranked;
+    std::vector<EngineNameMatch> matches;
+
+    EnterCriticalSection(&session->state_lock);
+    EngineSessionState* state = session_state(session);
+    if(state)
+    {
+        const unsigned int total_trigrams = engine_name_index_query(&state->name_index, folded, kSearchFuzzyPercent, matches);
+        if(total_trigrams == 0)
+        {
+            // One- and two-byte queries carry no trigram; substring-scan names instead.
+            for(size_t i = 0; i < state->torrents.size(); ++i)
+            {
+                const unsigned int score = score_name(state->torrents[i].name.c_str(), folded, query_len);
+                if(score != 0)
+                {
+                    EngineSearchHit hit;
+                    hit.id = state->torrents[i].id;
+                    hit.score = score;
+                    ranked.push_back(hit);
+                }
+            }
+            for(size_t i = 0; i < state->cold.records.size(); ++i)
+            {
+                const EngineColdRecord& record = state->cold.records[i];
+                if(record.flags & EngineColdFlag_Removed)
+                {
+                    continue;
+                }
+                const unsigned int score = score_name(engine_cold_store_string(&state->cold, record.name_offset), folded, query_len);
+                if(score != 0)
+                {
+                    EngineSearchHit hit;
+                    hit.id = record.id;
+                    hit.score = score;
+                    ranked.push_back(hit);
+                }
+            }
+        }
+        else
+        {
+            ranked.reserve(matches.size());
+            for(size_t i = 0; i < matches.size(); ++i)
+            {
+                const char* name = lookup_name(state, matches[i].id);
+                if(!name)
+                {
+                    continue;
+                }
+                EngineSearchHit hit;
+                hit.id = matches[i].id;
+                hit.score = score_name(name, folded, query_len) +
+                    (matches[i].matched_trigrams * kSearchTrigramScore) / total_trigrams;
+                ranked.push_back(hit);
+            }
+        }
+    }
+    LeaveCriticalSection(&session->state_lock);
+
+    const size_t count = ranked.size() < max_hits ? ranked.size() : max_hits;
+    std::partial_sort(ranked.begin(), ranked.begin() + count, ranked.end(), search_hit_better);
+    for(size_t i = 0; i < count; ++i)
+    {
+        hits[i] = ranked[i];
+    }
+    if(out_total)
+    {
+        *out_total = static_cast<unsigned int>(ranked.size());
+    }
+    return static_cast<unsigned int>(count);
 }
@@ -5,9 +5,18 @@
 
 #include <vector>
 
+#include "engine/engine_event_ring.h"
+
 struct EngineSessionConfig
 {
     unsigned int alert_interval_ms;
+    // Complete, paused torrents untouched this long move to the cold tier (0 = never).
+    unsigned int cold_after_ms;
+    // Rows in the shared-memory stats export (0 = no export). See rawbit_stats_shm.h.
+    unsigned int stats_shm_capacity;
+    const wchar_t* stats_shm_name;
+    // Events kept for replay (0 = no event journal). See engine_event_ring.h.
+    unsigned int event_capacity;
 };
 
 struct EngineSessionStats
@@ -16,6 +25,10 @@ struct EngineSessionStats
     unsigned int active_count;
     unsigned long long download_rate;
     unsigned long long upload_rate;
+    unsigned int hot_count;
+    unsigned int cold_count;
+    unsigned long long hot_bytes;
+    unsigned long long cold_bytes;
 };
 
 struct EngineTorrentStatus
@@ -34,10 +47,42 @@ struct EngineTorrentStatus
 
 struct EngineSessionSnapshot
 {
+    // engine_session_version() at the time the snapshot was taken.
+    unsigned long long version;
     EngineSessionStats stats;
     std::vector<EngineTorrentStatus> torrents;
 };
 
+enum EngineSortKey
+{
+    EngineSortKey_Id = 0,
+    EngineSortKey_Name = 1,
+    EngineSortKey_Size = 2,
+    EngineSortKey_Progress = 3,
+    EngineSortKey_DownloadRate = 4,
+    EngineSortKey_UploadRate = 5,
+    EngineSortKey_Count = 6
+};
+
+struct EngineTorrentQuery
+{
+    EngineSortKey sort_key;
+    int descending;
+    unsigned int offset;
+    unsigned int limit;
+    // Keyset cursor for ascending ID order: when nonzero, the page starts
+    // at the first torrent whose ID is above it and `offset` is ignored.
+    unsigned int after_id;
+};
+
+const size_t kEngineSearchMaxQuery = 127;
+
+struct EngineSearchHit
+{
+    unsigned int id;
+    unsigned int score;
+};
+
 struct EngineAddTorrentOptions
 {
     const char* magnet_uri;
@@ -46,6 +91,42 @@ struct EngineAddTorrentOptions
     unsigned long long size_bytes;
 };
 
+enum EngineCommandType
+{
+    EngineCommand_Add = 0,
+    EngineCommand_Pause,
+    EngineCommand_Resume,
+    EngineCommand_Remove,
+    EngineCommand_Query,
+    EngineCommand_Count
+};
+
+// EngineCommand::result values.
+const int kEngineCommandOk = 0;
+const int kEngineCommandNotFound = -2;
+// Not attempted: the engine is down, or an all-or-nothing batch was
+// rejected because of another command.
+const int kEngineCommandNotRun = -3;
+
+// One step of engine_session_run_commands(): `type`, `torrent_id` and, for
+// adds, `add` are inputs; the rest is output.
+struct EngineCommand
+{
+    EngineCommandType type;
+    // Target of pause, resume, remove and query; an add stores the new ID.
+    // A query without one reads the session totals into `stats`.
+    unsigned int torrent_id;
+    EngineAddTorrentOptions add;
+    int result;
+    EngineTorrentStatus status;
+    EngineSessionStats stats;
+};
+
+// Called on every version bump, with the session's state lock held and from
+// whichever thread made the change. Must not block or call back into the
+// session.
+typedef void (*EngineChangeCallback)(void* context);
+
 struct EngineSession
 {
     EngineSessionConfig config;
@@ -55,6 +136,12 @@ struct EngineSession
     CRITICAL_SECTION state_lock;
     int state_lock_initialized;
     void* state;
+    // Bumped on every change a client could observe.
+    volatile LONGLONG version;
+    EngineChangeCallback on_change;
+    void* on_change_context;
+    // Written under state_lock, read without it.
+    EngineEventRing events;
 };
 
 void engine_session_config_default(EngineSessionConfig* config);
@@ -64,4 +151,28 @@ int engine_session_add_torrent(EngineSession* session, const EngineAddTorrentOpt
 int engine_session_pause_torrent(EngineSession* session, unsigned int torrent_id);
 int engine_session_resume_torrent(EngineSession* session, unsigned int torrent_id);
 int engine_session_remove_torrent(EngineSession* session, unsigned int torrent_id);
+// Runs the commands in order under one hold of the state lock, so the whole
+// batch is one version step and no snapshot sees part of it. Each command
+// gets its own result. With `all_or_nothing`, the batch is first checked
+// against the torrents that exist and is rejected with -3, changing
+// nothing, if any command would fail.
+int engine_session_run_commands(EngineSession* session, EngineCommand* commands, size_t count, bool all_or_nothing);
 void engine_session_snapshot(EngineSession* session, EngineSessionSnapshot* snapshot);
+// Fills global stats plus one page of torrents in the requested order. Size,
+// progress and rate orders come from engine-maintained indexes and stats
+// from running totals; `limit` 0 means "to the end". `out_total` receives
+// the full torrent count. A page taken by `after_id` costs a bisection per
+// tier plus its rows.
+void engine_session_snapshot_page(EngineSession* session, const EngineTorrentQuery* query, EngineSessionSnapshot* snapshot, unsigned int* out_total);
+// Cheap, lock-free change counter: equal versions mean identical snapshots.
+unsigned long long engine_session_version(EngineSession* session);
+// Installs (or with nullptr removes) the change callback. Once removal
+// returns, the old callback is not running and will not be called again.
+void engine_session_set_change_callback(EngineSession* session, EngineChangeCallback callback, void* context);
+// Sequence of the newest event; lock-free, like engine_session_version().
+unsigned long long engine_session_event_head(EngineSession* session);
+// Lock-free; see engine_event_ring_read().
+unsigned int engine_session_read_events(EngineSession* session, unsigned long long since, EngineEvent* events,
+    unsigned int max_events, unsigned long long* out_next, bool* out_gap);
+// Queries longer than kEngineSearchMaxQuery characters are not searched.
+unsigned int engine_session_search(EngineSession* session, const char* query, EngineSearchHit* hits, unsigned int max_hits, unsigned int* out_total);
@@ -0,0 +1,120 @@
+#include "engine/engine_stats_shm.h"
+
+#include <sddl.h>
+
+#include "debug.h"
+
+namespace
+{
+    // The engine's user and SYSTEM only, whatever the session's default DACL
+    // would grant.
+    const wchar_t kStatsShmSddl[] = L"D:P(A;;GA;;;OW)(A;;GA;;;SY)";
+}
+
+int engine_stats_shm_open(EngineStatsShm* shm, const wchar_t* name, unsigned int capacity)
+{
+    if(!shm || capacity == 0)
+    {
+        return -1;
+    }
+
+    ZeroMemory(shm, sizeof(*shm));
+
+    SECURITY_ATTRIBUTES attributes;
+    ZeroMemory(&attributes, sizeof(attributes));
+    attributes.nLength = sizeof(attributes);
+    if(!ConvertStringSecurityDescriptorToSecurityDescriptorW(kStatsShmSddl, SDDL_REVISION_1, &attributes.lpSecurityDescriptor, nullptr))
+    {
+        return -2;
+    }
+
+    const unsigned long long bytes = sizeof(RawBitShmHeader) + static_cast<unsigned long long>(capacity) * sizeof(RawBitShmTorrent);
+    shm->mapping = CreateFileMappingW(INVALID_HANDLE_VALUE, &attributes, PAGE_READWRITE,
+        static_cast<DWORD>(bytes >> 32), static_cast<DWORD>(bytes & 0xFFFFFFFFull), name ? name : RAWBIT_SHM_DEFAULT_NAME);
+    const DWORD error = GetLastError();
+    LocalFree(attributes.lpSecurityDescriptor);
+    if(!shm->mapping)
+    {
+        DebugOut("engine_stats_shm: CreateFileMapping failed (%lu).\n", error);
+        return -2;
+    }
+    // Another rawBit, or something squatting on the name, owns the region:
+    // its size and contents are not ours to trust or overwrite.
+    if(error == ERROR_ALREADY_EXISTS)
+    {
+        DebugOut("engine_stats_shm: %ls already exists.\n", name ? name : RAWBIT_SHM_DEFAULT_NAME);
+        CloseHandle(shm->mapping);
+        shm->mapping = nullptr;
+        return -4;
+    }
+
+    void* view = MapViewOfFile(shm->mapping, FILE_MAP_ALL_ACCESS, 0, 0, static_cast<SIZE_T>(bytes));
+    if(!view)
+    {
+        CloseHandle(shm->mapping);
+        shm->mapping = nullptr;
+        return -3;
+    }
+
+    shm->header = reinterpret_cast<RawBitShmHeader*>(view);
+    shm->records = reinterpret_cast<RawBitShmTorrent*>(reinterpret_cast<char*>(view) + sizeof(RawBitShmHeader));
+    shm->capacity = capacity;
+
+    ZeroMemory(shm->header, sizeof(*shm->header));
+    shm->header->header_size = sizeof(RawBitShmHeader);
+    shm->header->record_size = sizeof(RawBitShmTorrent);
+    shm->header->capacity = capacity;
+    shm->header->version = RAWBIT_SHM_VERSION;
+    MemoryBarrier();
+    shm->header->magic = RAWBIT_SHM_MAGIC;
+    return 0;
+}
+
+void engine_stats_shm_close(EngineStatsShm* shm)
+{
+    if(!shm)
+    {
+        return;
+    }
+    if(shm->header)
+    {
+        UnmapViewOfFile(shm->header);
+    }
+    if(shm->mapping)
+    {
+        CloseHandle(shm->mapping);
+    }
+    ZeroMemory(shm, sizeof(*shm));
+}
+
+RawBitShmTorrent* engine_stats_shm_begin(EngineStatsShm* shm)
+{
+    if(!shm || !shm->header)
+    {
+        return nullptr;
+    }
+    // Odd sequence tells readers to retry; Interlocked* is a full barrier.
+    InterlockedIncrement(&shm->header->sequence);
+    return shm->records;
+}
+
+void engine_stats_shm_end(EngineStatsShm* shm, const RawBitShmHeader* stats, unsigned int record_count, unsigned int truncated)
+{
+    if(!shm || !shm->header || !stats)
+    {
+        return;
+    }
+
+    RawBitShmHeader* header = shm->header;
+    header->publish_count++;
+    header->publish_tick_ms = stats->publish_tick_ms;
+    header->torrent_count = stats->torrent_count;
+    header->active_count = stats->active_count;
+    header->hot_count = stats->hot_count;
+    header->cold_count = stats->cold_count;
+    header->download_rate = stats->download_rate;
+    header->upload_rate = stats->upload_rate;
+    header->record_count = record_count;
+    header->truncated = truncated;
+    InterlockedIncrement(&header->sequence);
+}
@@ -0,0 +1,25 @@
+#pragma once
+
+#include <windows.h>
+#include <stdint.h>
+
+#include "engine/rawbit_stats_shm.h"
+
+// Writer side of the shared-memory stats export (see rawbit_stats_shm.h).
+struct EngineStatsShm
+{
+    HANDLE mapping;
+    RawBitShmHeader* header;
+    RawBitShmTorrent* records;
+    unsigned int capacity;
+};
+
+// Creates the named region. Fails if the name already exists, so a second
+// instance leaves the first one's export alone.
+int engine_stats_shm_open(EngineStatsShm* shm, const wchar_t* name, unsigned int capacity);
+void engine_stats_shm_close(EngineStatsShm* shm);
+
+// Bracket one publish. Rows written between begin and end must stay below
+// `capacity`; end stores the header stats and releases the seqlock.
+RawBitShmTorrent* engine_stats_shm_begin(EngineStatsShm* shm);
+void engine_stats_shm_end(EngineStatsShm* shm, const RawBitShmHeader* stats, unsigned int record_count, unsigned int truncated);
@@ -0,0 +1,183 @@
+#pragma once
+
+// Shared-memory layout of the engine stats export plus a header-only reader.
+// The engine republishes the region on the first tick after its state
+// changes, so `publish_count` stands still while the session is idle;
+// readers copy it out under a seqlock and never block the writer. This
+// header has no dependency on the rest of rawBit so monitoring tools can
+// include it on its own.
+
+#include <windows.h>
+#include <stdint.h>
+#include <string.h>
+
+#define RAWBIT_SHM_DEFAULT_NAME L"Local\\rawBit.stats"
+#define RAWBIT_SHM_MAGIC 0x54425752u
+#define RAWBIT_SHM_VERSION 1u
+
+enum RawBitShmTorrentFlags
+{
+    RawBitShmTorrent_Paused = 1 << 0,
+    RawBitShmTorrent_Complete = 1 << 1,
+    RawBitShmTorrent_Cold = 1 << 2
+};
+
+struct RawBitShmTorrent
+{
+    uint32_t id;
+    uint32_t flags;
+    float progress;
+    uint32_t download_rate;
+    uint32_t upload_rate;
+    uint32_t reserved;
+    uint64_t size_bytes;
+    uint64_t downloaded_bytes;
+};
+
+struct RawBitShmHeader
+{
+    uint32_t magic;
+    uint32_t version;
+    uint32_t header_size;
+    uint32_t record_size;
+    uint32_t capacity;
+    // Odd while the engine is writing; bumped twice per publish.
+    volatile LONG sequence;
+    uint64_t publish_count;
+    uint64_t publish_tick_ms;
+    uint32_t torrent_count;
+    uint32_t active_count;
+    uint32_t hot_count;
+    uint32_t cold_count;
+    uint64_t download_rate;
+    uint64_t upload_rate;
+    uint32_t record_count;
+    uint32_t truncated;
+};
+
+struct RawBitShmReader
+{
+    HANDLE mapping;
+    const RawBitShmHeader* header;
+    // Bytes mapped at `header`; rows are never read past it.
+    size_t view_size;
+};
+
+// True when `header` uses this file's header and row sizes and its
+// `capacity` rows fit in a view of `view_size` bytes. The writer sets these
+// fields once, before the first publish.
+static inline int rawbit_shm_layout_ok(const RawBitShmHeader* header, size_t view_size)
+{
+    if(view_size < sizeof(RawBitShmHeader) || header->header_size != sizeof(RawBitShmHeader) ||
+        header->record_size != sizeof(RawBitShmTorrent))
+    {
+        return 0;
+    }
+    return header->capacity <= (view_size - sizeof(RawBitShmHeader)) / sizeof(RawBitShmTorrent);
+}
+
+static inline int rawbit_shm_open(RawBitShmReader* reader, const wchar_t* name)
+{
+    if(!reader)
+    {
+        return -1;
+    }
+    reader->view_size = 0;
+    reader->mapping = OpenFileMappingW(FILE_MAP_READ, FALSE, name ? name : RAWBIT_SHM_DEFAULT_NAME);
+    if(!reader->mapping)
+    {
+        reader->header = NULL;
+        return -2;
+    }
+    reader->header = (const RawBitShmHeader*)MapViewOfFile(reader->mapping, FILE_MAP_READ, 0, 0, 0);
+    MEMORY_BASIC_INFORMATION view;
+    if(reader->header && VirtualQuery(reader->header, &view, sizeof(view)) == sizeof(view))
+    {
+        reader->view_size = view.RegionSize;
+    }
+    if(!reader->header || reader->view_size < sizeof(RawBitShmHeader) || reader->header->magic != RAWBIT_SHM_MAGIC ||
+        reader->header->version != RAWBIT_SHM_VERSION || !rawbit_shm_layout_ok(reader->header, reader->view_size))
+    {
+        if(reader->header)
+        {
+            UnmapViewOfFile(reader->header);
+            reader->header = NULL;
+        }
+        CloseHandle(reader->mapping);
+        reader->mapping = NULL;
+        reader->view_size = 0;
+        return -3;
+    }
+    return 0;
+}
+
+static inline void rawbit_shm_close(RawBitShmReader* reader)
+{
+    if(!reader)
+    {
+        return;
+    }
+    if(reader->header)
+    {
+        UnmapViewOfFile(reader->header);
+        reader->header = NULL;
+    }
+    if(reader->mapping)
+    {
+        CloseHandle(reader->mapping);
+        reader->mapping = NULL;
+    }
+    reader->view_size = 0;
+}
+
+// Copies a consistent header and up to `max_records` torrent rows. Returns the
+// number of rows copied, -1 if the writer kept the region busy for
+// `max_attempts` tries, or -2 if the header's sizes do not match this file
+// or its rows would run past the mapped view.
+static inline int rawbit_shm_read(const RawBitShmReader* reader, RawBitShmHeader* out_header,
+    RawBitShmTorrent* out_records, uint32_t max_records, unsigned int max_attempts)
+{
+    if(!reader || !reader->header || !out_header)
+    {
+        return -1;
+    }
+
+    const RawBitShmHeader* shared = reader->header;
+    const RawBitShmTorrent* records = (const RawBitShmTorrent*)(shared + 1);
+    for(unsigned int attempt = 0; attempt < max_attempts; ++attempt)
+    {
+        const LONG before = shared->sequence;
+        if(before & 1)
+        {
+            YieldProcessor();
+            continue;
+        }
+        MemoryBarrier();
+
+        memcpy(out_header, (const void*)shared, sizeof(*out_header));
+        if(!rawbit_shm_layout_ok(out_header, reader->view_size))
+        {
+            return -2;
+        }
+        uint32_t count = out_header->record_count;
+        if(count > out_header->capacity)
+        {
+            count = out_header->capacity;
+        }
+        if(count > max_records)
+        {
+            count = max_records;
+        }
+        if(out_records && count != 0)
+        {
+            memcpy(out_records, records, count * sizeof(RawBitShmTorrent));
+        }
+
+        MemoryBarrier();
+        if(shared->sequence == before)
+        {
+            return (int)count;
+        }
+    }
+    return -1;
+}
@@ -0,0 +1,558 @@
+#include "net/deflate.h"
+
+#include <algorithm>
+#include <vector>
+
+#include <string.h>
+
+namespace
+{
+    const unsigned int kHashBits = 15;
+    const size_t kWindowSize = 32768;
+    // Matches are found by hashing four bytes, so shorter ones are missed.
+    const size_t kMinMatch = 4;
+    const size_t kMaxMatch = 258;
+    const unsigned int kEndOfBlock = 256;
+
+    const unsigned short kLengthBase[29] = {
+        3, 4, 5, 6, 7, 8, 9, 10, 11, 13, 15, 17, 19, 23, 27, 31,
+        35, 43, 51, 59, 67, 83, 99, 115, 131, 163, 195, 227, 258 };
+    const unsigned char kLengthExtra[29] = {
+        0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2,
+        3, 3, 3, 3, 4, 4, 4, 4, 5, 5, 5, 5, 0 };
+    const unsigned short kDistanceBase[30] = {
+        1, 2, 3, 4, 5, 7, 9, 13, 17, 25, 33, 49, 65, 97, 129, 193,
+        257, 385, 513, 769, 1025, 1537, 2049, 3073, 4097, 6145, 8193, 12289, 16385, 24577 };
+    const unsigned char kDistanceExtra[30] = {
+        0, 0, 0, 0, 1, 1, 2, 2, 3, 3, 4, 4, 5, 5, 6, 6,
+        7, 7, 8, 8, 9, 9, 10, 10, 11, 11, 12, 12, 13, 13 };
+    const unsigned char kCodeLengthOrder[19] = {
+        16, 17, 18, 0, 8, 7, 9, 6, 10, 5, 11, 4, 12, 3, 13, 2, 14, 1, 15 };
+
+    static unsigned int reverse_bits(unsigned int code, unsigned int length)
+    {
+        unsigned int result = 0;
+        for(unsigned int i = 0; i < length; ++i)
+        {
+            result = (result << 1) | (code & 1u);
+            code >>= 1;
+        }
+        return result;
+    }
+
+    // Fixed-code tables (RFC 1951 3.2.6), pre-reversed for LSB-first output.
+    struct FixedCodes
+    {
+        unsigned short literal_code[288];
+        unsigned char literal_length[288];
+        unsigned char distance_code[30];
+        unsigned char length_symbol[kMaxMatch + 1];
+        unsigned int crc_table[256];
+
+        FixedCodes()
+        {
+            for(unsigned int symbol = 0; symbol < 288; ++symbol)
+            {
+                unsigned int code;
+                unsigned int length;
+                if(symbol < 144)
+                {
+                    code = 0x30 + symbol;
+                    length = 8;
+                }
+                else if(symbol < 256)
+                {
+                    code = 0x190 + symbol - 144;
+                    length = 9;
+                }
+                else if(symbol < 280)
+                {
+                    code = symbol - 256;
+                    length = 7;
+                }
+                else
+                {
+                    code = 0xC0 + symbol - 280;
+                    length = 8;
+                }
+                literal_code[symbol] = static_cast<unsigned short>(reverse_bits(code, length));
+                literal_length[symbol] = static_cast<unsigned char>(length);
+            }
+            for(unsigned int symbol = 0; symbol < 30; ++symbol)
+            {
+                distance_code[symbol] = static_cast<unsigned char>(reverse_bits(symbol, 5));
+            }
+            unsigned int symbol = 0;
+            for(size_t length = 3; length <= kMaxMatch; ++length)
+            {
+                while(symbol < 28 && kLengthBase[symbol + 1] <= length)
+                {
+                    ++symbol;
+                }
+                length_symbol[length] = static_cast<unsigned char>(symbol);
+            }
+            for(unsigned int i = 0; i < 256; ++i)
+            {
+                unsigned int crc = i;
+                for(int bit = 0; bit < 8; ++bit)
+                {
+                    crc = (crc & 1u) ? 0xEDB88320u ^ (crc >> 1) : crc >> 1;
+                }
+                crc_table[i] = crc;
+            }
+        }
+    };
+
+    static const FixedCodes& fixed_codes()
+    {
+        static const FixedCodes codes;
+        return codes;
+    }
+
+    struct BitWriter
+    {
+        std::string* out;
+        unsigned long long bits;
+        unsigned int count;
+    };
+
+    static void put_bits(BitWriter& writer, unsigned int value, unsigned int count)
+    {
+        writer.bits |= static_cast<unsigned long long>(value) << writer.count;
+        writer.count += count;
+        while(writer.count >= 8)
+        {
+            writer.out->push_back(static_cast<char>(writer.bits & 0xFFu));
+            writer.bits >>= 8;
+            writer.count -= 8;
+        }
+    }
+
+    static void align_bits(BitWriter& writer)
+    {
+        if(writer.count != 0)
+        {
+            writer.out->push_back(static_cast<char>(writer.bits & 0xFFu));
+        }
+        writer.bits = 0;
+        writer.count = 0;
+    }
+
+    static void put_literal(BitWriter& writer, const FixedCodes& codes, unsigned int symbol)
+    {
+        put_bits(writer, codes.literal_code[symbol], codes.literal_length[symbol]);
+    }
+
+    static void put_match(BitWriter& writer, const FixedCodes& codes, size_t length, size_t distance)
+    {
+        const unsigned int length_index = codes.length_symbol[length];
+        put_literal(writer, codes, 257 + length_index);
+        put_bits(writer, static_cast<unsigned int>(length - kLengthBase[length_index]), kLengthExtra[length_index]);
+
+        const unsigned int distance_index = static_cast<unsigned int>(
+            std::upper_bound(kDistanceBase, kDistanceBase + 30, distance) - kDistanceBase - 1);
+        put_bits(writer, codes.distance_code[distance_index], 5);
+        put_bits(writer, static_cast<unsigned int>(distance - kDistanceBase[distance_index]), kDistanceExtra[distance_index]);
+    }
+
+    static unsigned int hash4(const unsigned char* bytes)
+    {
+        unsigned int value;
+        memcpy(&value, bytes, sizeof(value));
+        return (value * 2654435761u) >> (32 - kHashBits);
+    }
+
+    // Match-finder table, one per thread so it is allocated once rather than
+    // per call. Slots hold `base` + position + 1; anything at or below
+    // `base` was left by an earlier call and reads as empty, so the table
+    // never needs clearing between calls.
+    struct HashHeads
+    {
+        std::vector<unsigned int> slots;
+        unsigned int base;
+    };
+
+    static HashHeads& hash_heads(size_t size)
+    {
+        static thread_local HashHeads heads;
+        if(heads.slots.empty() || size >= 0xFFFFFFFFu - heads.base)
+        {
+            heads.slots.assign(static_cast<size_t>(1) << kHashBits, 0);
+            heads.base = 0;
+        }
+        return heads;
+    }
+
+    // Inflate side: puff-style canonical Huffman decoding, one bit at a time.
+    // Only small client messages go through it.
+    struct BitReader
+    {
+        const unsigned char* in;
+        size_t size;
+        size_t pos;
+        unsigned int bit;
+        bool overrun;
+    };
+
+    static unsigned int get_bits(BitReader& reader, unsigned int count)
+    {
+        unsigned int value = 0;
+        for(unsigned int i = 0; i < count; ++i)
+        {
+            if(reader.pos >= reader.size)
+            {
+                reader.overrun = true;
+                return 0;
+            }
+            value |= ((reader.in[reader.pos] >> reader.bit) & 1u) << i;
+            if(++reader.bit == 8)
+            {
+                reader.bit = 0;
+                ++reader.pos;
+            }
+        }
+        return value;
+    }
+
+    struct Huffman
+    {
+        unsigned short counts[16];
+        unsigned short symbols[288];
+    };
+
+    static bool build_huffman(Huffman& huffman, const unsigned char* lengths, unsigned int count)
+    {
+        memset(huffman.counts, 0, sizeof(huffman.counts));
+        for(unsigned int i = 0; i < count; ++i)
+        {
+            huffman.counts[lengths[i]]++;
+        }
+        huffman.counts[0] = 0;
+
+        int left = 1;
+        for(unsigned int length = 1; length < 16; ++length)
+        {
+            left = (left << 1) - huffman.counts[length];
+            if(left < 0)
+            {
+                return false;
+            }
+        }
+
+        unsigned short offsets[16];
+        offsets[1] = 0;
+        for(unsigned int length = 1; length < 15; ++length)
+        {
+            offsets[length + 1] = static_cast<unsigned short>(offsets[length] + huffman.counts[length]);
+        }
+        for(unsigned int i = 0; i < count; ++i)
+        {
+            if(lengths[i] != 0)
+            {
+                huffman.symbols[offsets[lengths[i]]++] = static_cast<unsigned short>(i);
+            }
+        }
+        return true;
+    }
+
+    static int decode_symbol(BitReader& reader, const Huffman& huffman)
+    {
+        int code = 0;
+        int first = 0;
+        int index = 0;
+        for(unsigned int length = 1; length < 16; ++length)
+        {
+            code |= static_cast<int>(get_bits(reader, 1));
+            const int count = huffman.counts[length];
+            if(code - count < first)
+            {
+                return huffman.symbols[index + (code - first)];
+            }
+            index += count;
+            first = (first + count) << 1;
+            code <<= 1;
+        }
+        return -1;
+    }
+
+    static bool inflate_codes(BitReader& reader, const Huffman& literals, const Huffman& distances,
+        size_t start, size_t max_out, std::string& out)
+    {
+        for(;;)
+        {
+            const int symbol = decode_symbol(reader, literals);
+            if(symbol < 0 || reader.overrun)
+            {
+                return false;
+            }
+            if(symbol < 256)
+            {
+                if(out.size() - start >= max_out)
+                {
+                    return false;
+                }
+                out.push_back(static_cast<char>(symbol));
+                continue;
+            }
+            if(symbol == static_cast<int>(kEndOfBlock))
+            {
+                return true;
+            }
+
+            const int length_index = symbol - 257;
+            if(length_index >= 29)
+            {
+                return false;
+            }
+            const size_t length = kLengthBase[length_index] + get_bits(reader, kLengthExtra[length_index]);
+            const int distance_index = decode_symbol(reader, distances);
+            if(distance_index < 0 || distance_index >= 30)
+            {
+                return false;
+            }
+            const size_t distance = kDistanceBase[distance_index] + get_bits(reader, kDistanceExtra[distance_index]);
+            if(reader.overrun || distance > out.size() - start || out.size() - start + length > max_out)
+            {
+                return false;
+            }
+            const size_t from = out.size() - distance;
+            for(size_t i = 0; i < length; ++i)
+            {
+                out.push_back(out[from + i]);
+            }
+        }
+    }
+
+    static bool read_dynamic_tables(BitReader& reader, Huffman& literals, Huffman& distances)
+    {
+        const unsigned int literal_count = get_bits(reader, 5) + 257;
+        const unsigned int distance_count = get_bits(reader, 5) + 1;
+        const unsigned int code_length_count = get_bits(reader, 4) + 4;
+        if(literal_count > 286 || distance_count > 30)
+        {
+            return false;
+        }
+
+        unsigned char lengths[320];
+        memset(lengths, 0, sizeof(lengths));
+        for(unsigned int i = 0; i < code_length_count; ++i)
+        {
+            lengths[kCodeLengthOrder[i]] = static_cast<unsigned char>(get_bits(reader, 3));
+        }
+        Huffman code_lengths;
+        if(!build_huffman(code_lengths, lengths, 19))
+        {
+            return false;
+        }
+
+        memset(lengths, 0, sizeof(lengths));
+        unsigned int index = 0;
+        while(index < literal_count + distance_count)
+        {
+            const int symbol = decode_symbol(reader, code_lengths);
+            if(symbol < 0 || reader.overrun)
+            {
+                return false;
+            }
+            if(symbol < 16)
+            {
+                lengths[index++] = static_cast<unsigned char>(symbol);
+                continue;
+            }
+
+            unsigned char value = 0;
+            unsigned int repeat;
+            if(symbol == 16)
+            {
+                if(index == 0)
+                {
+                    return false;
+                }
+                value = lengths[index - 1];
+                repeat = 3 + get_bits(reader, 2);
+            }
+            else if(symbol == 17)
+            {
+                repeat = 3 + get_bits(reader, 3);
+            }
+            else
+            {
+                repeat = 11 + get_bits(reader, 7);
+            }
+            if(index + repeat > literal_count + distance_count)
+            {
+                return false;
+            }
+            while(repeat-- != 0)
+            {
+                lengths[index++] = value;
+            }
+        }
+
+        return lengths[kEndOfBlock] != 0 &&
+            build_huffman(literals, lengths, literal_count) &&
+            build_huffman(distances, lengths + literal_count, distance_count);
+    }
+}
+
+void deflate_raw(const void* data, size_t size, DeflateFlush flush, std::string& out)
+{
+    const FixedCodes& codes = fixed_codes();
+    const unsigned char* in = static_cast<const unsigned char*>(data);
+    BitWriter writer = { &out, 0, 0 };
+    out.reserve(out.size() + size / 3 + 16);
+
+    put_bits(writer, flush == DeflateFlush_Finish ? 1u : 0u, 1);
+    put_bits(writer, 1, 2);
+
+    // head[h] holds the last position with that hash (see HashHeads).
+    HashHeads& heads = hash_heads(size);
+    unsigned int* head = heads.slots.data();
+    const unsigned int base = heads.base;
+    size_t pos = 0;
+    while(pos + kMinMatch <= size)
+    {
+        const unsigned int hash = hash4(in + pos);
+        const unsigned int candidate = head[hash];
+        head[hash] = base + static_cast<unsigned int>(pos + 1);
+
+        const size_t match_pos = candidate > base ? static_cast<size_t>(candidate - base - 1) : pos;
+        if(match_pos < pos && pos - match_pos <= kWindowSize && memcmp(in + match_pos, in + pos, kMinMatch) == 0)
+        {
+            const unsigned char* match = in + match_pos;
+            const size_t limit = std::min(kMaxMatch, size - pos);
+            size_t length = kMinMatch;
+            while(length < limit && match[length] == in[pos + length])
+            {
+                ++length;
+            }
+            put_match(writer, codes, length, static_cast<size_t>(in + pos - match));
+
+            const size_t end = pos + length;
+            for(++pos; pos < end && pos + kMinMatch <= size; ++pos)
+            {
+                head[hash4(in + pos)] = base + static_cast<unsigned int>(pos + 1);
+            }
+            pos = end;
+            continue;
+        }
+
+        put_literal(writer, codes, in[pos]);
+        ++pos;
+    }
+    for(; pos < size; ++pos)
+    {
+        put_literal(writer, codes, in[pos]);
+    }
+    put_literal(writer, codes, kEndOfBlock);
+    heads.base = base + static_cast<unsigned int>(size) + 1;
+
+    if(flush == DeflateFlush_Sync)
+    {
+        // Empty stored block: header bits, byte alignment, LEN 0, NLEN FFFF.
+        put_bits(writer, 0, 3);
+        align_bits(writer);
+        out.append("\x00\x00\xFF\xFF", 4);
+        return;
+    }
+    align_bits(writer);
+}
+
+void deflate_gzip(const void* data, size_t size, std::string& out)
+{
+    // Magic, CM=8, no flags, no mtime, XFL=4 (fastest), OS unknown.
+    static const unsigned char kHeader[10] = { 0x1F, 0x8B, 8, 0, 0, 0, 0, 0, 4, 0xFF };
+    out.append(reinterpret_cast<const char*>(kHeader), sizeof(kHeader));
+    deflate_raw(data, size, DeflateFlush_Finish, out);
+
+    const unsigned int trailer[2] = { deflate_crc32(data, size), static_cast<unsigned int>(size) };
+    for(int word = 0; word < 2; ++word)
+    {
+        for(int shift = 0; shift < 32; shift += 8)
+        {
+            out.push_back(static_cast<char>((trailer[word] >> shift) & 0xFFu));
+        }
+    }
+}
+
+bool deflate_inflate_raw(const void* data, size_t size, size_t max_out, std::string& out)
+{
+    BitReader reader = { static_cast<const unsigned char*>(data), size, 0, 0, false };
+    const size_t start = out.size();
+
+    bool final_block = false;
+    while(!final_block)
+    {
+        // A sync-flushed stream simply stops at a byte-aligned block boundary.
+        if(reader.pos >= reader.size)
+        {
+            return true;
+        }
+
+        final_block = get_bits(reader, 1) != 0;
+        const unsigned int type = get_bits(reader, 2);
+        if(reader.overrun)
+        {
+            return false;
+        }
+
+        if(type == 0)
+        {
+            if(reader.bit != 0)
+            {
+                reader.bit = 0;
+                ++reader.pos;
+            }
+            if(reader.pos + 4 > reader.size)
+            {
+                return false;
+            }
+            const unsigned int length = reader.in[reader.pos] | (reader.in[reader.pos + 1] << 8);
+            const unsigned int check = reader.in[reader.pos + 2] | (reader.in[reader.pos + 3] << 8);
+            reader.pos += 4;
+            if((length ^ 0xFFFFu) != check || reader.pos + length > reader.size || out.size() - start + length > max_out)
+            {
+                return false;
+            }
+            out.append(reinterpret_cast<const char*>(reader.in + reader.pos), length);
+            reader.pos += length;
+            continue;
+        }
+
+        Huffman literals;
+        Huffman distances;
+        if(type == 1)
+        {
+            unsigned char lengths[288 + 30];
+            memset(lengths, 8, 144);
+            memset(lengths + 144, 9, 112);
+            memset(lengths + 256, 7, 24);
+            memset(lengths + 280, 8, 8);
+            memset(lengths + 288, 5, 30);
+            build_huffman(literals, lengths, 288);
+            build_huffman(distances, lengths + 288, 30);
+        }
+        else if(type != 2 || !read_dynamic_tables(reader, literals, distances))
+        {
+            return false;
+        }
+
+        if(!inflate_codes(reader, literals, distances, start, max_out, out))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+unsigned int deflate_crc32(const void* data, size_t size)
+{
+    const unsigned int* table = fixed_codes().crc_table;
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    unsigned int crc = 0xFFFFFFFFu;
+    for(size_t i = 0; i < size; ++i)
+    {
+        crc = table[(crc ^ bytes[i]) & 0xFFu] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <stddef.h>
+
+#include <string>
+
+// Minimal DEFLATE (RFC 1951) for HTTP and WebSocket compression. The encoder
+// is a greedy single-probe LZ77 over fixed Huffman codes: built for speed
+// over ratio, since payloads are re-encoded for every engine version.
+
+enum DeflateFlush
+{
+    // One final block; what gzip and Content-Encoding expect.
+    DeflateFlush_Finish = 0,
+    // Non-final block plus an empty stored block ending in 00 00 FF FF, as
+    // permessage-deflate expects before it strips those four bytes.
+    DeflateFlush_Sync
+};
+
+// Appends a raw DEFLATE stream of `data` to `out`.
+void deflate_raw(const void* data, size_t size, DeflateFlush flush, std::string& out);
+// Appends a gzip member (RFC 1952) of `data` to `out`.
+void deflate_gzip(const void* data, size_t size, std::string& out);
+// Appends the inflated form of a raw DEFLATE stream to `out`. The stream may
+// end after a final block or at a block boundary when the input runs out.
+// Returns false on malformed input or when more than `max_out` bytes would
+// be produced.
+bool deflate_inflate_raw(const void* data, size_t size, size_t max_out, std::string& out);
+unsigned int deflate_crc32(const void* data, size_t size);
@@ -0,0 +1,52 @@
+#include "net/http_assets.h"
+
+#include <string.h>
+
+namespace
+{
+    const char kIndexPath[] = "/index.html";
+
+    static int compare_path(const char* asset_path, const char* path, size_t path_len)
+    {
+        const int result = strncmp(asset_path, path, path_len);
+        if(result != 0)
+        {
+            return result;
+        }
+        return asset_path[path_len] == '\0' ? 0 : 1;
+    }
+}
+
+const HttpAsset* http_assets_find(const char* path, size_t path_len)
+{
+    if(!path || path_len == 0)
+    {
+        return nullptr;
+    }
+    if(path_len == 1 && path[0] == '/')
+    {
+        path = kIndexPath;
+        path_len = sizeof(kIndexPath) - 1;
+    }
+
+    size_t low = 0;
+    size_t high = kHttpAssetCount;
+    while(low < high)
+    {
+        const size_t mid = low + (high - low) / 2;
+        const int order = compare_path(kHttpAssets[mid].path, path, path_len);
+        if(order == 0)
+        {
+            return &kHttpAssets[mid];
+        }
+        if(order < 0)
+        {
+            low = mid + 1;
+        }
+        else
+        {
+            high = mid;
+        }
+    }
+    return nullptr;
+}
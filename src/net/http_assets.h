@@ -0,0 +1,29 @@
+#pragma once
+
+#include <stddef.h>
+
+// One file from webui/dist, packed by webui/scripts/pack-assets.js into the
+// generated http_assets_data.cpp. Compressed variants are null when they
+// would not be smaller than the raw bytes.
+struct HttpAsset
+{
+    const char* path;
+    const char* content_type;
+    // Strong, quoted ETag of the raw bytes.
+    const char* etag;
+    // Short content tag that pinned URLs carry as `?v=`.
+    const char* version;
+    const unsigned char* data;
+    size_t size;
+    const unsigned char* gzip;
+    size_t gzip_size;
+    const unsigned char* brotli;
+    size_t brotli_size;
+};
+
+extern const HttpAsset kHttpAssets[];
+extern const size_t kHttpAssetCount;
+
+// `path` is the request path; "/" means "/index.html". Returns nullptr when
+// the bundle has no such file.
+const HttpAsset* http_assets_find(const char* path, size_t path_len);
@@ -0,0 +1,1555 @@
+// Generated by webui/scripts/pack-assets.js from webui/dist. Do not edit.
+#include "net/http_assets.h"
+
+namespace
+{
+    const unsigned char kAsset0[] = {
+        34,117,115,101,32,115,116,114,105,99,116,34,59,10,99,111,110,115,116,32,115,116,97,116,
+        115,70,105,101,108,100,115,32,61,32,123,125,59,10,100,111,99,117,109,101,110,116,46,113,
+        117,101,114,121,83,101,108,101,99,116,111,114,65,108,108,40,34,91,100,97,116,97,45,102,
+        105,101,108,100,93,34,41,46,102,111,114,69,97,99,104,40,40,110,111,100,101,41,32,61,
+        62,32,123,10,32,32,32,32,99,111,110,115,116,32,102,105,101,108,100,32,61,32,110,111,
+        100,101,46,103,101,116,65,116,116,114,105,98,117,116,101,40,34,100,97,116,97,45,102,105,
+        101,108,100,34,41,59,10,32,32,32,32,105,102,32,40,102,105,101,108,100,41,32,123,10,
+        32,32,32,32,32,32,32,32,115,116,97,116,115,70,105,101,108,100,115,91,102,105,101,108,
+        100,93,32,61,32,110,111,100,101,59,10,32,32,32,32,125,10,125,41,59,10,99,111,110,
+        115,116,32,114,101,102,114,101,115,104,66,117,116,116,111,110,32,61,32,100,111,99,117,109,
+        101,110,116,46,113,117,101,114,121,83,101,108,101,99,116,111,114,40,34,91,100,97,116,97,
+        45,114,111,108,101,61,39,114,101,102,114,101,115,104,39,93,34,41,59,10,99,111,110,115,
+        116,32,116,111,114,114,101,110,116,115,67,111,110,116,97,105,110,101,114,32,61,32,100,111,
+        99,117,109,101,110,116,46,113,117,101,114,121,83,101,108,101,99,116,111,114,40,34,91,100,
+        97,116,97,45,114,111,108,101,61,39,116,111,114,114,101,110,116,115,39,93,34,41,59,10,
+        99,111,110,115,116,32,101,109,112,116,121,83,116,97,116,101,32,61,32,100,111,99,117,109,
+        101,110,116,46,113,117,101,114,121,83,101,108,101,99,116,111,114,40,34,91,100,97,116,97,
+        45,114,111,108,101,61,39,101,109,112,116,121,45,115,116,97,116,101,39,93,34,41,59,10,
+        99,111,110,115,116,32,116,111,97,115,116,32,61,32,100,111,99,117,109,101,110,116,46,113,
+        117,101,114,121,83,101,108,101,99,116,111,114,40,34,91,100,97,116,97,45,114,111,108,101,
+        61,39,116,111,97,115,116,39,93,34,41,59,10,99,111,110,115,116,32,97,100,100,70,111,
+        114,109,32,61,32,100,111,99,117,109,101,110,116,46,113,117,101,114,121,83,101,108,101,99,
+        116,111,114,40,34,35,97,100,100,45,102,111,114,109,34,41,59,10,99,111,110,115,116,32,
+        109,97,103,110,101,116,73,110,112,117,116,32,61,32,100,111,99,117,109,101,110,116,46,113,
+        117,101,114,121,83,101,108,101,99,116,111,114,40,34,35,109,97,103,110,101,116,45,105,110,
+        112,117,116,34,41,59,10,99,111,110,115,116,32,110,97,109,101,73,110,112,117,116,32,61,
+        32,100,111,99,117,109,101,110,116,46,113,117,101,114,121,83,101,108,101,99,116,111,114,40,
+        34,35,110,97,109,101,45,105,110,112,117,116,34,41,59,10,99,111,110,115,116,32,115,105,
+        122,101,73,110,112,117,116,32,61,32,100,111,99,117,109,101,110,116,46,113,117,101,114,121,
+        83,101,108,101,99,116,111,114,40,34,35,115,105,122,101,45,105,110,112,117,116,34,41,59,
+        10,99,111,110,115,116,32,97,112,112,83,116,97,116,101,32,61,32,123,10,32,32,32,32,
+        115,110,97,112,115,104,111,116,58,32,110,117,108,108,44,10,32,32,32,32,119,115,58,32,
+        110,117,108,108,44,10,32,32,32,32,114,101,99,111,110,110,101,99,116,72,97,110,100,108,
+        101,58,32,110,117,108,108,10,125,59,10,47,47,32,83,116,97,116,101,32,104,101,108,100,
+        32,102,114,111,109,32,116,104,101,32,87,101,98,83,111,99,107,101,116,32,115,116,114,101,
+        97,109,44,32,107,101,121,101,100,32,98,121,32,116,111,114,114,101,110,116,32,73,68,46,
+        10,99,111,110,115,116,32,108,105,118,101,32,61,32,123,10,32,32,32,32,115,101,113,58,
+        32,48,44,10,32,32,32,32,115,116,97,116,115,58,32,110,117,108,108,44,10,32,32,32,
+        32,116,111,114,114,101,110,116,115,58,32,110,101,119,32,77,97,112,40,41,10,125,59,10,
+        102,117,110,99,116,105,111,110,32,102,111,114,109,97,116,66,121,116,101,115,40,118,97,108,
+        117,101,41,32,123,10,32,32,32,32,105,102,32,40,33,118,97,108,117,101,32,124,124,32,
+        118,97,108,117,101,32,60,61,32,48,41,32,123,10,32,32,32,32,32,32,32,32,114,101,
+        116,117,114,110,32,34,48,32,66,34,59,10,32,32,32,32,125,10,32,32,32,32,99,111,
+        110,115,116,32,117,110,105,116,115,32,61,32,91,34,66,34,44,32,34,75,66,34,44,32,
+        34,77,66,34,44,32,34,71,66,34,44,32,34,84,66,34,93,59,10,32,32,32,32,108,
+        101,116,32,99,111,117,110,116,32,61,32,118,97,108,117,101,59,10,32,32,32,32,108,101,
+        116,32,117,110,105,116,32,61,32,48,59,10,32,32,32,32,119,104,105,108,101,32,40,99,
+        111,117,110,116,32,62,61,32,49,48,50,52,32,38,38,32,117,110,105,116,32,60,32,117,
+        110,105,116,115,46,108,101,110,103,116,104,32,45,32,49,41,32,123,10,32,32,32,32,32,
+        32,32,32,99,111,117,110,116,32,47,61,32,49,48,50,52,59,10,32,32,32,32,32,32,
+        32,32,117,110,105,116,43,43,59,10,32,32,32,32,125,10,32,32,32,32,99,111,110,115,
+        116,32,112,114,101,99,105,115,105,111,110,32,61,32,99,111,117,110,116,32,62,61,32,49,
+        48,32,124,124,32,117,110,105,116,32,61,61,61,32,48,32,63,32,48,32,58,32,49,59,
+        10,32,32,32,32,114,101,116,117,114,110,32,96,36,123,99,111,117,110,116,46,116,111,70,
+        105,120,101,100,40,112,114,101,99,105,115,105,111,110,41,125,32,36,123,117,110,105,116,115,
+        91,117,110,105,116,93,125,96,59,10,125,10,102,117,110,99,116,105,111,110,32,102,111,114,
+        109,97,116,82,97,116,101,40,118,97,108,117,101,41,32,123,10,32,32,32,32,105,102,32,
+        40,33,118,97,108,117,101,32,124,124,32,118,97,108,117,101,32,60,61,32,48,41,32,123,
+        10,32,32,32,32,32,32,32,32,114,101,116,117,114,110,32,34,48,32,66,47,115,34,59,
+        10,32,32,32,32,125,10,32,32,32,32,114,101,116,117,114,110,32,96,36,123,102,111,114,
+        109,97,116,66,121,116,101,115,40,118,97,108,117,101,41,125,47,115,96,59,10,125,10,102,
+        117,110,99,116,105,111,110,32,102,111,114,109,97,116,80,114,111,103,114,101,115,115,40,118,
+        97,108,117,101,41,32,123,10,32,32,32,32,99,111,110,115,116,32,112,99,116,32,61,32,
+        77,97,116,104,46,109,97,120,40,48,44,32,77,97,116,104,46,109,105,110,40,49,44,32,
+        118,97,108,117,101,32,124,124,32,48,41,41,59,10,32,32,32,32,114,101,116,117,114,110,
+        32,96,36,123,40,112,99,116,32,42,32,49,48,48,41,46,116,111,70,105,120,101,100,40,
+        49,41,125,37,96,59,10,125,10,102,117,110,99,116,105,111,110,32,116,111,114,114,101,110,
+        116,83,116,97,116,117,115,40,116,111,114,114,101,110,116,41,32,123,10,32,32,32,32,105,
+        102,32,40,116,111,114,114,101,110,116,46,99,111,109,112,108,101,116,101,41,32,123,10,32,
+        32,32,32,32,32,32,32,114,101,116,117,114,110,32,34,67,111,109,112,108,101,116,101,34,
+        59,10,32,32,32,32,125,10,32,32,32,32,105,102,32,40,116,111,114,114,101,110,116,46,
+        112,97,117,115,101,100,41,32,123,10,32,32,32,32,32,32,32,32,114,101,116,117,114,110,
+        32,34,80,97,117,115,101,100,34,59,10,32,32,32,32,125,10,32,32,32,32,114,101,116,
+        117,114,110,32,34,68,111,119,110,108,111,97,100,105,110,103,34,59,10,125,10,102,117,110,
+        99,116,105,111,110,32,115,104,111,119,84,111,97,115,116,40,109,101,115,115,97,103,101,44,
+        32,107,105,110,100,32,61,32,34,105,110,102,111,34,41,32,123,10,32,32,32,32,105,102,
+        32,40,33,116,111,97,115,116,41,32,123,10,32,32,32,32,32,32,32,32,114,101,116,117,
+        114,110,59,10,32,32,32,32,125,10,32,32,32,32,116,111,97,115,116,46,116,101,120,116,
+        67,111,110,116,101,110,116,32,61,32,109,101,115,115,97,103,101,59,10,32,32,32,32,116,
+        111,97,115,116,46,115,101,116,65,116,116,114,105,98,117,116,101,40,34,100,97,116,97,45,
+        107,105,110,100,34,44,32,107,105,110,100,41,59,10,32,32,32,32,116,111,97,115,116,46,
+        99,108,97,115,115,76,105,115,116,46,97,100,100,40,34,116,111,97,115,116,45,45,118,105,
+        115,105,98,108,101,34,41,59,10,32,32,32,32,119,105,110,100,111,119,46,115,101,116,84,
+        105,109,101,111,117,116,40,40,41,32,61,62,32,116,111,97,115,116,46,99,108,97,115,115,
+        76,105,115,116,46,114,101,109,111,118,101,40,34,116,111,97,115,116,45,45,118,105,115,105,
+        98,108,101,34,41,44,32,50,53,48,48,41,59,10,125,10,102,117,110,99,116,105,111,110,
+        32,117,112,100,97,116,101,83,116,97,116,115,40,115,116,97,116,115,41,32,123,10,32,32,
+        32,32,118,97,114,32,95,97,44,32,95,98,44,32,95,99,44,32,95,100,44,32,95,101,
+        59,10,32,32,32,32,40,95,97,32,61,32,115,116,97,116,115,70,105,101,108,100,115,91,
+        34,112,111,114,116,34,93,41,32,61,61,61,32,110,117,108,108,32,124,124,32,95,97,32,
+        61,61,61,32,118,111,105,100,32,48,32,63,32,118,111,105,100,32,48,32,58,32,95,97,
+        46,114,101,112,108,97,99,101,67,104,105,108,100,114,101,110,40,100,111,99,117,109,101,110,
+        116,46,99,114,101,97,116,101,84,101,120,116,78,111,100,101,40,115,116,97,116,115,46,112,
+        111,114,116,46,116,111,83,116,114,105,110,103,40,41,41,41,59,10,32,32,32,32,40,95,
+        98,32,61,32,115,116,97,116,115,70,105,101,108,100,115,91,34,116,111,114,114,101,110,116,
+        95,99,111,117,110,116,34,93,41,32,61,61,61,32,110,117,108,108,32,124,124,32,95,98,
+        32,61,61,61,32,118,111,105,100,32,48,32,63,32,118,111,105,100,32,48,32,58,32,95,
+        98,46,114,101,112,108,97,99,101,67,104,105,108,100,114,101,110,40,100,111,99,117,109,101,
+        110,116,46,99,114,101,97,116,101,84,101,120,116,78,111,100,101,40,115,116,97,116,115,46,
+        116,111,114,114,101,110,116,95,99,111,117,110,116,46,116,111,83,116,114,105,110,103,40,41,
+        41,41,59,10,32,32,32,32,40,95,99,32,61,32,115,116,97,116,115,70,105,101,108,100,
+        115,91,34,97,99,116,105,118,101,34,93,41,32,61,61,61,32,110,117,108,108,32,124,124,
+        32,95,99,32,61,61,61,32,118,111,105,100,32,48,32,63,32,118,111,105,100,32,48,32,
+        58,32,95,99,46,114,101,112,108,97,99,101,67,104,105,108,100,114,101,110,40,100,111,99,
+        117,109,101,110,116,46,99,114,101,97,116,101,84,101,120,116,78,111,100,101,40,115,116,97,
+        116,115,46,97,99,116,105,118,101,46,116,111,83,116,114,105,110,103,40,41,41,41,59,10,
+        32,32,32,32,40,95,100,32,61,32,115,116,97,116,115,70,105,101,108,100,115,91,34,100,
+        111,119,110,108,111,97,100,95,114,97,116,101,34,93,41,32,61,61,61,32,110,117,108,108,
+        32,124,124,32,95,100,32,61,61,61,32,118,111,105,100,32,48,32,63,32,118,111,105,100,
+        32,48,32,58,32,95,100,46,114,101,112,108,97,99,101,67,104,105,108,100,114,101,110,40,
+        100,111,99,117,109,101,110,116,46,99,114,101,97,116,101,84,101,120,116,78,111,100,101,40,
+        102,111,114,109,97,116,82,97,116,101,40,115,116,97,116,115,46,100,111,119,110,108,111,97,
+        100,95,114,97,116,101,41,41,41,59,10,32,32,32,32,40,95,101,32,61,32,115,116,97,
+        116,115,70,105,101,108,100,115,91,34,117,112,108,111,97,100,95,114,97,116,101,34,93,41,
+        32,61,61,61,32,110,117,108,108,32,124,124,32,95,101,32,61,61,61,32,118,111,105,100,
+        32,48,32,63,32,118,111,105,100,32,48,32,58,32,95,101,46,114,101,112,108,97,99,101,
+        67,104,105,108,100,114,101,110,40,100,111,99,117,109,101,110,116,46,99,114,101,97,116,101,
+        84,101,120,116,78,111,100,101,40,102,111,114,109,97,116,82,97,116,101,40,115,116,97,116,
+        115,46,117,112,108,111,97,100,95,114,97,116,101,41,41,41,59,10,125,10,102,117,110,99,
+        116,105,111,110,32,99,114,101,97,116,101,65,99,116,105,111,110,66,117,116,116,111,110,40,
+        108,97,98,101,108,44,32,97,99,116,105,111,110,44,32,116,111,114,114,101,110,116,73,100,
+        44,32,100,105,115,97,98,108,101,100,32,61,32,102,97,108,115,101,41,32,123,10,32,32,
+        32,32,99,111,110,115,116,32,98,117,116,116,111,110,32,61,32,100,111,99,117,109,101,110,
+        116,46,99,114,101,97,116,101,69,108,101,109,101,110,116,40,34,98,117,116,116,111,110,34,
+        41,59,10,32,32,32,32,98,117,116,116,111,110,46,116,121,112,101,32,61,32,34,98,117,
+        116,116,111,110,34,59,10,32,32,32,32,98,117,116,116,111,110,46,99,108,97,115,115,78,
+        97,109,101,32,61,32,34,116,111,114,114,101,110,116,95,95,97,99,116,105,111,110,34,59,
+        10,32,32,32,32,98,117,116,116,111,110,46,116,101,120,116,67,111,110,116,101,110,116,32,
+        61,32,108,97,98,101,108,59,10,32,32,32,32,98,117,116,116,111,110,46,100,105,115,97,
+        98,108,101,100,32,61,32,100,105,115,97,98,108,101,100,59,10,32,32,32,32,98,117,116,
+        116,111,110,46,97,100,100,69,118,101,110,116,76,105,115,116,101,110,101,114,40,34,99,108,
+        105,99,107,34,44,32,40,41,32,61,62,32,104,97,110,100,108,101,84,111,114,114,101,110,
+        116,65,99,116,105,111,110,40,97,99,116,105,111,110,44,32,116,111,114,114,101,110,116,73,
+        100,44,32,98,117,116,116,111,110,41,41,59,10,32,32,32,32,114,101,116,117,114,110,32,
+        98,117,116,116,111,110,59,10,125,10,102,117,110,99,116,105,111,110,32,114,101,110,100,101,
+        114,84,111,114,114,101,110,116,40,116,111,114,114,101,110,116,41,32,123,10,32,32,32,32,
+        99,111,110,115,116,32,119,114,97,112,112,101,114,32,61,32,100,111,99,117,109,101,110,116,
+        46,99,114,101,97,116,101,69,108,101,109,101,110,116,40,34,97,114,116,105,99,108,101,34,
+        41,59,10,32,32,32,32,119,114,97,112,112,101,114,46,99,108,97,115,115,78,97,109,101,
+        32,61,32,34,116,111,114,114,101,110,116,34,59,10,32,32,32,32,105,102,32,40,116,111,
+        114,114,101,110,116,46,99,111,109,112,108,101,116,101,41,32,123,10,32,32,32,32,32,32,
+        32,32,119,114,97,112,112,101,114,46,99,108,97,115,115,76,105,115,116,46,97,100,100,40,
+        34,116,111,114,114,101,110,116,45,45,99,111,109,112,108,101,116,101,34,41,59,10,32,32,
+        32,32,125,10,32,32,32,32,101,108,115,101,32,105,102,32,40,116,111,114,114,101,110,116,
+        46,112,97,117,115,101,100,41,32,123,10,32,32,32,32,32,32,32,32,119,114,97,112,112,
+        101,114,46,99,108,97,115,115,76,105,115,116,46,97,100,100,40,34,116,111,114,114,101,110,
+        116,45,45,112,97,117,115,101,100,34,41,59,10,32,32,32,32,125,10,32,32,32,32,99,
+        111,110,115,116,32,104,101,97,100,101,114,32,61,32,100,111,99,117,109,101,110,116,46,99,
+        114,101,97,116,101,69,108,101,109,101,110,116,40,34,100,105,118,34,41,59,10,32,32,32,
+        32,104,101,97,100,101,114,46,99,108,97,115,115,78,97,109,101,32,61,32,34,116,111,114,
+        114,101,110,116,95,95,104,101,97,100,101,114,34,59,10,32,32,32,32,99,111,110,115,116,
+        32,116,105,116,108,101,66,108,111,99,107,32,61,32,100,111,99,117,109,101,110,116,46,99,
+        114,101,97,116,101,69,108,101,109,101,110,116,40,34,100,105,118,34,41,59,10,32,32,32,
+        32,99,111,110,115,116,32,116,105,116,108,101,32,61,32,100,111,99,117,109,101,110,116,46,
+        99,114,101,97,116,101,69,108,101,109,101,110,116,40,34,104,51,34,41,59,10,32,32,32,
+        32,116,105,116,108,101,46,116,101,120,116,67,111,110,116,101,110,116,32,61,32,116,111,114,
+        114,101,110,116,46,110,97,109,101,32,124,124,32,96,84,111,114,114,101,110,116,32,35,36,
+        123,116,111,114,114,101,110,116,46,105,100,125,96,59,10,32,32,32,32,116,105,116,108,101,
+        66,108,111,99,107,46,97,112,112,101,110,100,67,104,105,108,100,40,116,105,116,108,101,41,
+        59,10,32,32,32,32,99,111,110,115,116,32,109,101,116,97,32,61,32,100,111,99,117,109,
+        101,110,116,46,99,114,101,97,116,101,69,108,101,109,101,110,116,40,34,112,34,41,59,10,
+        32,32,32,32,109,101,116,97,46,99,108,97,115,115,78,97,109,101,32,61,32,34,116,111,
+        114,114,101,110,116,95,95,109,101,116,97,34,59,10,32,32,32,32,99,111,110,115,116,32,
+        115,105,122,101,84,101,120,116,32,61,32,116,111,114,114,101,110,116,46,115,105,122,101,32,
+        62,32,48,32,63,32,102,111,114,109,97,116,66,121,116,101,115,40,116,111,114,114,101,110,
+        116,46,115,105,122,101,41,32,58,32,34,85,110,107,110,111,119,110,32,115,105,122,101,34,
+        59,10,32,32,32,32,109,101,116,97,46,116,101,120,116,67,111,110,116,101,110,116,32,61,
+        32,96,73,68,32,36,123,116,111,114,114,101,110,116,46,105,100,125,32,226,128,162,32,36,
+        123,115,105,122,101,84,101,120,116,125,96,59,10,32,32,32,32,116,105,116,108,101,66,108,
+        111,99,107,46,97,112,112,101,110,100,67,104,105,108,100,40,109,101,116,97,41,59,10,32,
+        32,32,32,104,101,97,100,101,114,46,97,112,112,101,110,100,67,104,105,108,100,40,116,105,
+        116,108,101,66,108,111,99,107,41,59,10,32,32,32,32,99,111,110,115,116,32,97,99,116,
+        105,111,110,115,32,61,32,100,111,99,117,109,101,110,116,46,99,114,101,97,116,101,69,108,
+        101,109,101,110,116,40,34,100,105,118,34,41,59,10,32,32,32,32,97,99,116,105,111,110,
+        115,46,99,108,97,115,115,78,97,109,101,32,61,32,34,116,111,114,114,101,110,116,95,95,
+        97,99,116,105,111,110,115,34,59,10,32,32,32,32,105,102,32,40,33,116,111,114,114,101,
+        110,116,46,99,111,109,112,108,101,116,101,32,124,124,32,116,111,114,114,101,110,116,46,112,
+        97,117,115,101,100,41,32,123,10,32,32,32,32,32,32,32,32,99,111,110,115,116,32,116,
+        111,103,103,108,101,65,99,116,105,111,110,32,61,32,116,111,114,114,101,110,116,46,112,97,
+        117,115,101,100,32,63,32,34,114,101,115,117,109,101,34,32,58,32,34,112,97,117,115,101,
+        34,59,10,32,32,32,32,32,32,32,32,99,111,110,115,116,32,116,111,103,103,108,101,76,
+        97,98,101,108,32,61,32,116,111,114,114,101,110,116,46,112,97,117,115,101,100,32,63,32,
+        34,82,101,115,117,109,101,34,32,58,32,34,80,97,117,115,101,34,59,10,32,32,32,32,
+        32,32,32,32,97,99,116,105,111,110,115,46,97,112,112,101,110,100,67,104,105,108,100,40,
+        99,114,101,97,116,101,65,99,116,105,111,110,66,117,116,116,111,110,40,116,111,103,103,108,
+        101,76,97,98,101,108,44,32,116,111,103,103,108,101,65,99,116,105,111,110,44,32,116,111,
+        114,114,101,110,116,46,105,100,41,41,59,10,32,32,32,32,125,10,32,32,32,32,101,108,
+        115,101,32,123,10,32,32,32,32,32,32,32,32,97,99,116,105,111,110,115,46,97,112,112,
+        101,110,100,67,104,105,108,100,40,99,114,101,97,116,101,65,99,116,105,111,110,66,117,116,
+        116,111,110,40,34,82,101,115,116,97,114,116,34,44,32,34,114,101,115,117,109,101,34,44,
+        32,116,111,114,114,101,110,116,46,105,100,44,32,102,97,108,115,101,41,41,59,10,32,32,
+        32,32,125,10,32,32,32,32,97,99,116,105,111,110,115,46,97,112,112,101,110,100,67,104,
+        105,108,100,40,99,114,101,97,116,101,65,99,116,105,111,110,66,117,116,116,111,110,40,34,
+        82,101,109,111,118,101,34,44,32,34,114,101,109,111,118,101,34,44,32,116,111,114,114,101,
+        110,116,46,105,100,41,41,59,10,32,32,32,32,104,101,97,100,101,114,46,97,112,112,101,
+        110,100,67,104,105,108,100,40,97,99,116,105,111,110,115,41,59,10,32,32,32,32,99,111,
+        110,115,116,32,112,114,111,103,114,101,115,115,32,61,32,100,111,99,117,109,101,110,116,46,
+        99,114,101,97,116,101,69,108,101,109,101,110,116,40,34,100,105,118,34,41,59,10,32,32,
+        32,32,112,114,111,103,114,101,115,115,46,99,108,97,115,115,78,97,109,101,32,61,32,34,
+        112,114,111,103,114,101,115,115,34,59,10,32,32,32,32,99,111,110,115,116,32,102,105,108,
+        108,32,61,32,100,111,99,117,109,101,110,116,46,99,114,101,97,116,101,69,108,101,109,101,
+        110,116,40,34,100,105,118,34,41,59,10,32,32,32,32,102,105,108,108,46,99,108,97,115,
+        115,78,97,109,101,32,61,32,34,112,114,111,103,114,101,115,115,95,95,102,105,108,108,34,
+        59,10,32,32,32,32,102,105,108,108,46,115,116,121,108,101,46,119,105,100,116,104,32,61,
+        32,102,111,114,109,97,116,80,114,111,103,114,101,115,115,40,116,111,114,114,101,110,116,46,
+        112,114,111,103,114,101,115,115,41,59,10,32,32,32,32,112,114,111,103,114,101,115,115,46,
+        97,112,112,101,110,100,67,104,105,108,100,40,102,105,108,108,41,59,10,32,32,32,32,99,
+        111,110,115,116,32,112,114,111,103,114,101,115,115,76,97,98,101,108,32,61,32,100,111,99,
+        117,109,101,110,116,46,99,114,101,97,116,101,69,108,101,109,101,110,116,40,34,100,105,118,
+        34,41,59,10,32,32,32,32,112,114,111,103,114,101,115,115,76,97,98,101,108,46,99,108,
+        97,115,115,78,97,109,101,32,61,32,34,112,114,111,103,114,101,115,115,95,95,108,97,98,
+        101,108,34,59,10,32,32,32,32,112,114,111,103,114,101,115,115,76,97,98,101,108,46,116,
+        101,120,116,67,111,110,116,101,110,116,32,61,32,102,111,114,109,97,116,80,114,111,103,114,
+        101,115,115,40,116,111,114,114,101,110,116,46,112,114,111,103,114,101,115,115,41,59,10,32,
+        32,32,32,99,111,110,115,116,32,100,101,116,97,105,108,115,32,61,32,100,111,99,117,109,
+        101,110,116,46,99,114,101,97,116,101,69,108,101,109,101,110,116,40,34,100,105,118,34,41,
+        59,10,32,32,32,32,100,101,116,97,105,108,115,46,99,108,97,115,115,78,97,109,101,32,
+        61,32,34,116,111,114,114,101,110,116,95,95,100,101,116,97,105,108,115,34,59,10,32,32,
+        32,32,99,111,110,115,116,32,100,111,119,110,108,111,97,100,101,100,32,61,32,100,111,99,
+        117,109,101,110,116,46,99,114,101,97,116,101,69,108,101,109,101,110,116,40,34,115,112,97,
+        110,34,41,59,10,32,32,32,32,99,111,110,115,116,32,100,111,119,110,108,111,97,100,101,
+        100,84,111,116,97,108,32,61,32,116,111,114,114,101,110,116,46,115,105,122,101,32,62,32,
+        48,32,63,32,102,111,114,109,97,116,66,121,116,101,115,40,116,111,114,114,101,110,116,46,
+        115,105,122,101,41,32,58,32,34,117,110,107,110,111,119,110,34,59,10,32,32,32,32,100,
+        111,119,110,108,111,97,100,101,100,46,116,101,120,116,67,111,110,116,101,110,116,32,61,32,
+        96,68,111,119,110,108,111,97,100,101,100,32,36,123,102,111,114,109,97,116,66,121,116,101,
+        115,40,116,111,114,114,101,110,116,46,100,111,119,110,108,111,97,100,101,100,41,125,32,47,
+        32,36,123,100,111,119,110,108,111,97,100,101,100,84,111,116,97,108,125,96,59,10,32,32,
+        32,32,99,111,110,115,116,32,114,97,116,101,115,32,61,32,100,111,99,117,109,101,110,116,
+        46,99,114,101,97,116,101,69,108,101,109,101,110,116,40,34,115,112,97,110,34,41,59,10,
+        32,32,32,32,114,97,116,101,115,46,116,101,120,116,67,111,110,116,101,110,116,32,61,32,
+        96,226,134,147,32,36,123,102,111,114,109,97,116,82,97,116,101,40,116,111,114,114,101,110,
+        116,46,100,111,119,110,108,111,97,100,95,114,97,116,101,41,125,32,226,134,145,32,36,123,
+        102,111,114,109,97,116,82,97,116,101,40,116,111,114,114,101,110,116,46,117,112,108,111,97,
+        100,95,114,97,116,101,41,125,96,59,10,32,32,32,32,99,111,110,115,116,32,115,116,97,
+        116,117,115,32,61,32,100,111,99,117,109,101,110,116,46,99,114,101,97,116,101,69,108,101,
+        109,101,110,116,40,34,115,112,97,110,34,41,59,10,32,32,32,32,115,116,97,116,117,115,
+        46,116,101,120,116,67,111,110,116,101,110,116,32,61,32,116,111,114,114,101,110,116,83,116,
+        97,116,117,115,40,116,111,114,114,101,110,116,41,59,10,32,32,32,32,100,101,116,97,105,
+        108,115,46,97,112,112,101,110,100,40,100,111,119,110,108,111,97,100,101,100,44,32,114,97,
+        116,101,115,44,32,115,116,97,116,117,115,41,59,10,32,32,32,32,119,114,97,112,112,101,
+        114,46,97,112,112,101,110,100,40,104,101,97,100,101,114,44,32,112,114,111,103,114,101,115,
+        115,44,32,112,114,111,103,114,101,115,115,76,97,98,101,108,44,32,100,101,116,97,105,108,
+        115,41,59,10,32,32,32,32,114,101,116,117,114,110,32,119,114,97,112,112,101,114,59,10,
+        125,10,102,117,110,99,116,105,111,110,32,114,101,110,100,101,114,84,111,114,114,101,110,116,
+        115,40,116,111,114,114,101,110,116,115,41,32,123,10,32,32,32,32,105,102,32,40,33,116,
+        111,114,114,101,110,116,115,67,111,110,116,97,105,110,101,114,32,124,124,32,33,101,109,112,
+        116,121,83,116,97,116,101,41,32,123,10,32,32,32,32,32,32,32,32,114,101,116,117,114,
+        110,59,10,32,32,32,32,125,10,32,32,32,32,116,111,114,114,101,110,116,115,67,111,110,
+        116,97,105,110,101,114,46,114,101,112,108,97,99,101,67,104,105,108,100,114,101,110,40,41,
+        59,10,32,32,32,32,105,102,32,40,116,111,114,114,101,110,116,115,46,108,101,110,103,116,
+        104,32,61,61,61,32,48,41,32,123,10,32,32,32,32,32,32,32,32,101,109,112,116,121,
+        83,116,97,116,101,46,104,105,100,100,101,110,32,61,32,102,97,108,115,101,59,10,32,32,
+        32,32,32,32,32,32,114,101,116,117,114,110,59,10,32,32,32,32,125,10,32,32,32,32,
+        101,109,112,116,121,83,116,97,116,101,46,104,105,100,100,101,110,32,61,32,116,114,117,101,
+        59,10,32,32,32,32,99,111,110,115,116,32,102,114,97,103,109,101,110,116,32,61,32,100,
+        111,99,117,109,101,110,116,46,99,114,101,97,116,101,68,111,99,117,109,101,110,116,70,114,
+        97,103,109,101,110,116,40,41,59,10,32,32,32,32,116,111,114,114,101,110,116,115,46,102,
+        111,114,69,97,99,104,40,40,116,111,114,114,101,110,116,41,32,61,62,32,102,114,97,103,
+        109,101,110,116,46,97,112,112,101,110,100,67,104,105,108,100,40,114,101,110,100,101,114,84,
+        111,114,114,101,110,116,40,116,111,114,114,101,110,116,41,41,41,59,10,32,32,32,32,116,
+        111,114,114,101,110,116,115,67,111,110,116,97,105,110,101,114,46,97,112,112,101,110,100,67,
+        104,105,108,100,40,102,114,97,103,109,101,110,116,41,59,10,125,10,97,115,121,110,99,32,
+        102,117,110,99,116,105,111,110,32,104,97,110,100,108,101,84,111,114,114,101,110,116,65,99,
+        116,105,111,110,40,97,99,116,105,111,110,44,32,116,111,114,114,101,110,116,73,100,44,32,
+        98,117,116,116,111,110,41,32,123,10,32,32,32,32,98,117,116,116,111,110,46,100,105,115,
+        97,98,108,101,100,32,61,32,116,114,117,101,59,10,32,32,32,32,116,114,121,32,123,10,
+        32,32,32,32,32,32,32,32,99,111,110,115,116,32,112,97,116,104,32,61,32,97,99,116,
+        105,111,110,32,61,61,61,32,34,114,101,109,111,118,101,34,10,32,32,32,32,32,32,32,
+        32,32,32,32,32,63,32,96,47,97,112,105,47,116,111,114,114,101,110,116,115,47,36,123,
+        116,111,114,114,101,110,116,73,100,125,96,10,32,32,32,32,32,32,32,32,32,32,32,32,
+        58,32,96,47,97,112,105,47,116,111,114,114,101,110,116,115,47,36,123,116,111,114,114,101,
+        110,116,73,100,125,47,36,123,97,99,116,105,111,110,125,96,59,10,32,32,32,32,32,32,
+        32,32,99,111,110,115,116,32,109,101,116,104,111,100,32,61,32,97,99,116,105,111,110,32,
+        61,61,61,32,34,114,101,109,111,118,101,34,32,63,32,34,68,69,76,69,84,69,34,32,
+        58,32,34,80,79,83,84,34,59,10,32,32,32,32,32,32,32,32,99,111,110,115,116,32,
+        114,101,115,112,111,110,115,101,32,61,32,97,119,97,105,116,32,102,101,116,99,104,40,112,
+        97,116,104,44,32,123,32,109,101,116,104,111,100,32,125,41,59,10,32,32,32,32,32,32,
+        32,32,105,102,32,40,33,114,101,115,112,111,110,115,101,46,111,107,41,32,123,10,32,32,
+        32,32,32,32,32,32,32,32,32,32,116,104,114,111,119,32,110,101,119,32,69,114,114,111,
+        114,40,96,65,99,116,105,111,110,32,36,123,97,99,116,105,111,110,125,32,102,97,105,108,
+        101,100,32,40,36,123,114,101,115,112,111,110,115,101,46,115,116,97,116,117,115,125,41,96,
+        41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,97,119,97,
+        105,116,32,102,101,116,99,104,83,110,97,112,115,104,111,116,40,41,59,10,32,32,32,32,
+        32,32,32,32,115,104,111,119,84,111,97,115,116,40,96,84,111,114,114,101,110,116,32,36,
+        123,97,99,116,105,111,110,125,96,44,32,34,115,117,99,99,101,115,115,34,41,59,10,32,
+        32,32,32,125,10,32,32,32,32,99,97,116,99,104,32,40,101,114,114,111,114,41,32,123,
+        10,32,32,32,32,32,32,32,32,99,111,110,115,111,108,101,46,101,114,114,111,114,40,101,
+        114,114,111,114,41,59,10,32,32,32,32,32,32,32,32,115,104,111,119,84,111,97,115,116,
+        40,34,65,99,116,105,111,110,32,102,97,105,108,101,100,34,44,32,34,101,114,114,111,114,
+        34,41,59,10,32,32,32,32,125,10,32,32,32,32,102,105,110,97,108,108,121,32,123,10,
+        32,32,32,32,32,32,32,32,98,117,116,116,111,110,46,100,105,115,97,98,108,101,100,32,
+        61,32,102,97,108,115,101,59,10,32,32,32,32,125,10,125,10,97,115,121,110,99,32,102,
+        117,110,99,116,105,111,110,32,102,101,116,99,104,83,110,97,112,115,104,111,116,40,41,32,
+        123,10,32,32,32,32,116,114,121,32,123,10,32,32,32,32,32,32,32,32,99,111,110,115,
+        116,32,114,101,115,112,111,110,115,101,32,61,32,97,119,97,105,116,32,102,101,116,99,104,
+        40,34,47,97,112,105,47,116,111,114,114,101,110,116,115,34,41,59,10,32,32,32,32,32,
+        32,32,32,105,102,32,40,33,114,101,115,112,111,110,115,101,46,111,107,41,32,123,10,32,
+        32,32,32,32,32,32,32,32,32,32,32,116,104,114,111,119,32,110,101,119,32,69,114,114,
+        111,114,40,96,72,84,84,80,32,36,123,114,101,115,112,111,110,115,101,46,115,116,97,116,
+        117,115,125,96,41,59,10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,
+        32,99,111,110,115,116,32,115,110,97,112,115,104,111,116,32,61,32,97,119,97,105,116,32,
+        114,101,115,112,111,110,115,101,46,106,115,111,110,40,41,59,10,32,32,32,32,32,32,32,
+        32,97,112,112,83,116,97,116,101,46,115,110,97,112,115,104,111,116,32,61,32,115,110,97,
+        112,115,104,111,116,59,10,32,32,32,32,32,32,32,32,97,112,112,108,121,83,110,97,112,
+        115,104,111,116,40,115,110,97,112,115,104,111,116,41,59,10,32,32,32,32,125,10,32,32,
+        32,32,99,97,116,99,104,32,40,101,114,114,111,114,41,32,123,10,32,32,32,32,32,32,
+        32,32,99,111,110,115,111,108,101,46,101,114,114,111,114,40,101,114,114,111,114,41,59,10,
+        32,32,32,32,32,32,32,32,115,104,111,119,84,111,97,115,116,40,34,70,97,105,108,101,
+        100,32,116,111,32,108,111,97,100,32,116,111,114,114,101,110,116,115,34,44,32,34,101,114,
+        114,111,114,34,41,59,10,32,32,32,32,125,10,125,10,102,117,110,99,116,105,111,110,32,
+        97,112,112,108,121,83,110,97,112,115,104,111,116,40,115,110,97,112,115,104,111,116,41,32,
+        123,10,32,32,32,32,117,112,100,97,116,101,83,116,97,116,115,40,115,110,97,112,115,104,
+        111,116,46,115,116,97,116,115,41,59,10,32,32,32,32,114,101,110,100,101,114,84,111,114,
+        114,101,110,116,115,40,115,110,97,112,115,104,111,116,46,116,111,114,114,101,110,116,115,41,
+        59,10,125,10,47,47,32,66,105,110,97,114,121,32,102,114,97,109,101,115,32,40,115,101,
+        101,32,98,117,105,108,100,95,119,115,95,98,105,110,97,114,121,95,102,114,97,109,101,32,
+        105,110,32,115,114,99,47,110,101,116,47,104,116,116,112,95,115,101,114,118,101,114,46,99,
+        112,112,41,32,97,114,101,10,47,47,32,100,101,99,111,100,101,100,32,105,110,116,111,32,
+        116,104,101,32,115,97,109,101,32,115,104,97,112,101,115,32,97,115,32,116,104,101,32,74,
+        83,79,78,32,102,114,97,109,101,115,46,10,99,111,110,115,116,32,98,105,110,97,114,121,
+        80,114,111,116,111,99,111,108,32,61,32,34,114,97,119,98,105,116,46,98,105,110,46,118,
+        49,34,59,10,99,111,110,115,116,32,98,105,110,97,114,121,70,114,97,109,101,77,97,103,
+        105,99,32,61,32,48,120,51,49,53,55,52,50,53,50,59,10,99,111,110,115,116,32,98,
+        105,110,97,114,121,70,114,97,109,101,75,105,110,100,115,32,61,32,91,34,102,117,108,108,
+        34,44,32,34,114,101,115,121,110,99,34,44,32,34,112,97,116,99,104,34,93,59,10,99,
+        111,110,115,116,32,98,105,110,97,114,121,83,116,114,105,110,103,65,98,115,101,110,116,32,
+        61,32,48,120,102,102,102,102,59,10,99,111,110,115,116,32,117,116,102,56,32,61,32,110,
+        101,119,32,84,101,120,116,68,101,99,111,100,101,114,40,41,59,10,102,117,110,99,116,105,
+        111,110,32,114,101,97,100,85,105,110,116,54,52,40,118,105,101,119,44,32,111,102,102,115,
+        101,116,41,32,123,10,32,32,32,32,114,101,116,117,114,110,32,118,105,101,119,46,103,101,
+        116,85,105,110,116,51,50,40,111,102,102,115,101,116,44,32,116,114,117,101,41,32,43,32,
+        118,105,101,119,46,103,101,116,85,105,110,116,51,50,40,111,102,102,115,101,116,32,43,32,
+        52,44,32,116,114,117,101,41,32,42,32,52,50,57,52,57,54,55,50,57,54,59,10,125,
+        10,102,117,110,99,116,105,111,110,32,100,101,99,111,100,101,66,105,110,97,114,121,70,114,
+        97,109,101,40,98,117,102,102,101,114,41,32,123,10,32,32,32,32,118,97,114,32,95,97,
+        59,10,32,32,32,32,99,111,110,115,116,32,118,105,101,119,32,61,32,110,101,119,32,68,
+        97,116,97,86,105,101,119,40,98,117,102,102,101,114,41,59,10,32,32,32,32,105,102,32,
+        40,118,105,101,119,46,103,101,116,85,105,110,116,51,50,40,48,44,32,116,114,117,101,41,
+        32,33,61,61,32,98,105,110,97,114,121,70,114,97,109,101,77,97,103,105,99,41,32,123,
+        10,32,32,32,32,32,32,32,32,116,104,114,111,119,32,110,101,119,32,69,114,114,111,114,
+        40,34,85,110,107,110,111,119,110,32,98,105,110,97,114,121,32,102,114,97,109,101,34,41,
+        59,10,32,32,32,32,125,10,32,32,32,32,99,111,110,115,116,32,116,121,112,101,32,61,
+        32,98,105,110,97,114,121,70,114,97,109,101,75,105,110,100,115,91,118,105,101,119,46,103,
+        101,116,85,105,110,116,56,40,52,41,93,59,10,32,32,32,32,99,111,110,115,116,32,102,
+        108,97,103,115,32,61,32,118,105,101,119,46,103,101,116,85,105,110,116,56,40,53,41,59,
+        10,32,32,32,32,99,111,110,115,116,32,114,101,99,111,114,100,83,105,122,101,32,61,32,
+        118,105,101,119,46,103,101,116,85,105,110,116,49,54,40,54,44,32,116,114,117,101,41,59,
+        10,32,32,32,32,99,111,110,115,116,32,115,101,113,32,61,32,114,101,97,100,85,105,110,
+        116,54,52,40,118,105,101,119,44,32,56,41,59,10,32,32,32,32,108,101,116,32,111,102,
+        102,115,101,116,32,61,32,49,54,59,10,32,32,32,32,108,101,116,32,115,116,97,116,115,
+        59,10,32,32,32,32,105,102,32,40,102,108,97,103,115,32,38,32,49,41,32,123,10,32,
+        32,32,32,32,32,32,32,115,116,97,116,115,32,61,32,123,10,32,32,32,32,32,32,32,
+        32,32,32,32,32,112,111,114,116,58,32,118,105,101,119,46,103,101,116,85,105,110,116,51,
+        50,40,111,102,102,115,101,116,44,32,116,114,117,101,41,44,10,32,32,32,32,32,32,32,
+        32,32,32,32,32,116,111,114,114,101,110,116,95,99,111,117,110,116,58,32,118,105,101,119,
+        46,103,101,116,85,105,110,116,51,50,40,111,102,102,115,101,116,32,43,32,52,44,32,116,
+        114,117,101,41,44,10,32,32,32,32,32,32,32,32,32,32,32,32,97,99,116,105,118,101,
+        58,32,118,105,101,119,46,103,101,116,85,105,110,116,51,50,40,111,102,102,115,101,116,32,
+        43,32,56,44,32,116,114,117,101,41,44,10,32,32,32,32,32,32,32,32,32,32,32,32,
+        100,111,119,110,108,111,97,100,95,114,97,116,101,58,32,114,101,97,100,85,105,110,116,54,
+        52,40,118,105,101,119,44,32,111,102,102,115,101,116,32,43,32,49,54,41,44,10,32,32,
+        32,32,32,32,32,32,32,32,32,32,117,112,108,111,97,100,95,114,97,116,101,58,32,114,
+        101,97,100,85,105,110,116,54,52,40,118,105,101,119,44,32,111,102,102,115,101,116,32,43,
+        32,50,52,41,10,32,32,32,32,32,32,32,32,125,59,10,32,32,32,32,32,32,32,32,
+        111,102,102,115,101,116,32,43,61,32,51,50,59,10,32,32,32,32,125,10,32,32,32,32,
+        99,111,110,115,116,32,114,111,119,115,32,61,32,110,101,119,32,77,97,112,40,41,59,10,
+        32,32,32,32,99,111,110,115,116,32,114,101,99,111,114,100,67,111,117,110,116,32,61,32,
+        118,105,101,119,46,103,101,116,85,105,110,116,51,50,40,111,102,102,115,101,116,44,32,116,
+        114,117,101,41,59,10,32,32,32,32,111,102,102,115,101,116,32,43,61,32,52,59,10,32,
+        32,32,32,102,111,114,32,40,108,101,116,32,105,32,61,32,48,59,32,105,32,60,32,114,
+        101,99,111,114,100,67,111,117,110,116,59,32,105,43,43,44,32,111,102,102,115,101,116,32,
+        43,61,32,114,101,99,111,114,100,83,105,122,101,41,32,123,10,32,32,32,32,32,32,32,
+        32,99,111,110,115,116,32,105,100,32,61,32,118,105,101,119,46,103,101,116,85,105,110,116,
+        51,50,40,111,102,102,115,101,116,44,32,116,114,117,101,41,59,10,32,32,32,32,32,32,
+        32,32,99,111,110,115,116,32,114,101,99,111,114,100,70,108,97,103,115,32,61,32,118,105,
+        101,119,46,103,101,116,85,105,110,116,51,50,40,111,102,102,115,101,116,32,43,32,52,44,
+        32,116,114,117,101,41,59,10,32,32,32,32,32,32,32,32,114,111,119,115,46,115,101,116,
+        40,105,100,44,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,105,100,44,10,32,
+        32,32,32,32,32,32,32,32,32,32,32,112,114,111,103,114,101,115,115,58,32,118,105,101,
+        119,46,103,101,116,70,108,111,97,116,51,50,40,111,102,102,115,101,116,32,43,32,56,44,
+        32,116,114,117,101,41,44,10,32,32,32,32,32,32,32,32,32,32,32,32,100,111,119,110,
+        108,111,97,100,95,114,97,116,101,58,32,118,105,101,119,46,103,101,116,85,105,110,116,51,
+        50,40,111,102,102,115,101,116,32,43,32,49,50,44,32,116,114,117,101,41,44,10,32,32,
+        32,32,32,32,32,32,32,32,32,32,117,112,108,111,97,100,95,114,97,116,101,58,32,118,
+        105,101,119,46,103,101,116,85,105,110,116,51,50,40,111,102,102,115,101,116,32,43,32,49,
+        54,44,32,116,114,117,101,41,44,10,32,32,32,32,32,32,32,32,32,32,32,32,115,105,
+        122,101,58,32,114,101,97,100,85,105,110,116,54,52,40,118,105,101,119,44,32,111,102,102,
+        115,101,116,32,43,32,50,52,41,44,10,32,32,32,32,32,32,32,32,32,32,32,32,100,
+        111,119,110,108,111,97,100,101,100,58,32,114,101,97,100,85,105,110,116,54,52,40,118,105,
+        101,119,44,32,111,102,102,115,101,116,32,43,32,51,50,41,44,10,32,32,32,32,32,32,
+        32,32,32,32,32,32,112,97,117,115,101,100,58,32,40,114,101,99,111,114,100,70,108,97,
+        103,115,32,38,32,49,41,32,33,61,61,32,48,44,10,32,32,32,32,32,32,32,32,32,
+        32,32,32,99,111,109,112,108,101,116,101,58,32,40,114,101,99,111,114,100,70,108,97,103,
+        115,32,38,32,50,41,32,33,61,61,32,48,10,32,32,32,32,32,32,32,32,125,41,59,
+        10,32,32,32,32,125,10,32,32,32,32,99,111,110,115,116,32,114,101,109,111,118,101,100,
+        32,61,32,91,93,59,10,32,32,32,32,99,111,110,115,116,32,114,101,109,111,118,101,100,
+        67,111,117,110,116,32,61,32,118,105,101,119,46,103,101,116,85,105,110,116,51,50,40,111,
+        102,102,115,101,116,44,32,116,114,117,101,41,59,10,32,32,32,32,111,102,102,115,101,116,
+        32,43,61,32,52,59,10,32,32,32,32,102,111,114,32,40,108,101,116,32,105,32,61,32,
+        48,59,32,105,32,60,32,114,101,109,111,118,101,100,67,111,117,110,116,59,32,105,43,43,
+        44,32,111,102,102,115,101,116,32,43,61,32,52,41,32,123,10,32,32,32,32,32,32,32,
+        32,114,101,109,111,118,101,100,46,112,117,115,104,40,118,105,101,119,46,103,101,116,85,105,
+        110,116,51,50,40,111,102,102,115,101,116,44,32,116,114,117,101,41,41,59,10,32,32,32,
+        32,125,10,32,32,32,32,105,102,32,40,102,108,97,103,115,32,38,32,50,41,32,123,10,
+        32,32,32,32,32,32,32,32,99,111,110,115,116,32,114,101,97,100,83,116,114,105,110,103,
+        32,61,32,40,41,32,61,62,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,99,
+        111,110,115,116,32,108,101,110,103,116,104,32,61,32,118,105,101,119,46,103,101,116,85,105,
+        110,116,49,54,40,111,102,102,115,101,116,44,32,116,114,117,101,41,59,10,32,32,32,32,
+        32,32,32,32,32,32,32,32,111,102,102,115,101,116,32,43,61,32,50,59,10,32,32,32,
+        32,32,32,32,32,32,32,32,32,105,102,32,40,108,101,110,103,116,104,32,61,61,61,32,
+        98,105,110,97,114,121,83,116,114,105,110,103,65,98,115,101,110,116,41,32,123,10,32,32,
+        32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,101,116,117,114,110,32,117,110,100,
+        101,102,105,110,101,100,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,
+        32,32,32,32,32,32,32,32,32,32,99,111,110,115,116,32,116,101,120,116,32,61,32,117,
+        116,102,56,46,100,101,99,111,100,101,40,110,101,119,32,85,105,110,116,56,65,114,114,97,
+        121,40,98,117,102,102,101,114,44,32,111,102,102,115,101,116,44,32,108,101,110,103,116,104,
+        41,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,111,102,102,115,101,116,32,43,
+        61,32,108,101,110,103,116,104,59,10,32,32,32,32,32,32,32,32,32,32,32,32,114,101,
+        116,117,114,110,32,116,101,120,116,59,10,32,32,32,32,32,32,32,32,125,59,10,32,32,
+        32,32,32,32,32,32,99,111,110,115,116,32,115,116,114,105,110,103,67,111,117,110,116,32,
+        61,32,118,105,101,119,46,103,101,116,85,105,110,116,51,50,40,111,102,102,115,101,116,44,
+        32,116,114,117,101,41,59,10,32,32,32,32,32,32,32,32,111,102,102,115,101,116,32,43,
+        61,32,52,59,10,32,32,32,32,32,32,32,32,102,111,114,32,40,108,101,116,32,105,32,
+        61,32,48,59,32,105,32,60,32,115,116,114,105,110,103,67,111,117,110,116,59,32,105,43,
+        43,41,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,99,111,110,115,116,32,105,
+        100,32,61,32,118,105,101,119,46,103,101,116,85,105,110,116,51,50,40,111,102,102,115,101,
+        116,44,32,116,114,117,101,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,111,102,
+        102,115,101,116,32,43,61,32,52,59,10,32,32,32,32,32,32,32,32,32,32,32,32,99,
+        111,110,115,116,32,114,111,119,32,61,32,40,95,97,32,61,32,114,111,119,115,46,103,101,
+        116,40,105,100,41,41,32,33,61,61,32,110,117,108,108,32,38,38,32,95,97,32,33,61,
+        61,32,118,111,105,100,32,48,32,63,32,95,97,32,58,32,123,32,105,100,32,125,59,10,
+        32,32,32,32,32,32,32,32,32,32,32,32,99,111,110,115,116,32,110,97,109,101,32,61,
+        32,114,101,97,100,83,116,114,105,110,103,40,41,59,10,32,32,32,32,32,32,32,32,32,
+        32,32,32,99,111,110,115,116,32,109,97,103,110,101,116,32,61,32,114,101,97,100,83,116,
+        114,105,110,103,40,41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,105,102,32,40,
+        110,97,109,101,32,33,61,61,32,117,110,100,101,102,105,110,101,100,41,32,123,10,32,32,
+        32,32,32,32,32,32,32,32,32,32,32,32,32,32,114,111,119,46,110,97,109,101,32,61,
+        32,110,97,109,101,59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,
+        32,32,32,32,32,32,32,32,32,105,102,32,40,109,97,103,110,101,116,32,33,61,61,32,
+        117,110,100,101,102,105,110,101,100,41,32,123,10,32,32,32,32,32,32,32,32,32,32,32,
+        32,32,32,32,32,114,111,119,46,109,97,103,110,101,116,32,61,32,109,97,103,110,101,116,
+        59,10,32,32,32,32,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,
+        32,32,32,32,114,111,119,115,46,115,101,116,40,105,100,44,32,114,111,119,41,59,10,32,
+        32,32,32,32,32,32,32,125,10,32,32,32,32,125,10,32,32,32,32,105,102,32,40,116,
+        121,112,101,32,61,61,61,32,34,112,97,116,99,104,34,41,32,123,10,32,32,32,32,32,
+        32,32,32,47,47,32,82,101,99,111,114,100,115,32,100,111,32,110,111,116,32,115,97,121,
+        32,119,104,101,116,104,101,114,32,97,32,114,111,119,32,105,115,32,110,101,119,59,32,97,
+        112,112,108,121,76,105,118,101,70,114,97,109,101,32,117,112,115,101,114,116,115,46,10,32,
+        32,32,32,32,32,32,32,114,101,116,117,114,110,32,123,32,116,121,112,101,44,32,115,101,
+        113,44,32,115,116,97,116,115,44,32,97,100,100,101,100,58,32,91,93,44,32,117,112,100,
+        97,116,101,100,58,32,65,114,114,97,121,46,102,114,111,109,40,114,111,119,115,46,118,97,
+        108,117,101,115,40,41,41,44,32,114,101,109,111,118,101,100,32,125,59,10,32,32,32,32,
+        125,10,32,32,32,32,99,111,110,115,116,32,116,111,114,114,101,110,116,115,32,61,32,65,
+        114,114,97,121,46,102,114,111,109,40,114,111,119,115,46,118,97,108,117,101,115,40,41,41,
+        46,109,97,112,40,40,114,111,119,41,32,61,62,32,40,79,98,106,101,99,116,46,97,115,
+        115,105,103,110,40,123,32,110,97,109,101,58,32,34,34,44,32,109,97,103,110,101,116,58,
+        32,34,34,32,125,44,32,114,111,119,41,41,41,59,10,32,32,32,32,114,101,116,117,114,
+        110,32,123,32,116,121,112,101,44,32,115,101,113,44,32,115,116,97,116,115,58,32,115,116,
+        97,116,115,44,32,116,111,114,114,101,110,116,115,32,125,59,10,125,10,102,117,110,99,116,
+        105,111,110,32,112,117,98,108,105,115,104,76,105,118,101,83,116,97,116,101,40,41,32,123,
+        10,32,32,32,32,105,102,32,40,33,108,105,118,101,46,115,116,97,116,115,41,32,123,10,
+        32,32,32,32,32,32,32,32,114,101,116,117,114,110,59,10,32,32,32,32,125,10,32,32,
+        32,32,99,111,110,115,116,32,116,111,114,114,101,110,116,115,32,61,32,65,114,114,97,121,
+        46,102,114,111,109,40,108,105,118,101,46,116,111,114,114,101,110,116,115,46,118,97,108,117,
+        101,115,40,41,41,46,115,111,114,116,40,40,97,44,32,98,41,32,61,62,32,97,46,105,
+        100,32,45,32,98,46,105,100,41,59,10,32,32,32,32,99,111,110,115,116,32,115,110,97,
+        112,115,104,111,116,32,61,32,123,32,115,116,97,116,115,58,32,108,105,118,101,46,115,116,
+        97,116,115,44,32,116,111,114,114,101,110,116,115,32,125,59,10,32,32,32,32,97,112,112,
+        83,116,97,116,101,46,115,110,97,112,115,104,111,116,32,61,32,115,110,97,112,115,104,111,
+        116,59,10,32,32,32,32,97,112,112,108,121,83,110,97,112,115,104,111,116,40,115,110,97,
+        112,115,104,111,116,41,59,10,125,10,102,117,110,99,116,105,111,110,32,97,112,112,108,121,
+        76,105,118,101,70,114,97,109,101,40,115,111,99,107,101,116,44,32,102,114,97,109,101,41,
+        32,123,10,32,32,32,32,105,102,32,40,102,114,97,109,101,46,116,121,112,101,32,61,61,
+        61,32,34,102,117,108,108,34,32,124,124,32,102,114,97,109,101,46,116,121,112,101,32,61,
+        61,61,32,34,114,101,115,121,110,99,34,41,32,123,10,32,32,32,32,32,32,32,32,108,
+        105,118,101,46,115,101,113,32,61,32,102,114,97,109,101,46,115,101,113,59,10,32,32,32,
+        32,32,32,32,32,108,105,118,101,46,115,116,97,116,115,32,61,32,102,114,97,109,101,46,
+        115,116,97,116,115,59,10,32,32,32,32,32,32,32,32,108,105,118,101,46,116,111,114,114,
+        101,110,116,115,46,99,108,101,97,114,40,41,59,10,32,32,32,32,32,32,32,32,102,114,
+        97,109,101,46,116,111,114,114,101,110,116,115,46,102,111,114,69,97,99,104,40,40,116,111,
+        114,114,101,110,116,41,32,61,62,32,108,105,118,101,46,116,111,114,114,101,110,116,115,46,
+        115,101,116,40,116,111,114,114,101,110,116,46,105,100,44,32,116,111,114,114,101,110,116,41,
+        41,59,10,32,32,32,32,32,32,32,32,112,117,98,108,105,115,104,76,105,118,101,83,116,
+        97,116,101,40,41,59,10,32,32,32,32,32,32,32,32,114,101,116,117,114,110,59,10,32,
+        32,32,32,125,10,32,32,32,32,105,102,32,40,102,114,97,109,101,46,115,101,113,32,33,
+        61,61,32,108,105,118,101,46,115,101,113,32,43,32,49,41,32,123,10,32,32,32,32,32,
+        32,32,32,47,47,32,77,105,115,115,101,100,32,97,32,112,97,116,99,104,59,32,97,115,
+        107,32,102,111,114,32,116,104,101,32,119,104,111,108,101,32,115,116,97,116,101,32,105,110,
+        115,116,101,97,100,32,111,102,32,103,117,101,115,115,105,110,103,46,10,32,32,32,32,32,
+        32,32,32,115,111,99,107,101,116,46,115,101,110,100,40,74,83,79,78,46,115,116,114,105,
+        110,103,105,102,121,40,123,32,116,121,112,101,58,32,34,114,101,115,121,110,99,34,32,125,
+        41,41,59,10,32,32,32,32,32,32,32,32,114,101,116,117,114,110,59,10,32,32,32,32,
+        125,10,32,32,32,32,108,105,118,101,46,115,101,113,32,61,32,102,114,97,109,101,46,115,
+        101,113,59,10,32,32,32,32,105,102,32,40,102,114,97,109,101,46,115,116,97,116,115,41,
+        32,123,10,32,32,32,32,32,32,32,32,108,105,118,101,46,115,116,97,116,115,32,61,32,
+        102,114,97,109,101,46,115,116,97,116,115,59,10,32,32,32,32,125,10,32,32,32,32,102,
+        114,97,109,101,46,114,101,109,111,118,101,100,46,102,111,114,69,97,99,104,40,40,105,100,
+        41,32,61,62,32,108,105,118,101,46,116,111,114,114,101,110,116,115,46,100,101,108,101,116,
+        101,40,105,100,41,41,59,10,32,32,32,32,102,114,97,109,101,46,97,100,100,101,100,46,
+        102,111,114,69,97,99,104,40,40,116,111,114,114,101,110,116,41,32,61,62,32,108,105,118,
+        101,46,116,111,114,114,101,110,116,115,46,115,101,116,40,116,111,114,114,101,110,116,46,105,
+        100,44,32,116,111,114,114,101,110,116,41,41,59,10,32,32,32,32,102,114,97,109,101,46,
+        117,112,100,97,116,101,100,46,102,111,114,69,97,99,104,40,40,99,104,97,110,103,101,115,
+        41,32,61,62,32,123,10,32,32,32,32,32,32,32,32,99,111,110,115,116,32,99,117,114,
+        114,101,110,116,32,61,32,108,105,118,101,46,116,111,114,114,101,110,116,115,46,103,101,116,
+        40,99,104,97,110,103,101,115,46,105,100,41,59,10,32,32,32,32,32,32,32,32,108,105,
+        118,101,46,116,111,114,114,101,110,116,115,46,115,101,116,40,99,104,97,110,103,101,115,46,
+        105,100,44,32,79,98,106,101,99,116,46,97,115,115,105,103,110,40,79,98,106,101,99,116,
+        46,97,115,115,105,103,110,40,123,125,44,32,99,117,114,114,101,110,116,41,44,32,99,104,
+        97,110,103,101,115,41,41,59,10,32,32,32,32,125,41,59,10,32,32,32,32,112,117,98,
+        108,105,115,104,76,105,118,101,83,116,97,116,101,40,41,59,10,125,10,102,117,110,99,116,
+        105,111,110,32,114,101,97,100,83,105,122,101,73,110,66,121,116,101,115,40,41,32,123,10,
+        32,32,32,32,105,102,32,40,33,115,105,122,101,73,110,112,117,116,41,32,123,10,32,32,
+        32,32,32,32,32,32,114,101,116,117,114,110,32,48,59,10,32,32,32,32,125,10,32,32,
+        32,32,99,111,110,115,116,32,118,97,108,117,101,32,61,32,112,97,114,115,101,70,108,111,
+        97,116,40,115,105,122,101,73,110,112,117,116,46,118,97,108,117,101,41,59,10,32,32,32,
+        32,105,102,32,40,33,78,117,109,98,101,114,46,105,115,70,105,110,105,116,101,40,118,97,
+        108,117,101,41,32,124,124,32,118,97,108,117,101,32,60,61,32,48,41,32,123,10,32,32,
+        32,32,32,32,32,32,114,101,116,117,114,110,32,48,59,10,32,32,32,32,125,10,32,32,
+        32,32,114,101,116,117,114,110,32,77,97,116,104,46,114,111,117,110,100,40,118,97,108,117,
+        101,32,42,32,49,48,50,52,32,42,32,49,48,50,52,41,59,10,125,10,97,115,121,110,
+        99,32,102,117,110,99,116,105,111,110,32,115,117,98,109,105,116,65,100,100,70,111,114,109,
+        40,101,118,101,110,116,41,32,123,10,32,32,32,32,101,118,101,110,116,46,112,114,101,118,
+        101,110,116,68,101,102,97,117,108,116,40,41,59,10,32,32,32,32,105,102,32,40,33,109,
+        97,103,110,101,116,73,110,112,117,116,32,124,124,32,33,109,97,103,110,101,116,73,110,112,
+        117,116,46,118,97,108,117,101,46,116,114,105,109,40,41,41,32,123,10,32,32,32,32,32,
+        32,32,32,115,104,111,119,84,111,97,115,116,40,34,80,114,111,118,105,100,101,32,97,32,
+        109,97,103,110,101,116,32,85,82,73,34,44,32,34,101,114,114,111,114,34,41,59,10,32,
+        32,32,32,32,32,32,32,114,101,116,117,114,110,59,10,32,32,32,32,125,10,32,32,32,
+        32,99,111,110,115,116,32,112,97,121,108,111,97,100,32,61,32,123,32,109,97,103,110,101,
+        116,58,32,109,97,103,110,101,116,73,110,112,117,116,46,118,97,108,117,101,46,116,114,105,
+        109,40,41,32,125,59,10,32,32,32,32,105,102,32,40,110,97,109,101,73,110,112,117,116,
+        32,38,38,32,110,97,109,101,73,110,112,117,116,46,118,97,108,117,101,46,116,114,105,109,
+        40,41,41,32,123,10,32,32,32,32,32,32,32,32,112,97,121,108,111,97,100,46,110,97,
+        109,101,32,61,32,110,97,109,101,73,110,112,117,116,46,118,97,108,117,101,46,116,114,105,
+        109,40,41,59,10,32,32,32,32,125,10,32,32,32,32,99,111,110,115,116,32,115,105,122,
+        101,66,121,116,101,115,32,61,32,114,101,97,100,83,105,122,101,73,110,66,121,116,101,115,
+        40,41,59,10,32,32,32,32,105,102,32,40,115,105,122,101,66,121,116,101,115,32,62,32,
+        48,41,32,123,10,32,32,32,32,32,32,32,32,112,97,121,108,111,97,100,46,115,105,122,
+        101,32,61,32,115,105,122,101,66,121,116,101,115,59,10,32,32,32,32,125,10,32,32,32,
+        32,97,100,100,70,111,114,109,32,61,61,61,32,110,117,108,108,32,124,124,32,97,100,100,
+        70,111,114,109,32,61,61,61,32,118,111,105,100,32,48,32,63,32,118,111,105,100,32,48,
+        32,58,32,97,100,100,70,111,114,109,46,99,108,97,115,115,76,105,115,116,46,97,100,100,
+        40,34,102,111,114,109,45,45,98,117,115,121,34,41,59,10,32,32,32,32,116,114,121,32,
+        123,10,32,32,32,32,32,32,32,32,99,111,110,115,116,32,114,101,115,112,111,110,115,101,
+        32,61,32,97,119,97,105,116,32,102,101,116,99,104,40,34,47,97,112,105,47,116,111,114,
+        114,101,110,116,115,34,44,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,109,101,
+        116,104,111,100,58,32,34,80,79,83,84,34,44,10,32,32,32,32,32,32,32,32,32,32,
+        32,32,104,101,97,100,101,114,115,58,32,123,32,34,67,111,110,116,101,110,116,45,84,121,
+        112,101,34,58,32,34,97,112,112,108,105,99,97,116,105,111,110,47,106,115,111,110,34,32,
+        125,44,10,32,32,32,32,32,32,32,32,32,32,32,32,98,111,100,121,58,32,74,83,79,
+        78,46,115,116,114,105,110,103,105,102,121,40,112,97,121,108,111,97,100,41,10,32,32,32,
+        32,32,32,32,32,125,41,59,10,32,32,32,32,32,32,32,32,105,102,32,40,33,114,101,
+        115,112,111,110,115,101,46,111,107,41,32,123,10,32,32,32,32,32,32,32,32,32,32,32,
+        32,116,104,114,111,119,32,110,101,119,32,69,114,114,111,114,40,96,72,84,84,80,32,36,
+        123,114,101,115,112,111,110,115,101,46,115,116,97,116,117,115,125,96,41,59,10,32,32,32,
+        32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,115,104,111,119,84,111,97,115,116,
+        40,34,84,111,114,114,101,110,116,32,97,100,100,101,100,34,44,32,34,115,117,99,99,101,
+        115,115,34,41,59,10,32,32,32,32,32,32,32,32,109,97,103,110,101,116,73,110,112,117,
+        116,46,118,97,108,117,101,32,61,32,34,34,59,10,32,32,32,32,32,32,32,32,105,102,
+        32,40,110,97,109,101,73,110,112,117,116,41,32,123,10,32,32,32,32,32,32,32,32,32,
+        32,32,32,110,97,109,101,73,110,112,117,116,46,118,97,108,117,101,32,61,32,34,34,59,
+        10,32,32,32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,105,102,32,40,115,
+        105,122,101,73,110,112,117,116,41,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,
+        115,105,122,101,73,110,112,117,116,46,118,97,108,117,101,32,61,32,34,34,59,10,32,32,
+        32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,97,119,97,105,116,32,102,101,
+        116,99,104,83,110,97,112,115,104,111,116,40,41,59,10,32,32,32,32,125,10,32,32,32,
+        32,99,97,116,99,104,32,40,101,114,114,111,114,41,32,123,10,32,32,32,32,32,32,32,
+        32,99,111,110,115,111,108,101,46,101,114,114,111,114,40,101,114,114,111,114,41,59,10,32,
+        32,32,32,32,32,32,32,115,104,111,119,84,111,97,115,116,40,34,65,100,100,32,116,111,
+        114,114,101,110,116,32,102,97,105,108,101,100,34,44,32,34,101,114,114,111,114,34,41,59,
+        10,32,32,32,32,125,10,32,32,32,32,102,105,110,97,108,108,121,32,123,10,32,32,32,
+        32,32,32,32,32,97,100,100,70,111,114,109,32,61,61,61,32,110,117,108,108,32,124,124,
+        32,97,100,100,70,111,114,109,32,61,61,61,32,118,111,105,100,32,48,32,63,32,118,111,
+        105,100,32,48,32,58,32,97,100,100,70,111,114,109,46,99,108,97,115,115,76,105,115,116,
+        46,114,101,109,111,118,101,40,34,102,111,114,109,45,45,98,117,115,121,34,41,59,10,32,
+        32,32,32,125,10,125,10,102,117,110,99,116,105,111,110,32,99,111,110,110,101,99,116,87,
+        101,98,83,111,99,107,101,116,40,41,32,123,10,32,32,32,32,99,111,110,115,116,32,112,
+        114,111,116,111,99,111,108,32,61,32,119,105,110,100,111,119,46,108,111,99,97,116,105,111,
+        110,46,112,114,111,116,111,99,111,108,32,61,61,61,32,34,104,116,116,112,115,58,34,32,
+        63,32,34,119,115,115,34,32,58,32,34,119,115,34,59,10,32,32,32,32,99,111,110,115,
+        116,32,117,114,108,32,61,32,96,36,123,112,114,111,116,111,99,111,108,125,58,47,47,36,
+        123,119,105,110,100,111,119,46,108,111,99,97,116,105,111,110,46,104,111,115,116,125,47,119,
+        115,96,59,10,32,32,32,32,105,102,32,40,97,112,112,83,116,97,116,101,46,119,115,41,
+        32,123,10,32,32,32,32,32,32,32,32,97,112,112,83,116,97,116,101,46,119,115,46,99,
+        108,111,115,101,40,41,59,10,32,32,32,32,32,32,32,32,97,112,112,83,116,97,116,101,
+        46,119,115,32,61,32,110,117,108,108,59,10,32,32,32,32,125,10,32,32,32,32,99,111,
+        110,115,116,32,115,111,99,107,101,116,32,61,32,110,101,119,32,87,101,98,83,111,99,107,
+        101,116,40,117,114,108,44,32,91,98,105,110,97,114,121,80,114,111,116,111,99,111,108,93,
+        41,59,10,32,32,32,32,115,111,99,107,101,116,46,98,105,110,97,114,121,84,121,112,101,
+        32,61,32,34,97,114,114,97,121,98,117,102,102,101,114,34,59,10,32,32,32,32,97,112,
+        112,83,116,97,116,101,46,119,115,32,61,32,115,111,99,107,101,116,59,10,32,32,32,32,
+        108,105,118,101,46,115,101,113,32,61,32,48,59,10,32,32,32,32,115,111,99,107,101,116,
+        46,97,100,100,69,118,101,110,116,76,105,115,116,101,110,101,114,40,34,111,112,101,110,34,
+        44,32,40,41,32,61,62,32,115,104,111,119,84,111,97,115,116,40,34,76,105,118,101,32,
+        117,112,100,97,116,101,115,32,99,111,110,110,101,99,116,101,100,34,44,32,34,105,110,102,
+        111,34,41,41,59,10,32,32,32,32,115,111,99,107,101,116,46,97,100,100,69,118,101,110,
+        116,76,105,115,116,101,110,101,114,40,34,109,101,115,115,97,103,101,34,44,32,40,101,118,
+        101,110,116,41,32,61,62,32,123,10,32,32,32,32,32,32,32,32,116,114,121,32,123,10,
+        32,32,32,32,32,32,32,32,32,32,32,32,99,111,110,115,116,32,102,114,97,109,101,32,
+        61,32,116,121,112,101,111,102,32,101,118,101,110,116,46,100,97,116,97,32,61,61,61,32,
+        34,115,116,114,105,110,103,34,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+        32,63,32,74,83,79,78,46,112,97,114,115,101,40,101,118,101,110,116,46,100,97,116,97,
+        41,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,58,32,100,101,99,111,
+        100,101,66,105,110,97,114,121,70,114,97,109,101,40,101,118,101,110,116,46,100,97,116,97,
+        41,59,10,32,32,32,32,32,32,32,32,32,32,32,32,97,112,112,108,121,76,105,118,101,
+        70,114,97,109,101,40,115,111,99,107,101,116,44,32,102,114,97,109,101,41,59,10,32,32,
+        32,32,32,32,32,32,125,10,32,32,32,32,32,32,32,32,99,97,116,99,104,32,40,101,
+        114,114,111,114,41,32,123,10,32,32,32,32,32,32,32,32,32,32,32,32,99,111,110,115,
+        111,108,101,46,101,114,114,111,114,40,34,70,97,105,108,101,100,32,116,111,32,112,97,114,
+        115,101,32,87,83,32,112,97,121,108,111,97,100,34,44,32,101,114,114,111,114,41,59,10,
+        32,32,32,32,32,32,32,32,125,10,32,32,32,32,125,41,59,10,32,32,32,32,115,111,
+        99,107,101,116,46,97,100,100,69,118,101,110,116,76,105,115,116,101,110,101,114,40,34,99,
+        108,111,115,101,34,44,32,40,41,32,61,62,32,115,99,104,101,100,117,108,101,82,101,99,
+        111,110,110,101,99,116,40,41,41,59,10,32,32,32,32,115,111,99,107,101,116,46,97,100,
+        100,69,118,101,110,116,76,105,115,116,101,110,101,114,40,34,101,114,114,111,114,34,44,32,
+        40,41,32,61,62,32,115,111,99,107,101,116,46,99,108,111,115,101,40,41,41,59,10,125,
+        10,102,117,110,99,116,105,111,110,32,115,99,104,101,100,117,108,101,82,101,99,111,110,110,
+        101,99,116,40,41,32,123,10,32,32,32,32,105,102,32,40,97,112,112,83,116,97,116,101,
+        46,114,101,99,111,110,110,101,99,116,72,97,110,100,108,101,32,33,61,61,32,110,117,108,
+        108,41,32,123,10,32,32,32,32,32,32,32,32,119,105,110,100,111,119,46,99,108,101,97,
+        114,84,105,109,101,111,117,116,40,97,112,112,83,116,97,116,101,46,114,101,99,111,110,110,
+        101,99,116,72,97,110,100,108,101,41,59,10,32,32,32,32,125,10,32,32,32,32,97,112,
+        112,83,116,97,116,101,46,114,101,99,111,110,110,101,99,116,72,97,110,100,108,101,32,61,
+        32,119,105,110,100,111,119,46,115,101,116,84,105,109,101,111,117,116,40,40,41,32,61,62,
+        32,99,111,110,110,101,99,116,87,101,98,83,111,99,107,101,116,40,41,44,32,50,48,48,
+        48,41,59,10,125,10,97,100,100,70,111,114,109,32,61,61,61,32,110,117,108,108,32,124,
+        124,32,97,100,100,70,111,114,109,32,61,61,61,32,118,111,105,100,32,48,32,63,32,118,
+        111,105,100,32,48,32,58,32,97,100,100,70,111,114,109,46,97,100,100,69,118,101,110,116,
+        76,105,115,116,101,110,101,114,40,34,115,117,98,109,105,116,34,44,32,40,101,118,101,110,
+        116,41,32,61,62,32,123,10,32,32,32,32,118,111,105,100,32,115,117,98,109,105,116,65,
+        100,100,70,111,114,109,40,101,118,101,110,116,41,59,10,125,41,59,10,114,101,102,114,101,
+        115,104,66,117,116,116,111,110,32,61,61,61,32,110,117,108,108,32,124,124,32,114,101,102,
+        114,101,115,104,66,117,116,116,111,110,32,61,61,61,32,118,111,105,100,32,48,32,63,32,
+        118,111,105,100,32,48,32,58,32,114,101,102,114,101,115,104,66,117,116,116,111,110,46,97,
+        100,100,69,118,101,110,116,76,105,115,116,101,110,101,114,40,34,99,108,105,99,107,34,44,
+        32,40,41,32,61,62,32,123,10,32,32,32,32,118,111,105,100,32,102,101,116,99,104,83,
+        110,97,112,115,104,111,116,40,41,59,10,125,41,59,10,118,111,105,100,32,102,101,116,99,
+        104,83,110,97,112,115,104,111,116,40,41,59,10,99,111,110,110,101,99,116,87,101,98,83,
+        111,99,107,101,116,40,41,59,10,119,105,110,100,111,119,46,115,101,116,73,110,116,101,114,
+        118,97,108,40,40,41,32,61,62,32,118,111,105,100,32,102,101,116,99,104,83,110,97,112,
+        115,104,111,116,40,41,44,32,56,48,48,48,41,59,10,
+    };
+    const unsigned char kAsset0Gzip[] = {
+        31,139,8,0,0,0,0,0,2,3,181,59,93,115,219,70,146,239,250,21,109,68,231,5,
+        214,16,72,201,138,215,33,67,167,236,200,218,245,109,156,184,44,229,246,193,165,162,134,192,
+        80,156,53,8,32,152,129,104,30,195,170,125,218,247,173,251,7,247,211,242,75,174,122,62,
+        128,25,0,164,232,172,79,15,20,137,233,238,233,233,175,233,233,30,120,21,167,192,69,201,
+        98,225,141,143,226,60,227,2,184,32,130,95,50,154,38,28,38,176,217,142,143,146,60,174,
+        150,52,19,209,47,21,45,215,87,52,165,177,200,203,151,105,234,123,31,18,34,200,201,28,
+        161,111,188,32,154,231,229,107,18,47,124,63,203,19,26,192,228,5,108,142,0,0,20,101,
+        9,6,19,192,193,232,142,138,151,66,148,108,86,9,234,123,13,25,47,24,75,20,54,7,
+        95,62,8,52,13,252,179,120,251,160,38,213,228,20,206,246,104,27,152,101,148,116,94,82,
+        190,120,85,9,145,103,48,129,254,69,152,21,148,121,74,39,127,208,56,127,184,241,106,50,
+        34,47,75,154,9,254,125,158,9,194,50,90,30,72,202,224,217,180,232,178,16,235,43,65,
+        4,61,144,136,68,56,193,69,83,151,39,194,197,193,124,16,46,108,100,146,36,151,121,185,
+        220,131,254,21,73,146,147,121,94,46,27,164,37,185,203,168,120,147,21,213,190,121,191,82,
+        96,39,12,225,26,228,140,44,233,131,168,8,212,70,228,236,191,31,70,68,160,54,34,41,
+        10,35,102,101,59,60,35,5,95,228,98,4,89,149,166,161,124,182,226,246,175,146,198,121,
+        150,209,88,252,133,100,73,74,213,208,209,118,124,52,24,128,162,181,64,227,157,151,249,18,
+        196,130,194,223,232,236,42,143,63,82,244,151,146,146,101,8,31,233,154,38,48,91,27,147,
+        129,55,23,145,230,39,101,247,22,47,244,151,17,12,213,172,210,158,109,54,140,217,140,32,
+        163,43,120,75,10,63,64,38,230,85,22,11,150,103,128,106,33,226,213,90,80,238,223,147,
+        180,162,198,59,208,93,30,201,39,240,235,175,160,190,124,59,129,161,237,61,37,21,85,153,
+        129,55,132,87,158,113,152,198,59,171,140,9,244,248,15,222,43,47,4,239,175,242,243,173,
+        252,252,179,252,188,126,229,221,40,180,148,10,136,243,42,67,197,200,169,154,199,72,5,38,
+        48,84,79,86,11,150,82,240,21,236,139,9,156,14,207,206,225,241,99,5,245,173,154,50,
+        74,105,118,39,22,112,2,167,54,179,10,103,160,112,198,245,99,68,121,242,164,203,125,81,
+        210,152,113,38,93,221,154,14,133,161,88,154,76,96,8,223,193,16,70,112,58,62,178,196,
+        113,123,188,145,8,145,200,47,217,39,154,248,53,169,96,11,199,27,201,227,7,252,188,217,
+        222,142,143,182,109,93,188,39,130,254,91,170,24,112,71,25,13,87,93,93,111,7,188,143,
+        133,119,101,126,87,82,222,178,8,45,151,24,213,241,150,136,69,180,36,159,252,97,168,191,
+        179,204,63,13,161,230,114,24,4,109,161,248,136,250,71,56,29,14,131,90,52,167,193,246,
+        63,92,14,180,193,162,139,84,220,215,191,108,73,232,71,81,156,47,139,148,10,218,39,133,
+        239,245,152,35,8,27,185,32,21,167,73,31,234,59,57,210,39,65,239,34,95,101,105,78,
+        18,150,221,121,14,207,124,145,175,174,49,46,250,75,202,57,185,163,33,124,100,25,238,76,
+        30,203,230,185,231,40,82,6,208,238,204,246,132,18,36,18,244,147,192,93,130,74,183,208,
+        148,199,22,0,239,238,120,56,173,167,102,15,108,208,56,37,156,255,192,184,136,72,146,248,
+        158,124,120,114,114,207,56,155,165,212,236,144,43,150,37,249,10,201,94,179,37,205,43,225,
+        251,114,203,109,147,40,233,50,191,167,93,42,33,156,125,61,28,6,142,104,170,34,33,130,
+        162,54,185,47,131,147,89,249,61,41,97,74,66,152,206,66,152,198,33,76,147,16,166,122,
+        121,254,148,192,196,217,155,189,34,47,133,119,19,72,183,195,232,134,54,134,80,147,9,220,
+        231,44,145,174,168,191,140,96,74,162,146,22,41,137,233,247,11,150,38,37,205,252,58,220,
+        199,37,37,130,94,211,79,226,199,60,161,138,167,8,169,71,34,191,18,37,203,238,252,192,
+        216,174,63,157,181,249,208,6,52,149,30,222,97,104,182,139,161,217,103,50,228,76,211,203,
+        89,220,230,140,196,130,221,211,14,75,241,46,150,226,207,100,73,209,239,229,37,105,243,146,
+        104,79,153,150,68,116,89,74,118,177,148,28,204,146,21,42,21,119,206,140,22,107,180,205,
+        90,85,236,102,140,238,98,140,254,126,198,172,249,36,91,150,111,40,212,151,242,135,74,43,
+        253,148,204,104,26,2,145,207,66,19,12,223,36,33,36,140,147,89,74,81,212,115,146,242,
+        86,84,158,117,178,82,69,252,117,74,241,151,239,41,0,227,233,234,87,36,214,5,202,199,
+        12,58,99,210,221,127,36,75,9,96,204,113,170,24,115,33,221,56,37,87,224,140,91,156,
+        155,175,206,56,73,146,215,247,52,19,24,91,104,70,75,223,139,83,22,127,244,66,80,225,
+        103,33,19,168,107,197,130,146,150,223,35,32,69,173,181,237,168,135,142,212,75,154,37,180,
+        212,228,218,27,140,146,230,170,36,69,225,102,230,45,113,146,82,176,216,138,156,10,161,87,
+        104,222,248,160,173,203,33,97,71,106,137,114,114,98,112,204,148,106,167,160,41,167,15,108,
+        108,15,17,86,24,46,89,37,134,5,37,201,94,41,36,236,222,224,41,216,29,86,163,6,
+        181,32,244,145,131,137,148,190,74,243,248,227,97,244,45,172,61,8,139,167,6,94,66,182,
+        76,211,200,8,143,6,232,239,183,218,8,224,171,227,141,25,99,9,38,101,53,5,201,97,
+        132,2,204,18,233,251,190,124,236,48,181,164,130,236,225,169,48,44,33,220,14,1,225,144,
+        35,30,60,132,96,76,177,184,198,71,240,66,6,38,59,145,179,135,3,24,129,247,115,246,
+        49,203,87,153,36,225,89,51,187,178,184,125,115,1,206,170,225,183,127,252,47,28,111,204,
+        196,15,72,1,41,186,154,239,200,72,34,57,130,82,78,203,15,83,184,6,222,27,135,184,
+        229,91,143,218,206,133,26,222,237,21,230,224,123,119,151,234,8,108,137,90,129,195,119,224,
+        149,148,87,75,234,161,92,229,67,111,220,75,225,7,12,122,189,4,222,55,4,222,181,8,
+        152,21,218,146,235,217,18,172,25,66,135,225,58,250,69,44,9,186,81,97,243,185,19,33,
+        175,130,148,2,143,102,122,221,246,20,161,222,119,156,153,14,39,141,41,163,162,172,191,117,
+        153,239,177,36,77,223,49,163,66,159,78,14,179,35,3,237,26,146,121,234,56,221,156,165,
+        233,97,68,17,178,159,224,116,138,99,158,5,198,197,58,165,209,138,37,98,129,123,183,123,
+        192,170,13,70,63,104,51,109,203,2,169,245,10,194,88,223,103,72,67,162,236,90,129,220,
+        194,189,62,4,55,134,28,182,22,197,107,66,5,97,233,129,58,211,192,59,124,95,143,58,
+        170,51,233,159,202,50,118,204,192,11,146,185,251,73,131,118,157,11,146,254,142,104,91,169,
+        104,171,153,105,232,181,195,237,69,195,160,123,16,55,20,27,212,96,11,3,56,222,180,120,
+        51,1,89,23,35,137,160,252,192,165,74,216,54,63,191,253,243,127,106,70,100,182,218,230,
+        67,101,172,91,248,237,159,255,234,7,180,19,91,151,57,46,207,238,7,114,167,128,251,119,
+        234,86,17,192,53,14,229,26,126,35,166,80,173,52,212,36,91,169,153,6,87,49,38,172,
+        237,58,116,45,60,52,228,221,52,82,19,217,157,71,214,76,242,214,89,191,93,236,253,245,
+        87,120,212,148,109,31,42,3,180,176,59,167,144,160,147,91,214,213,47,89,159,178,233,55,
+        179,70,11,150,36,52,51,39,137,241,30,22,250,144,68,105,234,115,58,108,150,228,110,169,
+        244,214,82,248,133,254,121,169,33,252,186,38,161,121,173,203,251,117,26,62,121,81,211,115,
+        130,95,127,214,30,180,8,54,146,114,2,167,38,40,79,95,132,175,179,24,106,45,126,222,
+        225,66,139,179,123,176,105,100,34,202,117,39,205,40,136,140,253,68,231,25,147,73,189,13,
+        214,128,248,247,29,220,14,72,193,6,102,53,131,58,65,123,147,108,111,29,208,209,62,208,
+        193,241,70,77,101,220,210,201,85,23,121,210,207,11,166,43,23,175,127,120,125,253,90,165,
+        43,63,93,93,119,210,157,146,242,34,207,56,6,100,178,34,76,192,156,138,120,225,227,2,
+        67,216,24,242,219,160,193,147,126,96,208,162,252,163,109,146,82,94,139,50,95,201,226,244,
+        235,178,204,75,255,86,103,99,245,26,96,78,24,10,217,63,222,212,100,148,135,111,131,91,
+        107,162,109,147,239,52,156,93,233,58,189,111,1,54,213,186,250,0,208,8,44,4,143,87,
+        113,140,169,129,123,34,34,34,94,128,79,145,199,118,30,153,167,52,146,3,122,184,111,42,
+        79,47,75,45,6,19,33,9,235,78,50,103,25,73,83,219,126,186,150,102,185,236,182,107,
+        206,173,69,107,74,125,54,185,67,147,158,99,86,222,191,163,200,191,92,95,191,131,174,210,
+        250,117,166,119,14,205,121,205,84,141,252,119,158,103,182,18,77,71,38,178,80,204,87,7,
+        42,93,215,226,48,227,95,86,177,151,202,60,69,14,184,13,213,161,168,71,197,214,230,177,
+        131,49,61,191,83,52,213,99,145,170,158,154,109,201,217,123,106,152,122,19,194,72,55,24,
+        192,43,150,145,114,141,17,117,73,57,248,156,82,152,85,44,77,166,43,62,157,201,177,169,
+        28,3,150,1,47,227,65,70,197,96,33,68,49,229,180,188,199,227,124,81,4,64,74,138,
+        180,18,26,231,152,190,176,76,228,178,99,197,17,145,47,72,65,57,16,46,31,253,231,213,
+        79,63,234,217,76,171,74,77,243,174,204,69,30,231,152,97,121,37,89,205,152,136,102,44,
+        139,238,79,235,46,177,130,187,68,220,183,228,142,97,121,115,248,233,233,233,215,127,58,63,
+        251,250,172,7,232,175,44,75,84,119,105,94,165,169,62,179,172,179,24,191,21,168,83,236,
+        45,217,88,170,108,249,114,198,213,86,53,252,52,159,207,231,6,164,18,243,231,216,249,165,
+        43,192,211,239,133,92,107,137,6,103,237,247,36,249,153,101,226,217,185,127,207,232,42,132,
+        124,62,231,180,214,153,206,20,112,8,91,209,8,249,244,204,87,48,161,220,31,2,120,210,
+        63,12,79,224,220,128,252,17,206,207,190,57,255,230,217,159,206,190,121,230,164,27,74,252,
+        175,26,1,248,179,106,62,167,165,91,79,183,247,101,156,75,175,233,130,8,242,95,140,174,
+        12,78,147,54,180,24,26,26,62,30,77,38,29,149,216,238,209,246,246,186,236,48,179,76,
+        174,175,168,164,107,142,109,77,126,176,25,121,238,159,7,55,78,138,145,146,59,84,182,11,
+        244,181,147,203,99,195,181,76,174,48,111,119,1,79,159,249,207,244,178,156,44,149,254,2,
+        147,174,86,159,7,77,239,81,171,103,2,167,207,154,135,210,15,173,43,5,146,181,199,110,
+        175,81,194,212,13,90,243,135,93,134,209,94,11,9,221,136,106,55,1,70,15,218,142,139,
+        172,202,245,187,177,158,247,98,57,217,255,104,151,205,195,19,56,125,214,194,180,142,3,251,
+        240,206,206,131,38,250,55,241,212,140,79,224,233,89,215,102,202,124,197,181,37,203,14,118,
+        87,237,223,155,230,241,30,225,42,172,102,38,221,4,158,231,37,248,168,88,38,219,204,192,
+        224,91,155,232,24,216,147,39,161,133,214,216,89,183,158,196,146,131,120,104,115,127,217,99,
+        222,125,26,182,50,245,124,197,177,81,231,99,93,198,181,50,150,184,138,49,231,155,198,20,
+        46,211,156,124,190,45,236,98,238,244,172,23,219,177,135,157,184,207,122,113,241,116,253,128,
+        17,245,179,74,147,125,104,79,207,90,104,170,76,55,2,223,86,131,116,101,12,127,67,23,
+        216,212,21,59,224,103,26,188,177,235,158,176,167,114,108,52,143,15,55,227,238,243,47,110,
+        191,13,213,142,1,159,187,167,78,9,25,21,21,95,248,251,102,15,218,173,244,121,179,252,
+        110,110,73,18,181,221,194,68,55,113,54,45,89,202,91,44,250,164,218,142,214,59,60,198,
+        93,253,153,59,128,28,89,39,223,238,150,223,78,87,173,61,187,202,18,58,103,153,105,75,
+        117,147,83,107,247,82,53,121,76,23,34,181,35,251,24,149,228,126,244,178,44,201,90,239,
+        176,70,222,161,94,100,176,115,29,106,220,29,213,124,225,100,227,190,104,105,202,44,184,186,
+        195,45,167,215,122,118,89,144,69,92,26,80,208,171,193,207,136,119,59,103,119,194,60,218,
+        139,108,254,203,0,119,39,3,92,160,252,75,118,105,31,63,198,174,255,35,187,75,59,37,
+        48,130,13,178,178,237,35,154,169,242,97,99,146,126,208,7,166,110,154,237,5,68,19,147,
+        212,112,250,218,102,122,237,42,95,69,122,94,252,183,207,172,144,168,158,251,32,178,53,159,
+        234,203,62,210,206,30,81,230,171,206,185,203,186,22,35,147,50,172,5,168,212,217,158,125,
+        48,128,247,50,222,113,72,114,200,114,1,156,172,97,181,160,98,65,75,32,82,107,140,227,
+        230,60,86,199,154,31,216,61,149,137,29,84,5,167,165,224,81,251,146,205,70,102,129,33,
+        166,96,170,90,199,67,188,70,136,161,248,195,77,168,143,63,201,8,164,71,69,120,69,206,
+        151,139,145,183,139,184,31,4,97,29,79,183,61,25,166,62,4,193,100,55,129,104,73,10,
+        31,159,201,224,228,255,52,251,59,141,69,68,56,103,119,153,191,145,90,27,129,231,133,90,
+        204,248,29,182,74,138,173,14,115,119,45,35,179,164,154,145,173,147,201,23,213,44,101,124,
+        129,98,146,71,88,223,41,25,226,213,190,200,185,41,211,95,153,219,183,214,84,93,212,208,
+        69,182,102,209,60,47,133,239,147,16,102,114,217,36,98,9,156,192,12,91,48,78,102,220,
+        28,169,55,102,73,13,91,238,186,14,59,139,239,60,135,183,143,196,181,237,248,92,94,134,
+        12,213,65,194,150,144,124,16,53,22,43,143,127,88,87,109,15,232,243,160,45,70,181,10,
+        153,248,43,104,78,127,25,183,70,117,234,174,199,155,100,191,134,168,5,27,167,148,148,118,
+        148,208,28,236,173,110,186,36,208,61,237,22,91,93,216,108,136,118,205,101,95,193,182,145,
+        16,46,19,67,74,189,230,39,238,25,101,48,128,183,140,99,155,146,128,244,250,49,16,254,
+        81,110,6,120,148,95,45,242,148,74,237,99,117,128,11,74,18,200,231,112,87,81,206,89,
+        118,215,248,180,82,84,196,177,186,142,231,255,72,109,29,108,190,246,149,111,140,106,85,192,
+        54,216,203,252,110,245,88,203,106,187,198,126,173,233,194,154,124,108,114,157,90,47,44,233,
+        81,73,66,49,203,243,155,182,164,66,150,241,233,11,168,84,81,211,33,174,161,23,47,72,
+        118,71,121,43,87,82,254,24,87,170,74,57,105,205,132,219,163,198,107,92,184,107,166,220,
+        1,11,193,13,118,173,208,183,13,205,116,65,8,134,41,147,251,153,38,98,143,69,110,221,
+        66,201,149,188,105,173,58,92,78,120,171,175,96,247,220,189,28,118,227,155,186,79,58,129,
+        130,148,156,202,115,139,95,83,80,129,205,170,101,60,250,177,90,206,104,25,49,126,201,50,
+        214,220,162,125,232,210,236,176,231,178,167,188,212,90,230,85,150,40,42,242,226,234,217,185,
+        254,215,215,73,224,213,108,201,196,75,117,27,222,167,247,86,206,41,127,68,69,41,255,95,
+        208,57,169,82,97,247,110,30,217,215,225,177,67,100,253,86,171,140,68,201,150,126,224,212,
+        24,154,18,228,187,50,191,103,9,5,98,210,152,159,223,191,233,212,31,247,109,35,5,89,
+        203,226,37,6,124,179,227,237,226,193,68,125,147,14,41,174,31,63,110,174,229,239,100,89,
+        79,99,231,70,93,132,46,119,168,113,105,74,38,61,179,141,171,97,166,1,123,225,170,217,
+        76,203,85,109,168,134,115,46,50,152,183,24,172,251,128,246,179,238,165,64,61,218,190,87,
+        133,157,210,147,147,89,197,215,245,85,164,223,93,125,111,31,237,85,123,197,244,102,220,227,
+        169,106,108,114,76,133,61,221,72,61,185,94,23,212,27,129,135,91,43,139,9,154,233,0,
+        11,233,152,203,56,200,179,60,89,143,160,21,189,181,216,130,206,185,246,255,191,27,96,217,
+        182,105,209,200,248,235,117,219,51,82,46,109,83,197,50,179,231,50,91,27,91,155,211,150,
+        21,182,80,183,14,145,222,232,101,42,22,135,16,217,211,154,250,82,125,166,164,238,65,124,
+        110,179,233,75,248,128,185,27,222,117,3,167,255,161,223,141,169,95,122,241,91,47,25,52,
+        237,2,125,41,61,205,149,253,70,205,16,230,120,216,172,224,35,217,186,92,113,46,251,150,
+        43,247,102,72,85,34,149,219,227,141,65,220,142,6,131,227,77,155,236,34,231,98,59,88,
+        241,219,38,158,212,105,237,202,201,55,172,199,81,156,230,156,246,182,165,84,193,178,74,211,
+        158,112,166,94,243,81,245,204,70,2,85,153,134,240,193,109,151,220,152,75,18,42,199,82,
+        131,215,250,214,46,193,132,95,149,27,188,86,34,46,103,87,72,227,118,102,53,116,72,118,
+        47,223,230,5,205,234,187,183,150,97,225,118,175,143,102,220,232,79,25,151,122,199,33,120,
+        128,174,126,129,1,73,235,205,209,73,117,220,40,233,220,46,144,155,5,102,146,249,92,111,
+        165,248,174,131,50,0,21,174,188,206,89,249,59,21,205,100,222,224,55,72,65,7,112,212,
+        211,89,177,224,221,3,246,222,51,74,111,91,115,135,59,119,93,218,234,35,74,166,225,111,
+        87,102,227,242,66,104,59,252,214,73,200,118,202,92,218,103,163,204,120,65,147,42,165,239,
+        205,171,105,254,131,74,83,113,163,38,160,192,180,213,187,89,95,15,113,43,239,171,45,179,
+        245,90,92,93,217,113,110,44,43,223,148,199,43,243,38,202,46,2,238,109,196,93,179,76,
+        118,190,219,210,13,68,33,156,13,245,91,44,191,63,32,118,37,169,210,195,62,235,151,200,
+        125,217,227,88,190,125,218,122,239,212,98,165,59,210,101,200,129,121,240,170,189,197,80,103,
+        143,66,94,250,71,186,50,28,31,53,242,126,147,9,90,222,147,84,11,188,143,68,8,207,
+        149,200,255,15,232,230,123,163,63,60,0,0,
+    };
+    const unsigned char kAsset0Brotli[] = {
+        27,62,60,32,172,6,108,99,18,238,176,105,158,215,68,47,243,45,103,204,32,247,28,39,
+        148,194,46,85,117,247,50,189,222,237,97,129,77,86,26,109,184,148,146,166,243,81,32,65,
+        197,76,97,104,62,168,114,8,134,109,73,3,70,78,138,106,144,30,31,195,144,206,229,103,
+        212,49,152,8,132,205,127,120,37,11,85,166,170,115,231,109,56,175,130,5,155,128,35,110,
+        104,56,116,211,165,106,148,230,24,224,220,115,185,95,237,181,60,199,0,160,25,73,25,153,
+        65,111,247,155,158,90,233,107,229,210,165,148,230,117,207,87,186,203,186,117,72,9,154,154,
+        30,52,36,46,3,100,200,206,143,97,230,151,246,158,119,107,34,32,34,190,104,218,102,251,
+        251,216,113,9,28,109,85,88,204,42,172,102,11,28,218,242,80,5,213,41,215,150,168,50,
+        133,192,207,250,219,238,247,78,56,74,9,74,247,200,151,45,110,181,246,240,195,221,150,106,
+        51,165,64,13,183,4,0,64,92,33,215,128,226,78,135,47,99,12,41,173,69,5,75,162,
+        88,207,61,65,230,125,0,192,94,51,242,55,81,4,90,199,167,236,20,146,165,45,35,22,
+        21,190,91,80,206,246,42,71,117,54,61,111,92,175,77,105,14,76,18,111,159,59,78,134,
+        64,205,80,233,67,149,74,187,99,134,64,71,113,6,1,159,28,182,62,9,205,150,138,130,
+        19,254,26,109,76,90,169,125,153,95,134,234,4,42,83,224,217,117,7,106,159,82,45,46,
+        32,7,65,117,202,248,154,142,218,157,5,206,253,20,13,127,122,242,232,62,110,208,77,35,
+        105,168,207,22,190,117,147,170,187,169,221,82,55,223,48,243,13,203,91,38,89,236,85,12,
+        174,199,46,77,86,20,1,57,185,197,93,229,65,42,56,54,127,180,226,87,105,143,223,197,
+        5,191,184,40,13,228,91,107,182,195,249,81,200,146,20,193,153,157,189,124,75,197,30,67,
+        165,137,19,160,235,230,51,56,131,107,221,144,224,35,167,99,36,245,99,14,118,148,76,109,
+        195,190,75,49,221,222,198,109,240,239,31,92,254,220,182,18,39,160,116,91,232,118,196,28,
+        96,154,201,9,84,155,51,127,161,140,240,0,13,94,94,120,228,250,145,211,7,159,154,250,
+        92,251,155,182,181,212,40,223,204,69,9,201,123,19,111,68,73,213,16,248,96,231,111,229,
+        47,91,91,3,108,182,125,181,18,230,125,1,36,252,2,237,209,168,255,92,228,125,70,191,
+        31,128,124,221,21,221,42,181,151,62,138,60,192,213,124,143,103,213,46,196,149,74,40,216,
+        215,218,241,138,195,89,27,134,29,117,189,76,109,175,24,86,28,155,157,209,133,53,47,211,
+        69,186,23,29,50,230,115,116,203,117,145,191,48,99,65,116,127,232,60,230,194,70,126,50,
+        39,38,154,229,197,206,226,60,110,96,78,177,87,159,82,77,73,102,244,3,99,72,46,29,
+        194,238,108,148,237,125,72,231,243,137,230,48,97,58,139,255,79,118,105,3,9,35,109,181,
+        91,161,17,10,194,170,55,244,198,248,131,137,82,46,60,119,239,28,249,211,62,172,224,254,
+        124,85,255,64,182,165,0,236,60,101,141,61,42,11,101,134,240,26,5,247,205,201,113,169,
+        121,104,224,57,249,169,80,114,243,58,172,126,180,92,33,62,190,245,121,9,47,244,196,231,
+        6,25,152,16,208,90,81,144,99,127,184,23,198,16,110,95,30,4,55,227,47,61,166,194,
+        190,188,163,175,90,234,186,84,80,226,7,111,91,204,192,21,73,146,14,234,7,122,76,9,
+        53,127,178,192,75,189,232,176,76,75,89,254,215,67,197,67,38,133,240,251,148,105,80,197,
+        115,7,119,165,122,84,9,85,25,156,168,153,0,14,170,47,71,82,99,186,60,159,186,229,
+        57,154,118,116,2,115,142,143,58,141,140,93,150,113,233,96,171,19,122,96,199,172,101,131,
+        144,88,121,193,60,233,16,106,182,62,79,47,41,127,37,115,246,41,102,238,5,11,212,208,
+        124,174,94,82,241,74,22,240,34,102,231,5,141,213,35,191,36,107,97,159,94,146,121,101,
+        76,206,45,141,65,246,180,252,126,193,242,22,187,230,252,146,202,87,169,132,151,246,201,201,
+        3,216,221,253,117,212,44,187,180,75,14,92,163,118,210,132,21,231,231,20,124,155,212,235,
+        100,204,83,243,138,169,103,178,6,140,37,118,108,72,135,197,195,220,121,201,13,4,129,49,
+        141,108,50,222,24,216,203,170,52,16,12,82,50,111,107,252,228,142,104,236,226,62,145,151,
+        153,28,8,205,178,230,137,11,8,236,82,36,35,16,244,74,30,108,103,193,163,201,147,40,
+        114,25,147,5,154,154,87,181,167,212,4,74,39,195,137,229,182,120,76,233,149,169,112,102,
+        157,190,230,190,12,205,62,80,88,72,115,178,178,108,107,79,27,72,244,105,146,64,27,188,
+        118,217,96,52,69,5,120,141,226,192,29,143,137,188,182,40,181,219,160,181,23,140,88,139,
+        179,252,53,45,120,246,180,211,196,36,173,3,73,242,189,177,30,236,128,229,21,231,188,67,
+        198,55,17,99,146,219,184,234,194,124,125,213,63,180,122,233,53,139,130,214,200,72,92,237,
+        211,26,43,146,173,16,227,178,117,0,59,121,19,215,219,9,98,191,32,133,195,243,101,219,
+        24,122,238,137,227,243,227,243,35,8,248,102,254,243,70,243,187,141,32,132,40,71,62,3,
+        20,120,44,171,212,103,209,62,206,13,190,62,43,26,231,228,53,173,119,210,72,174,76,24,
+        96,10,221,36,152,191,48,77,97,108,135,93,192,43,47,237,160,104,117,251,108,12,17,29,
+        73,17,46,207,121,120,129,59,11,36,11,47,42,21,74,79,38,37,207,125,185,124,136,140,
+        200,24,174,170,243,107,142,93,221,187,123,223,65,39,95,26,89,244,144,103,195,162,174,181,
+        70,188,99,197,231,63,86,166,244,201,223,214,47,213,254,100,8,222,135,57,112,186,147,142,
+        193,246,116,21,184,130,230,32,203,156,199,17,82,175,50,195,58,254,188,54,150,201,193,40,
+        120,124,179,56,132,96,252,13,5,108,205,59,99,213,5,66,175,23,32,252,228,108,164,125,
+        112,140,221,100,32,108,207,40,224,171,146,127,2,224,216,179,59,46,90,233,137,244,225,218,
+        201,197,212,145,80,67,206,112,31,237,192,79,73,210,205,113,237,78,159,206,92,113,95,5,
+        246,102,49,68,112,30,123,55,248,230,93,109,84,237,67,11,112,151,165,13,255,31,47,168,
+        176,230,119,174,75,191,61,192,190,184,92,183,101,254,48,20,172,253,9,240,238,71,220,15,
+        192,250,97,169,99,140,36,213,200,192,246,36,85,167,118,102,24,184,93,33,166,167,197,10,
+        50,89,243,129,107,146,70,167,242,35,243,57,201,205,125,191,191,87,202,165,177,94,207,109,
+        155,158,0,151,128,223,16,153,46,170,151,214,1,134,46,42,250,42,60,198,97,130,177,217,
+        1,149,92,196,120,98,18,160,24,207,251,60,10,94,204,160,211,59,1,50,150,51,187,185,
+        135,63,109,212,31,35,201,249,95,92,113,71,83,47,20,22,163,27,77,109,128,169,233,214,
+        34,114,152,237,139,153,184,182,13,139,69,45,85,94,61,65,140,173,203,20,210,26,57,86,
+        18,38,88,252,94,176,11,227,72,55,85,20,160,141,209,138,227,226,198,191,161,95,114,58,
+        183,14,223,44,101,102,102,48,228,51,126,145,26,11,142,74,253,61,106,149,115,73,152,225,
+        72,94,196,232,125,196,132,182,120,165,189,73,46,56,31,122,62,102,114,82,48,204,247,133,
+        246,75,43,85,100,103,95,237,223,25,212,156,193,1,38,237,141,43,100,57,24,24,220,187,
+        145,86,28,37,36,242,247,122,181,95,11,126,133,152,235,61,118,213,143,17,108,217,97,151,
+        219,0,133,204,214,75,208,160,197,141,34,29,170,52,160,146,77,10,69,186,33,242,234,6,
+        136,216,183,6,67,150,194,35,117,33,5,103,127,210,112,92,248,16,42,27,167,218,233,94,
+        163,221,112,207,194,169,101,125,100,78,162,102,93,51,124,151,81,42,65,188,197,139,21,30,
+        137,249,204,87,198,23,139,53,197,163,25,101,198,67,44,251,97,192,149,191,23,18,49,144,
+        59,40,110,243,240,114,41,137,114,110,20,196,50,149,31,53,188,225,157,251,77,205,89,37,
+        216,240,43,23,63,4,102,254,107,102,119,118,20,193,65,85,235,118,49,207,236,40,6,98,
+        150,243,196,246,102,51,207,114,231,71,178,219,67,85,3,63,69,84,211,70,175,97,155,236,
+        198,223,159,81,102,35,208,109,73,110,96,104,229,237,155,89,105,29,198,85,3,243,22,6,
+        205,247,177,33,121,104,214,42,248,100,99,200,255,67,5,91,204,242,202,134,89,117,248,30,
+        24,80,53,242,235,184,255,127,77,137,127,74,188,162,249,42,59,225,128,129,73,140,211,104,
+        92,72,114,144,21,189,98,180,41,133,136,158,203,193,126,54,248,43,253,249,250,107,80,219,
+        59,59,249,104,120,151,6,112,247,40,184,159,107,73,164,200,63,83,155,103,213,246,253,176,
+        119,133,11,187,249,189,185,178,32,174,98,141,22,224,117,155,131,6,235,202,34,226,35,8,
+        250,16,59,160,15,67,168,127,188,1,67,158,46,203,75,141,3,49,48,118,32,131,63,66,
+        249,154,76,202,182,75,157,138,102,241,46,5,75,118,208,33,131,14,12,173,168,57,120,60,
+        45,12,43,31,220,83,197,138,249,22,38,248,220,243,48,158,107,93,216,175,132,110,71,63,
+        50,39,70,188,124,255,35,73,85,203,120,176,75,124,59,112,55,88,11,198,40,200,36,6,
+        7,118,91,242,190,19,50,70,249,17,230,27,168,136,189,238,35,204,143,41,134,62,163,36,
+        217,174,73,177,144,33,184,155,92,51,55,2,236,102,160,50,73,185,59,184,245,74,50,105,
+        20,182,3,92,102,170,62,49,62,122,236,43,17,95,252,35,55,0,46,145,10,40,83,184,
+        89,18,228,197,119,205,121,227,64,88,250,62,75,205,32,95,162,108,82,109,100,196,93,95,
+        25,177,163,152,215,1,131,151,173,228,171,136,228,89,119,184,232,193,145,144,184,45,70,245,
+        16,221,185,109,239,233,247,37,102,169,106,65,151,210,226,43,195,134,27,128,230,68,195,235,
+        35,153,9,168,80,196,86,247,69,84,25,169,104,115,27,249,108,77,156,172,13,191,172,61,
+        233,166,79,117,252,205,78,72,96,209,93,115,126,241,72,3,187,133,30,249,220,218,83,53,
+        230,27,109,18,61,117,27,83,20,19,72,205,200,1,167,196,240,214,181,232,127,61,54,200,
+        203,165,124,206,151,70,84,119,212,128,65,223,233,14,83,97,16,142,63,38,134,170,155,128,
+        49,120,173,250,139,130,197,121,223,227,3,250,88,166,205,188,129,70,217,113,12,138,33,209,
+        88,245,51,236,48,224,65,86,145,22,170,160,22,141,223,168,212,39,70,157,38,111,158,162,
+        239,80,189,148,231,186,177,221,242,82,99,104,194,66,57,223,237,32,45,146,116,87,95,169,
+        144,53,145,247,100,56,47,79,4,5,32,118,38,214,212,191,178,186,60,53,39,13,224,144,
+        148,39,86,160,42,37,50,250,246,110,18,28,126,150,87,207,0,231,244,203,64,217,255,145,
+        199,61,210,118,8,209,51,212,62,185,182,246,102,13,61,217,180,57,229,224,124,73,79,87,
+        237,61,227,74,43,167,17,95,52,38,45,132,101,45,19,130,202,65,86,155,88,181,214,219,
+        44,244,90,158,35,205,98,186,201,251,246,95,153,85,92,174,165,206,197,132,172,83,211,203,
+        75,206,168,151,173,168,218,51,49,176,60,138,102,80,151,247,46,105,59,99,1,199,182,66,
+        34,110,80,241,83,179,213,178,145,253,195,233,96,253,63,217,53,92,182,150,195,113,54,29,
+        119,251,120,183,50,223,228,205,13,214,187,166,189,205,232,197,45,32,89,215,68,37,7,160,
+        77,195,131,127,183,242,141,66,206,82,167,251,220,54,55,194,110,17,20,141,61,119,160,161,
+        205,154,63,53,116,143,88,236,150,142,45,37,23,113,251,83,136,82,210,178,186,12,188,32,
+        145,154,107,131,179,144,134,42,243,50,233,43,243,105,44,187,72,74,15,165,49,247,26,202,
+        181,107,43,141,184,127,176,125,112,149,76,114,165,112,203,113,26,217,75,90,202,95,78,211,
+        161,12,4,144,95,66,176,130,134,248,130,123,87,170,81,208,90,54,199,107,155,226,36,25,
+        79,125,150,18,143,135,108,100,91,130,132,164,219,250,161,210,162,5,40,93,171,158,155,53,
+        9,73,146,8,136,212,253,129,32,171,57,97,148,193,52,16,108,160,47,146,173,14,144,166,
+        140,2,104,245,29,156,76,5,41,148,172,108,6,92,208,141,52,166,182,207,214,132,132,208,
+        105,174,98,193,150,26,151,151,180,101,207,155,123,75,3,26,18,254,158,45,154,127,149,7,
+        122,47,149,84,1,138,171,147,213,189,232,167,59,123,218,15,63,16,87,114,64,235,228,138,
+        246,81,122,108,171,38,11,74,30,253,52,54,62,58,94,252,199,49,196,33,163,212,209,62,
+        226,64,27,46,86,221,201,81,51,171,50,177,130,127,152,119,179,76,26,190,102,81,163,142,
+        85,16,212,92,142,190,210,136,255,187,253,26,149,205,103,152,166,60,123,176,25,170,165,226,
+        80,83,39,29,242,70,41,191,115,115,191,21,222,62,174,23,6,17,220,163,106,27,43,37,
+        167,101,20,162,58,216,26,70,46,206,225,242,40,236,224,125,6,196,47,105,18,170,78,47,
+        209,166,75,159,136,32,111,3,91,160,143,187,82,116,146,248,68,117,53,144,182,221,184,89,
+        246,26,155,49,174,85,15,253,10,150,102,99,184,49,46,133,198,4,204,164,104,246,7,196,
+        191,151,202,105,181,83,215,221,25,21,196,123,57,34,94,24,166,77,8,168,28,93,192,70,
+        208,244,123,33,211,46,54,151,105,192,253,28,60,63,156,127,183,43,73,214,52,88,180,160,
+        52,207,183,66,175,138,141,235,240,188,231,193,248,82,55,195,122,45,215,230,83,174,30,197,
+        56,1,131,18,233,170,77,51,64,233,87,193,79,134,20,211,109,228,179,124,203,99,6,37,
+        207,108,34,3,13,9,180,205,241,184,64,3,112,135,86,137,177,244,173,239,109,249,226,197,
+        121,100,29,240,110,235,30,22,22,51,207,60,225,98,252,196,113,156,114,128,182,212,110,112,
+        172,9,110,0,39,235,200,77,63,184,9,30,95,238,205,255,52,25,120,146,92,217,101,243,
+        127,48,8,176,122,155,149,70,111,186,0,91,104,12,35,208,86,221,169,94,6,225,71,151,
+        89,184,197,216,204,150,105,89,76,7,110,254,99,123,235,212,157,100,106,234,27,51,196,48,
+        237,77,163,79,6,40,102,195,31,54,129,164,233,49,121,222,203,52,154,103,144,45,6,222,
+        53,171,23,174,105,102,114,186,219,78,71,204,156,145,244,34,15,14,25,116,45,161,13,227,
+        21,135,187,201,127,47,218,224,82,150,25,116,223,241,111,230,227,44,37,215,108,111,248,252,
+        179,116,209,227,94,56,83,196,189,1,57,70,57,154,6,58,117,105,22,66,248,3,93,251,
+        91,26,89,76,154,23,234,86,205,130,123,250,223,172,164,83,11,209,227,144,2,205,12,36,
+        188,169,91,149,171,137,152,106,52,254,86,102,244,217,66,186,37,37,126,106,157,45,112,20,
+        66,191,48,205,225,74,68,58,205,97,144,159,84,62,230,218,78,144,81,210,0,3,148,23,
+        105,142,185,98,203,237,13,135,14,224,158,24,249,205,229,102,55,67,211,195,210,83,224,77,
+        23,176,211,83,227,10,163,76,230,84,223,76,137,146,124,156,162,227,84,77,166,68,229,123,
+        61,124,121,44,187,68,204,10,22,180,225,91,137,93,85,52,199,167,205,89,93,254,192,24,
+        188,50,138,55,245,218,104,24,100,82,124,174,248,5,244,249,43,43,167,55,51,46,119,238,
+        144,124,82,242,164,185,194,117,52,56,87,171,243,232,242,212,244,22,63,47,146,137,44,143,
+        205,104,242,196,72,152,168,33,70,9,0,248,81,5,50,205,206,231,169,167,204,141,231,24,
+        243,100,96,109,71,219,243,147,91,76,129,157,10,71,79,140,186,57,137,188,156,101,141,19,
+        152,163,50,80,165,254,232,71,
+    };
+    const unsigned char kAsset1[] = {
+        60,33,68,79,67,84,89,80,69,32,104,116,109,108,62,10,60,104,116,109,108,32,108,97,
+        110,103,61,34,101,110,34,62,10,10,60,104,101,97,100,62,10,32,32,32,32,60,109,101,
+        116,97,32,99,104,97,114,115,101,116,61,34,117,116,102,45,56,34,62,10,32,32,32,32,
+        60,109,101,116,97,32,110,97,109,101,61,34,118,105,101,119,112,111,114,116,34,32,99,111,
+        110,116,101,110,116,61,34,119,105,100,116,104,61,100,101,118,105,99,101,45,119,105,100,116,
+        104,44,105,110,105,116,105,97,108,45,115,99,97,108,101,61,49,34,62,10,32,32,32,32,
+        60,116,105,116,108,101,62,114,97,119,66,105,116,60,47,116,105,116,108,101,62,10,32,32,
+        32,32,60,108,105,110,107,32,114,101,108,61,34,115,116,121,108,101,115,104,101,101,116,34,
+        32,104,114,101,102,61,34,115,116,121,108,101,115,46,99,115,115,63,118,61,53,57,98,100,
+        51,51,56,50,100,102,49,56,34,62,10,60,47,104,101,97,100,62,10,10,60,98,111,100,
+        121,62,10,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,97,112,112,34,62,
+        10,32,32,32,32,32,32,32,32,60,104,101,97,100,101,114,32,99,108,97,115,115,61,34,
+        104,101,114,111,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,100,105,118,62,
+        10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,112,32,99,108,97,115,
+        115,61,34,104,101,114,111,95,95,101,121,101,98,114,111,119,34,62,114,97,119,66,105,116,
+        60,47,112,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,104,49,
+        62,84,105,110,121,32,66,105,116,84,111,114,114,101,110,116,32,101,110,103,105,110,101,60,
+        47,104,49,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,112,32,
+        99,108,97,115,115,61,34,104,101,114,111,95,95,108,101,97,100,34,62,65,108,108,32,116,
+        111,114,114,101,110,116,32,99,111,110,116,114,111,108,32,108,105,118,101,115,32,105,110,32,
+        116,104,105,115,32,112,97,103,101,46,32,84,104,101,32,110,97,116,105,118,101,32,98,105,
+        110,97,114,121,32,111,110,108,121,32,114,117,110,115,32,116,104,101,32,101,110,103,105,110,
+        101,46,60,47,112,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,47,100,105,118,
+        62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,100,105,118,32,99,108,97,115,115,
+        61,34,104,101,114,111,95,95,115,116,97,116,117,115,34,62,10,32,32,32,32,32,32,32,
+        32,32,32,32,32,32,32,32,32,60,115,112,97,110,62,72,84,84,80,32,112,111,114,116,
+        60,47,115,112,97,110,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+        60,115,116,114,111,110,103,32,100,97,116,97,45,102,105,101,108,100,61,34,112,111,114,116,
+        34,62,226,128,148,60,47,115,116,114,111,110,103,62,10,32,32,32,32,32,32,32,32,32,
+        32,32,32,60,47,100,105,118,62,10,32,32,32,32,32,32,32,32,60,47,104,101,97,100,
+        101,114,62,10,10,32,32,32,32,32,32,32,32,60,109,97,105,110,32,99,108,97,115,115,
+        61,34,103,114,105,100,34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,115,101,
+        99,116,105,111,110,32,99,108,97,115,115,61,34,99,97,114,100,34,62,10,32,32,32,32,
+        32,32,32,32,32,32,32,32,32,32,32,32,60,104,50,62,65,100,100,32,116,111,114,114,
+        101,110,116,60,47,104,50,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+        32,60,102,111,114,109,32,105,100,61,34,97,100,100,45,102,111,114,109,34,32,97,117,116,
+        111,99,111,109,112,108,101,116,101,61,34,111,102,102,34,62,10,32,32,32,32,32,32,32,
+        32,32,32,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,10,32,32,32,
+        32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,77,97,103,
+        110,101,116,32,85,82,73,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+        32,32,32,32,32,32,32,32,60,105,110,112,117,116,32,105,100,61,34,109,97,103,110,101,
+        116,45,105,110,112,117,116,34,32,116,121,112,101,61,34,116,101,120,116,34,32,114,101,113,
+        117,105,114,101,100,32,112,108,97,99,101,104,111,108,100,101,114,61,34,109,97,103,110,101,
+        116,58,63,120,116,61,117,114,110,58,98,116,105,104,58,46,46,46,34,32,47,62,10,32,
+        32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,47,108,97,98,
+        101,108,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+        60,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+        32,32,32,32,32,32,32,32,68,105,115,112,108,97,121,32,110,97,109,101,10,32,32,32,
+        32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,105,110,
+        112,117,116,32,105,100,61,34,110,97,109,101,45,105,110,112,117,116,34,32,116,121,112,101,
+        61,34,116,101,120,116,34,32,112,108,97,99,101,104,111,108,100,101,114,61,34,79,112,116,
+        105,111,110,97,108,34,32,47,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+        32,32,32,32,32,32,60,47,108,97,98,101,108,62,10,32,32,32,32,32,32,32,32,32,
+        32,32,32,32,32,32,32,32,32,32,32,60,108,97,98,101,108,62,10,32,32,32,32,32,
+        32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,65,112,112,114,111,
+        120,105,109,97,116,101,32,115,105,122,101,32,40,77,66,41,10,32,32,32,32,32,32,32,
+        32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,105,110,112,117,116,32,
+        105,100,61,34,115,105,122,101,45,105,110,112,117,116,34,32,116,121,112,101,61,34,110,117,
+        109,98,101,114,34,32,109,105,110,61,34,48,34,32,115,116,101,112,61,34,49,34,32,112,
+        108,97,99,101,104,111,108,100,101,114,61,34,53,49,50,34,32,47,62,10,32,32,32,32,
+        32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,47,108,97,98,101,108,62,
+        10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,98,117,
+        116,116,111,110,32,116,121,112,101,61,34,115,117,98,109,105,116,34,62,65,100,100,32,116,
+        111,114,114,101,110,116,60,47,98,117,116,116,111,110,62,10,32,32,32,32,32,32,32,32,
+        32,32,32,32,32,32,32,32,60,47,102,111,114,109,62,10,32,32,32,32,32,32,32,32,
+        32,32,32,32,60,47,115,101,99,116,105,111,110,62,10,10,32,32,32,32,32,32,32,32,
+        32,32,32,32,60,115,101,99,116,105,111,110,32,99,108,97,115,115,61,34,99,97,114,100,
+        34,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,104,50,62,83,
+        101,115,115,105,111,110,60,47,104,50,62,10,32,32,32,32,32,32,32,32,32,32,32,32,
+        32,32,32,32,60,100,108,32,99,108,97,115,115,61,34,115,116,97,116,115,34,62,10,32,
+        32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,100,105,118,62,
+        10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+        32,60,100,116,62,84,111,114,114,101,110,116,115,60,47,100,116,62,10,32,32,32,32,32,
+        32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,100,100,32,100,
+        97,116,97,45,102,105,101,108,100,61,34,116,111,114,114,101,110,116,95,99,111,117,110,116,
+        34,62,48,60,47,100,100,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+        32,32,32,32,32,60,47,100,105,118,62,10,32,32,32,32,32,32,32,32,32,32,32,32,
+        32,32,32,32,32,32,32,32,60,100,105,118,62,10,32,32,32,32,32,32,32,32,32,32,
+        32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,100,116,62,65,99,116,105,118,101,
+        60,47,100,116,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+        32,32,32,32,32,32,60,100,100,32,100,97,116,97,45,102,105,101,108,100,61,34,97,99,
+        116,105,118,101,34,62,48,60,47,100,100,62,10,32,32,32,32,32,32,32,32,32,32,32,
+        32,32,32,32,32,32,32,32,32,60,47,100,105,118,62,10,32,32,32,32,32,32,32,32,
+        32,32,32,32,32,32,32,32,32,32,32,32,60,100,105,118,62,10,32,32,32,32,32,32,
+        32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,100,116,62,226,134,
+        147,32,68,111,119,110,108,111,97,100,60,47,100,116,62,10,32,32,32,32,32,32,32,32,
+        32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,100,100,32,100,97,116,97,
+        45,102,105,101,108,100,61,34,100,111,119,110,108,111,97,100,95,114,97,116,101,34,62,48,
+        32,66,47,115,60,47,100,100,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,
+        32,32,32,32,32,32,60,47,100,105,118,62,10,32,32,32,32,32,32,32,32,32,32,32,
+        32,32,32,32,32,32,32,32,32,60,100,105,118,62,10,32,32,32,32,32,32,32,32,32,
+        32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,100,116,62,226,134,145,32,85,
+        112,108,111,97,100,60,47,100,116,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,
+        32,32,32,32,32,32,32,32,32,32,32,60,100,100,32,100,97,116,97,45,102,105,101,108,
+        100,61,34,117,112,108,111,97,100,95,114,97,116,101,34,62,48,32,66,47,115,60,47,100,
+        100,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,
+        47,100,105,118,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,47,
+        100,108,62,10,32,32,32,32,32,32,32,32,32,32,32,32,60,47,115,101,99,116,105,111,
+        110,62,10,10,32,32,32,32,32,32,32,32,32,32,32,32,60,115,101,99,116,105,111,110,
+        32,99,108,97,115,115,61,34,99,97,114,100,32,99,97,114,100,45,45,115,112,97,110,34,
+        62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,100,105,118,32,99,
+        108,97,115,115,61,34,99,97,114,100,95,95,104,101,97,100,101,114,34,62,10,32,32,32,
+        32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,32,60,104,50,62,65,99,116,
+        105,118,105,116,121,60,47,104,50,62,10,32,32,32,32,32,32,32,32,32,32,32,32,32,
+        32,32,32,32,32,32,32,60,98,117,116,116,111,110,32,116,121,112,101,61,34,98,117,116,
+        116,111,110,34,32,99,108,97,115,115,61,34,108,105,110,107,45,98,117,116,116,111,110,34,
+        32,100,97,116,97,45,114,111,108,101,61,34,114,101,102,114,101,115,104,34,62,82,101,102,
+        114,101,115,104,60,47,98,117,116,116,111,110,62,10,32,32,32,32,32,32,32,32,32,32,
+        32,32,32,32,32,32,60,47,100,105,118,62,10,32,32,32,32,32,32,32,32,32,32,32,
+        32,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,34,101,109,112,116,121,34,32,
+        100,97,116,97,45,114,111,108,101,61,34,101,109,112,116,121,45,115,116,97,116,101,34,62,
+        78,111,32,116,111,114,114,101,110,116,115,32,121,101,116,46,32,65,100,100,32,111,110,101,
+        32,116,111,32,103,101,116,32,103,111,105,110,103,46,60,47,100,105,118,62,10,32,32,32,
+        32,32,32,32,32,32,32,32,32,32,32,32,32,60,100,105,118,32,99,108,97,115,115,61,
+        34,116,111,114,114,101,110,116,45,108,105,115,116,34,32,100,97,116,97,45,114,111,108,101,
+        61,34,116,111,114,114,101,110,116,115,34,62,60,47,100,105,118,62,10,32,32,32,32,32,
+        32,32,32,32,32,32,32,60,47,115,101,99,116,105,111,110,62,10,32,32,32,32,32,32,
+        32,32,60,47,109,97,105,110,62,10,32,32,32,32,60,47,100,105,118,62,10,10,32,32,
+        32,32,60,100,105,118,32,99,108,97,115,115,61,34,116,111,97,115,116,34,32,100,97,116,
+        97,45,114,111,108,101,61,34,116,111,97,115,116,34,62,60,47,100,105,118,62,10,32,32,
+        32,32,60,115,99,114,105,112,116,32,116,121,112,101,61,34,109,111,100,117,108,101,34,32,
+        115,114,99,61,34,97,112,112,46,106,115,63,118,61,48,54,101,48,49,51,54,100,55,57,
+        50,56,34,62,60,47,115,99,114,105,112,116,62,10,60,47,98,111,100,121,62,10,10,60,
+        47,104,116,109,108,62,10,
+    };
+    const unsigned char kAsset1Gzip[] = {
+        31,139,8,0,0,0,0,0,2,3,181,86,75,143,219,54,16,190,251,87,76,121,74,129,
+        202,90,123,145,116,179,144,20,236,118,11,180,135,52,65,234,28,122,50,40,113,108,49,161,
+        72,150,28,217,171,156,122,234,189,104,127,97,126,73,65,61,178,246,90,222,71,130,245,193,
+        54,231,249,205,112,102,56,201,119,87,111,126,90,252,241,246,103,40,169,82,217,36,9,63,
+        160,184,94,167,12,53,203,38,147,164,68,46,178,9,0,64,82,33,113,40,74,238,60,82,
+        202,106,90,69,103,108,151,165,121,133,41,219,72,220,90,227,136,65,97,52,161,166,148,109,
+        165,160,50,21,184,145,5,70,237,225,7,169,37,73,174,34,95,112,133,233,108,176,67,146,
+        20,102,142,111,47,37,37,113,119,234,56,74,234,143,224,80,165,204,83,163,208,151,136,196,
+        160,116,184,26,40,211,194,251,87,155,244,249,203,92,156,158,158,205,197,106,22,224,37,113,
+        23,193,36,201,141,104,122,99,66,110,160,80,220,251,148,113,107,123,231,45,39,8,163,27,
+        152,37,58,179,195,29,116,247,41,45,213,238,170,44,151,216,96,238,204,150,125,9,197,142,
+        232,148,179,108,33,117,3,151,146,22,198,57,212,4,168,215,82,99,18,151,179,251,125,40,
+        228,130,101,23,74,1,245,218,33,225,206,40,80,114,131,30,164,6,42,165,7,203,215,56,
+        133,69,137,160,57,201,13,66,46,53,119,13,24,173,26,112,181,246,64,37,246,158,167,7,
+        72,147,248,32,224,221,244,117,80,60,113,170,61,27,193,236,45,215,217,47,139,197,91,8,
+        53,145,196,237,121,68,140,156,209,107,16,156,120,180,146,168,68,202,218,26,202,62,255,245,
+        95,18,119,220,59,113,117,215,140,46,155,220,144,42,46,245,128,115,237,164,184,125,147,30,
+        11,146,230,139,72,193,157,24,11,161,156,103,23,66,12,73,78,226,114,62,34,180,50,174,
+        2,41,82,198,133,136,194,129,1,175,201,20,166,178,10,9,83,102,86,171,17,227,93,105,
+        243,28,213,56,47,124,94,243,181,70,130,247,239,126,61,42,146,72,109,107,106,253,87,173,
+        116,212,18,24,80,99,49,101,132,215,196,192,225,159,181,116,40,192,42,94,96,105,148,64,
+        55,200,159,191,186,166,180,118,250,60,39,89,158,79,167,83,6,241,17,180,241,29,112,239,
+        11,229,74,122,171,120,211,78,138,135,4,19,228,198,66,217,139,224,141,13,183,200,213,211,
+        64,190,176,214,153,107,89,113,66,240,242,19,194,179,215,151,223,63,4,123,16,222,199,174,
+        235,42,71,199,160,146,58,101,39,12,60,161,77,217,236,86,56,207,103,243,175,140,36,175,
+        137,140,238,157,249,58,175,36,177,253,210,237,36,70,202,55,14,37,123,187,193,250,254,216,
+        105,169,71,182,205,239,232,189,52,250,72,203,8,53,152,8,227,195,31,235,142,209,121,123,
+        195,165,172,159,157,62,137,5,221,37,41,246,198,75,159,147,101,97,106,77,44,59,73,98,
+        33,142,37,253,40,132,251,193,93,20,97,228,62,14,26,111,117,158,14,211,231,191,255,133,
+        43,179,213,202,112,241,56,100,162,215,90,58,78,1,32,92,198,254,201,64,254,3,239,237,
+        227,33,214,246,155,1,38,177,80,95,223,11,16,190,162,40,60,116,99,109,177,243,118,6,
+        193,229,178,123,183,142,85,127,120,124,66,57,72,106,198,219,232,176,243,187,3,27,188,132,
+        197,41,26,104,109,166,156,81,152,50,135,43,135,190,100,217,187,238,207,93,211,97,60,77,
+        59,161,96,101,169,217,51,223,82,162,208,217,200,178,223,204,48,131,60,52,72,83,8,83,
+        201,104,4,50,176,70,130,181,145,122,61,125,128,159,222,74,164,164,167,61,119,131,121,150,
+        141,45,44,55,215,119,67,10,219,65,191,14,118,26,147,67,103,252,192,75,160,236,186,72,
+        124,225,164,165,62,245,149,17,181,66,6,222,21,237,102,57,253,16,54,210,147,23,120,50,
+        59,125,33,126,124,57,63,11,202,157,74,88,77,187,149,52,236,168,237,250,253,63,78,181,
+        102,117,143,11,0,0,
+    };
+    const unsigned char kAsset1Brotli[] = {
+        27,142,11,0,172,10,108,99,88,216,99,143,198,61,183,134,168,41,135,115,113,250,22,107,
+        228,191,185,57,173,47,76,53,92,183,218,86,102,114,228,31,94,71,75,1,36,35,39,41,
+        91,196,5,208,144,186,173,191,149,77,76,70,233,26,30,242,193,36,140,99,49,180,250,76,
+        43,123,179,114,239,79,8,129,85,127,179,119,148,90,198,131,67,37,151,228,213,241,148,82,
+        133,5,97,177,22,137,20,223,73,116,4,91,250,153,92,193,197,152,133,145,240,219,59,1,
+        195,76,100,190,231,20,0,80,187,225,206,35,13,23,231,41,196,217,22,52,62,124,178,152,
+        35,60,19,170,117,81,249,79,147,45,153,231,115,83,6,0,83,75,165,184,200,6,223,207,
+        161,233,150,164,119,71,163,74,85,177,119,236,100,71,145,177,147,116,153,233,163,0,126,136,
+        3,213,12,151,27,254,123,63,106,121,74,195,148,154,138,237,41,10,254,121,57,251,213,156,
+        150,207,59,22,57,246,103,235,100,90,120,156,36,129,115,142,179,63,171,29,4,176,149,43,
+        160,39,53,8,21,116,113,38,224,62,112,97,112,201,253,119,149,94,236,183,17,65,236,123,
+        206,214,155,36,109,21,140,236,110,48,212,225,124,106,19,244,198,74,28,136,24,16,230,133,
+        0,91,36,171,184,74,7,172,238,102,170,65,56,222,213,234,197,148,172,91,111,112,118,79,
+        140,101,162,186,2,151,44,29,21,89,53,27,214,112,204,12,128,239,74,74,212,209,138,22,
+        198,214,91,147,27,44,72,20,196,253,12,223,236,242,110,101,39,164,255,50,0,184,179,243,
+        226,35,114,63,103,243,129,99,240,89,98,80,20,26,120,163,104,96,160,7,63,255,4,47,
+        94,199,112,202,151,87,142,109,227,73,10,160,149,34,103,241,230,136,187,114,104,145,253,137,
+        188,209,251,208,10,61,22,105,247,169,237,199,28,1,231,186,243,110,101,123,253,81,192,216,
+        18,129,247,11,184,94,161,160,8,183,86,101,147,106,210,69,152,170,102,13,221,134,181,215,
+        147,49,125,153,43,82,133,146,148,64,238,197,208,47,101,233,72,72,187,148,101,51,19,67,
+        53,128,144,224,33,15,115,253,28,211,99,132,159,175,254,7,50,141,185,235,4,49,210,47,
+        188,208,195,253,172,161,103,34,218,148,162,32,35,241,21,248,68,239,221,165,122,237,212,165,
+        53,5,190,41,227,24,40,66,157,255,79,34,147,255,138,222,179,185,158,14,118,210,211,3,
+        5,160,97,61,12,224,143,9,81,12,65,223,106,198,7,37,134,11,142,44,47,113,7,36,
+        123,104,240,37,115,245,83,208,75,249,64,158,134,69,57,123,11,183,97,209,228,143,135,190,
+        31,242,127,18,17,130,93,149,110,142,35,204,126,19,34,29,20,163,207,207,236,55,14,253,
+        240,143,173,81,194,12,194,251,197,49,142,186,17,177,175,115,219,146,154,6,68,98,28,54,
+        169,77,244,238,50,75,25,66,79,188,252,100,237,139,148,106,209,96,157,181,36,210,176,25,
+        61,213,178,116,63,249,182,113,89,22,192,46,39,164,142,149,126,165,88,156,77,183,200,30,
+        218,198,223,209,55,132,199,206,63,164,224,
+    };
+    const unsigned char kAsset2[] = {
+        58,114,111,111,116,32,123,10,32,32,32,32,99,111,108,111,114,45,115,99,104,101,109,101,
+        58,32,100,97,114,107,59,10,32,32,32,32,102,111,110,116,45,102,97,109,105,108,121,58,
+        32,34,83,101,103,111,101,32,85,73,34,44,32,115,121,115,116,101,109,45,117,105,44,32,
+        45,97,112,112,108,101,45,115,121,115,116,101,109,44,32,66,108,105,110,107,77,97,99,83,
+        121,115,116,101,109,70,111,110,116,44,32,115,97,110,115,45,115,101,114,105,102,59,10,32,
+        32,32,32,98,97,99,107,103,114,111,117,110,100,45,99,111,108,111,114,58,32,35,48,102,
+        49,49,49,55,59,10,32,32,32,32,99,111,108,111,114,58,32,35,102,53,102,55,102,98,
+        59,10,125,10,10,42,32,123,10,32,32,32,32,98,111,120,45,115,105,122,105,110,103,58,
+        32,98,111,114,100,101,114,45,98,111,120,59,10,125,10,10,98,111,100,121,32,123,10,32,
+        32,32,32,109,97,114,103,105,110,58,32,48,59,10,32,32,32,32,109,105,110,45,104,101,
+        105,103,104,116,58,32,49,48,48,118,104,59,10,32,32,32,32,98,97,99,107,103,114,111,
+        117,110,100,58,32,114,97,100,105,97,108,45,103,114,97,100,105,101,110,116,40,99,105,114,
+        99,108,101,32,97,116,32,116,111,112,44,32,114,103,98,97,40,53,51,44,32,57,50,44,
+        32,49,52,52,44,32,48,46,53,41,44,32,114,103,98,97,40,49,53,44,32,49,55,44,
+        32,50,51,44,32,49,41,32,53,53,37,41,59,10,125,10,10,46,97,112,112,32,123,10,
+        32,32,32,32,109,97,120,45,119,105,100,116,104,58,32,57,54,48,112,120,59,10,32,32,
+        32,32,109,97,114,103,105,110,58,32,48,32,97,117,116,111,59,10,32,32,32,32,112,97,
+        100,100,105,110,103,58,32,51,50,112,120,32,50,48,112,120,32,52,56,112,120,59,10,125,
+        10,10,46,104,101,114,111,32,123,10,32,32,32,32,100,105,115,112,108,97,121,58,32,102,
+        108,101,120,59,10,32,32,32,32,106,117,115,116,105,102,121,45,99,111,110,116,101,110,116,
+        58,32,115,112,97,99,101,45,98,101,116,119,101,101,110,59,10,32,32,32,32,97,108,105,
+        103,110,45,105,116,101,109,115,58,32,102,108,101,120,45,115,116,97,114,116,59,10,32,32,
+        32,32,103,97,112,58,32,51,50,112,120,59,10,32,32,32,32,109,97,114,103,105,110,45,
+        98,111,116,116,111,109,58,32,51,50,112,120,59,10,125,10,10,46,104,101,114,111,95,95,
+        101,121,101,98,114,111,119,32,123,10,32,32,32,32,116,101,120,116,45,116,114,97,110,115,
+        102,111,114,109,58,32,117,112,112,101,114,99,97,115,101,59,10,32,32,32,32,108,101,116,
+        116,101,114,45,115,112,97,99,105,110,103,58,32,48,46,50,101,109,59,10,32,32,32,32,
+        102,111,110,116,45,115,105,122,101,58,32,48,46,55,53,114,101,109,59,10,32,32,32,32,
+        111,112,97,99,105,116,121,58,32,48,46,56,59,10,32,32,32,32,109,97,114,103,105,110,
+        58,32,48,32,48,32,54,112,120,59,10,125,10,10,46,104,101,114,111,32,104,49,32,123,
+        10,32,32,32,32,109,97,114,103,105,110,58,32,48,59,10,32,32,32,32,102,111,110,116,
+        45,115,105,122,101,58,32,99,108,97,109,112,40,49,46,56,114,101,109,44,32,52,118,119,
+        44,32,50,46,52,114,101,109,41,59,10,125,10,10,46,104,101,114,111,95,95,108,101,97,
+        100,32,123,10,32,32,32,32,109,97,114,103,105,110,45,116,111,112,58,32,56,112,120,59,
+        10,32,32,32,32,109,97,120,45,119,105,100,116,104,58,32,53,50,99,104,59,10,32,32,
+        32,32,108,105,110,101,45,104,101,105,103,104,116,58,32,49,46,53,59,10,32,32,32,32,
+        99,111,108,111,114,58,32,114,103,98,97,40,50,52,53,44,32,50,52,55,44,32,50,53,
+        49,44,32,48,46,56,41,59,10,125,10,10,46,104,101,114,111,95,95,115,116,97,116,117,
+        115,32,123,10,32,32,32,32,98,97,99,107,103,114,111,117,110,100,58,32,114,103,98,97,
+        40,50,53,53,44,32,50,53,53,44,32,50,53,53,44,32,48,46,48,53,41,59,10,32,
+        32,32,32,98,111,114,100,101,114,45,114,97,100,105,117,115,58,32,49,50,112,120,59,10,
+        32,32,32,32,112,97,100,100,105,110,103,58,32,49,54,112,120,32,50,48,112,120,59,10,
+        32,32,32,32,116,101,120,116,45,97,108,105,103,110,58,32,99,101,110,116,101,114,59,10,
+        125,10,10,46,104,101,114,111,95,95,115,116,97,116,117,115,32,115,112,97,110,32,123,10,
+        32,32,32,32,102,111,110,116,45,115,105,122,101,58,32,48,46,56,114,101,109,59,10,32,
+        32,32,32,116,101,120,116,45,116,114,97,110,115,102,111,114,109,58,32,117,112,112,101,114,
+        99,97,115,101,59,10,32,32,32,32,108,101,116,116,101,114,45,115,112,97,99,105,110,103,
+        58,32,48,46,50,101,109,59,10,32,32,32,32,100,105,115,112,108,97,121,58,32,98,108,
+        111,99,107,59,10,32,32,32,32,109,97,114,103,105,110,45,98,111,116,116,111,109,58,32,
+        52,112,120,59,10,32,32,32,32,99,111,108,111,114,58,32,114,103,98,97,40,50,52,53,
+        44,32,50,52,55,44,32,50,53,49,44,32,48,46,55,41,59,10,125,10,10,46,104,101,
+        114,111,95,95,115,116,97,116,117,115,32,115,116,114,111,110,103,32,123,10,32,32,32,32,
+        102,111,110,116,45,115,105,122,101,58,32,49,46,52,114,101,109,59,10,125,10,10,46,103,
+        114,105,100,32,123,10,32,32,32,32,100,105,115,112,108,97,121,58,32,103,114,105,100,59,
+        10,32,32,32,32,103,114,105,100,45,116,101,109,112,108,97,116,101,45,99,111,108,117,109,
+        110,115,58,32,114,101,112,101,97,116,40,97,117,116,111,45,102,105,116,44,32,109,105,110,
+        109,97,120,40,50,54,48,112,120,44,32,49,102,114,41,41,59,10,32,32,32,32,103,97,
+        112,58,32,50,48,112,120,59,10,125,10,10,46,99,97,114,100,32,123,10,32,32,32,32,
+        98,97,99,107,103,114,111,117,110,100,58,32,114,103,98,97,40,50,48,44,32,50,52,44,
+        32,51,51,44,32,48,46,56,41,59,10,32,32,32,32,98,111,114,100,101,114,58,32,49,
+        112,120,32,115,111,108,105,100,32,114,103,98,97,40,50,53,53,44,32,50,53,53,44,32,
+        50,53,53,44,32,48,46,48,53,41,59,10,32,32,32,32,98,111,114,100,101,114,45,114,
+        97,100,105,117,115,58,32,49,56,112,120,59,10,32,32,32,32,112,97,100,100,105,110,103,
+        58,32,50,48,112,120,59,10,32,32,32,32,98,111,120,45,115,104,97,100,111,119,58,32,
+        48,32,49,53,112,120,32,52,48,112,120,32,114,103,98,97,40,48,44,32,48,44,32,48,
+        44,32,48,46,51,41,59,10,32,32,32,32,98,97,99,107,100,114,111,112,45,102,105,108,
+        116,101,114,58,32,98,108,117,114,40,49,52,112,120,41,59,10,125,10,10,46,99,97,114,
+        100,32,104,50,32,123,10,32,32,32,32,109,97,114,103,105,110,45,116,111,112,58,32,48,
+        59,10,32,32,32,32,109,97,114,103,105,110,45,98,111,116,116,111,109,58,32,49,54,112,
+        120,59,10,32,32,32,32,102,111,110,116,45,115,105,122,101,58,32,49,46,49,114,101,109,
+        59,10,125,10,10,46,99,97,114,100,45,45,115,112,97,110,32,123,10,32,32,32,32,103,
+        114,105,100,45,99,111,108,117,109,110,58,32,49,32,47,32,45,49,59,10,125,10,10,46,
+        99,97,114,100,95,95,104,101,97,100,101,114,32,123,10,32,32,32,32,100,105,115,112,108,
+        97,121,58,32,102,108,101,120,59,10,32,32,32,32,97,108,105,103,110,45,105,116,101,109,
+        115,58,32,99,101,110,116,101,114,59,10,32,32,32,32,106,117,115,116,105,102,121,45,99,
+        111,110,116,101,110,116,58,32,115,112,97,99,101,45,98,101,116,119,101,101,110,59,10,32,
+        32,32,32,109,97,114,103,105,110,45,98,111,116,116,111,109,58,32,49,50,112,120,59,10,
+        125,10,10,46,108,105,110,107,45,98,117,116,116,111,110,32,123,10,32,32,32,32,98,111,
+        114,100,101,114,58,32,110,111,110,101,59,10,32,32,32,32,98,97,99,107,103,114,111,117,
+        110,100,58,32,110,111,110,101,59,10,32,32,32,32,99,111,108,111,114,58,32,35,55,102,
+        99,50,102,102,59,10,32,32,32,32,99,117,114,115,111,114,58,32,112,111,105,110,116,101,
+        114,59,10,32,32,32,32,102,111,110,116,45,115,105,122,101,58,32,48,46,57,114,101,109,
+        59,10,125,10,10,46,108,105,110,107,45,98,117,116,116,111,110,58,102,111,99,117,115,45,
+        118,105,115,105,98,108,101,32,123,10,32,32,32,32,111,117,116,108,105,110,101,58,32,50,
+        112,120,32,115,111,108,105,100,32,35,55,102,99,50,102,102,59,10,32,32,32,32,111,117,
+        116,108,105,110,101,45,111,102,102,115,101,116,58,32,50,112,120,59,10,125,10,10,102,111,
+        114,109,32,108,97,98,101,108,32,123,10,32,32,32,32,100,105,115,112,108,97,121,58,32,
+        102,108,101,120,59,10,32,32,32,32,102,108,101,120,45,100,105,114,101,99,116,105,111,110,
+        58,32,99,111,108,117,109,110,59,10,32,32,32,32,103,97,112,58,32,54,112,120,59,10,
+        32,32,32,32,102,111,110,116,45,115,105,122,101,58,32,48,46,56,53,114,101,109,59,10,
+        32,32,32,32,109,97,114,103,105,110,45,98,111,116,116,111,109,58,32,49,50,112,120,59,
+        10,125,10,10,105,110,112,117,116,44,10,98,117,116,116,111,110,32,123,10,32,32,32,32,
+        102,111,110,116,58,32,105,110,104,101,114,105,116,59,10,125,10,10,105,110,112,117,116,32,
+        123,10,32,32,32,32,98,111,114,100,101,114,58,32,49,112,120,32,115,111,108,105,100,32,
+        114,103,98,97,40,50,53,53,44,32,50,53,53,44,32,50,53,53,44,32,48,46,50,41,
+        59,10,32,32,32,32,98,111,114,100,101,114,45,114,97,100,105,117,115,58,32,56,112,120,
+        59,10,32,32,32,32,112,97,100,100,105,110,103,58,32,49,48,112,120,59,10,32,32,32,
+        32,98,97,99,107,103,114,111,117,110,100,58,32,114,103,98,97,40,49,53,44,32,49,55,
+        44,32,50,51,44,32,48,46,57,41,59,10,32,32,32,32,99,111,108,111,114,58,32,105,
+        110,104,101,114,105,116,59,10,125,10,10,98,117,116,116,111,110,91,116,121,112,101,61,34,
+        115,117,98,109,105,116,34,93,32,123,10,32,32,32,32,119,105,100,116,104,58,32,49,48,
+        48,37,59,10,32,32,32,32,98,111,114,100,101,114,58,32,110,111,110,101,59,10,32,32,
+        32,32,98,111,114,100,101,114,45,114,97,100,105,117,115,58,32,49,48,112,120,59,10,32,
+        32,32,32,112,97,100,100,105,110,103,58,32,49,50,112,120,59,10,32,32,32,32,98,97,
+        99,107,103,114,111,117,110,100,58,32,108,105,110,101,97,114,45,103,114,97,100,105,101,110,
+        116,40,49,51,53,100,101,103,44,32,35,53,97,55,99,102,97,44,32,35,51,55,57,55,
+        102,102,41,59,10,32,32,32,32,99,111,108,111,114,58,32,119,104,105,116,101,59,10,32,
+        32,32,32,102,111,110,116,45,119,101,105,103,104,116,58,32,54,48,48,59,10,32,32,32,
+        32,99,117,114,115,111,114,58,32,112,111,105,110,116,101,114,59,10,32,32,32,32,116,114,
+        97,110,115,105,116,105,111,110,58,32,111,112,97,99,105,116,121,32,48,46,50,115,32,101,
+        97,115,101,59,10,125,10,10,98,117,116,116,111,110,91,116,121,112,101,61,34,115,117,98,
+        109,105,116,34,93,58,104,111,118,101,114,32,123,10,32,32,32,32,111,112,97,99,105,116,
+        121,58,32,48,46,57,59,10,125,10,10,46,102,111,114,109,45,45,98,117,115,121,32,98,
+        117,116,116,111,110,91,116,121,112,101,61,34,115,117,98,109,105,116,34,93,32,123,10,32,
+        32,32,32,111,112,97,99,105,116,121,58,32,48,46,53,59,10,32,32,32,32,112,111,105,
+        110,116,101,114,45,101,118,101,110,116,115,58,32,110,111,110,101,59,10,125,10,10,46,115,
+        116,97,116,115,32,123,10,32,32,32,32,100,105,115,112,108,97,121,58,32,103,114,105,100,
+        59,10,32,32,32,32,103,114,105,100,45,116,101,109,112,108,97,116,101,45,99,111,108,117,
+        109,110,115,58,32,114,101,112,101,97,116,40,97,117,116,111,45,102,105,116,44,32,109,105,
+        110,109,97,120,40,49,50,48,112,120,44,32,49,102,114,41,41,59,10,32,32,32,32,103,
+        97,112,58,32,49,50,112,120,59,10,32,32,32,32,109,97,114,103,105,110,58,32,48,59,
+        10,125,10,10,46,115,116,97,116,115,32,100,105,118,32,123,10,32,32,32,32,98,97,99,
+        107,103,114,111,117,110,100,58,32,114,103,98,97,40,50,53,53,44,32,50,53,53,44,32,
+        50,53,53,44,32,48,46,48,51,41,59,10,32,32,32,32,98,111,114,100,101,114,45,114,
+        97,100,105,117,115,58,32,49,50,112,120,59,10,32,32,32,32,112,97,100,100,105,110,103,
+        58,32,49,50,112,120,59,10,125,10,10,46,115,116,97,116,115,32,100,116,32,123,10,32,
+        32,32,32,102,111,110,116,45,115,105,122,101,58,32,48,46,56,114,101,109,59,10,32,32,
+        32,32,108,101,116,116,101,114,45,115,112,97,99,105,110,103,58,32,48,46,50,101,109,59,
+        10,32,32,32,32,116,101,120,116,45,116,114,97,110,115,102,111,114,109,58,32,117,112,112,
+        101,114,99,97,115,101,59,10,32,32,32,32,109,97,114,103,105,110,58,32,48,59,10,32,
+        32,32,32,99,111,108,111,114,58,32,114,103,98,97,40,50,53,53,44,32,50,53,53,44,
+        32,50,53,53,44,32,48,46,54,41,59,10,125,10,10,46,115,116,97,116,115,32,100,100,
+        32,123,10,32,32,32,32,109,97,114,103,105,110,58,32,52,112,120,32,48,32,48,59,10,
+        32,32,32,32,102,111,110,116,45,115,105,122,101,58,32,49,46,50,114,101,109,59,10,125,
+        10,10,46,101,109,112,116,121,32,123,10,32,32,32,32,109,97,114,103,105,110,58,32,49,
+        54,112,120,32,48,59,10,32,32,32,32,112,97,100,100,105,110,103,58,32,50,52,112,120,
+        59,10,32,32,32,32,98,111,114,100,101,114,58,32,49,112,120,32,100,97,115,104,101,100,
+        32,114,103,98,97,40,50,53,53,44,32,50,53,53,44,32,50,53,53,44,32,48,46,50,
+        41,59,10,32,32,32,32,98,111,114,100,101,114,45,114,97,100,105,117,115,58,32,49,50,
+        112,120,59,10,32,32,32,32,116,101,120,116,45,97,108,105,103,110,58,32,99,101,110,116,
+        101,114,59,10,32,32,32,32,99,111,108,111,114,58,32,114,103,98,97,40,50,53,53,44,
+        32,50,53,53,44,32,50,53,53,44,32,48,46,54,41,59,10,125,10,10,46,116,111,114,
+        114,101,110,116,45,108,105,115,116,32,123,10,32,32,32,32,100,105,115,112,108,97,121,58,
+        32,102,108,101,120,59,10,32,32,32,32,102,108,101,120,45,100,105,114,101,99,116,105,111,
+        110,58,32,99,111,108,117,109,110,59,10,32,32,32,32,103,97,112,58,32,49,52,112,120,
+        59,10,125,10,10,46,116,111,114,114,101,110,116,32,123,10,32,32,32,32,98,111,114,100,
+        101,114,58,32,49,112,120,32,115,111,108,105,100,32,114,103,98,97,40,50,53,53,44,32,
+        50,53,53,44,32,50,53,53,44,32,48,46,48,56,41,59,10,32,32,32,32,98,111,114,
+        100,101,114,45,114,97,100,105,117,115,58,32,49,54,112,120,59,10,32,32,32,32,112,97,
+        100,100,105,110,103,58,32,49,54,112,120,59,10,32,32,32,32,98,97,99,107,103,114,111,
+        117,110,100,58,32,114,103,98,97,40,49,52,44,32,49,55,44,32,50,53,44,32,48,46,
+        56,41,59,10,125,10,10,46,116,111,114,114,101,110,116,45,45,99,111,109,112,108,101,116,
+        101,32,123,10,32,32,32,32,98,111,114,100,101,114,45,99,111,108,111,114,58,32,114,103,
+        98,97,40,56,56,44,32,50,48,48,44,32,49,52,48,44,32,48,46,53,41,59,10,125,
+        10,10,46,116,111,114,114,101,110,116,45,45,112,97,117,115,101,100,32,123,10,32,32,32,
+        32,98,111,114,100,101,114,45,99,111,108,111,114,58,32,114,103,98,97,40,50,53,53,44,
+        32,50,48,48,44,32,49,50,48,44,32,48,46,52,41,59,10,125,10,10,46,116,111,114,
+        114,101,110,116,95,95,104,101,97,100,101,114,32,123,10,32,32,32,32,100,105,115,112,108,
+        97,121,58,32,102,108,101,120,59,10,32,32,32,32,106,117,115,116,105,102,121,45,99,111,
+        110,116,101,110,116,58,32,115,112,97,99,101,45,98,101,116,119,101,101,110,59,10,32,32,
+        32,32,103,97,112,58,32,49,54,112,120,59,10,32,32,32,32,97,108,105,103,110,45,105,
+        116,101,109,115,58,32,102,108,101,120,45,115,116,97,114,116,59,10,32,32,32,32,109,97,
+        114,103,105,110,45,98,111,116,116,111,109,58,32,49,50,112,120,59,10,125,10,10,46,116,
+        111,114,114,101,110,116,95,95,104,101,97,100,101,114,32,104,51,32,123,10,32,32,32,32,
+        109,97,114,103,105,110,58,32,48,59,10,32,32,32,32,102,111,110,116,45,115,105,122,101,
+        58,32,49,114,101,109,59,10,125,10,10,46,116,111,114,114,101,110,116,95,95,109,101,116,
+        97,32,123,10,32,32,32,32,109,97,114,103,105,110,58,32,52,112,120,32,48,32,48,59,
+        10,32,32,32,32,102,111,110,116,45,115,105,122,101,58,32,48,46,56,53,114,101,109,59,
+        10,32,32,32,32,99,111,108,111,114,58,32,114,103,98,97,40,50,53,53,44,32,50,53,
+        53,44,32,50,53,53,44,32,48,46,54,41,59,10,125,10,10,46,116,111,114,114,101,110,
+        116,95,95,97,99,116,105,111,110,115,32,123,10,32,32,32,32,100,105,115,112,108,97,121,
+        58,32,102,108,101,120,59,10,32,32,32,32,103,97,112,58,32,56,112,120,59,10,32,32,
+        32,32,102,108,101,120,45,119,114,97,112,58,32,119,114,97,112,59,10,125,10,10,46,116,
+        111,114,114,101,110,116,95,95,97,99,116,105,111,110,32,123,10,32,32,32,32,98,97,99,
+        107,103,114,111,117,110,100,58,32,114,103,98,97,40,50,53,53,44,32,50,53,53,44,32,
+        50,53,53,44,32,48,46,49,41,59,10,32,32,32,32,98,111,114,100,101,114,58,32,49,
+        112,120,32,115,111,108,105,100,32,114,103,98,97,40,50,53,53,44,32,50,53,53,44,32,
+        50,53,53,44,32,48,46,49,53,41,59,10,32,32,32,32,98,111,114,100,101,114,45,114,
+        97,100,105,117,115,58,32,57,57,57,112,120,59,10,32,32,32,32,112,97,100,100,105,110,
+        103,58,32,54,112,120,32,49,52,112,120,59,10,32,32,32,32,99,111,108,111,114,58,32,
+        105,110,104,101,114,105,116,59,10,32,32,32,32,99,117,114,115,111,114,58,32,112,111,105,
+        110,116,101,114,59,10,125,10,10,46,116,111,114,114,101,110,116,95,95,97,99,116,105,111,
+        110,58,100,105,115,97,98,108,101,100,32,123,10,32,32,32,32,111,112,97,99,105,116,121,
+        58,32,48,46,52,59,10,32,32,32,32,99,117,114,115,111,114,58,32,100,101,102,97,117,
+        108,116,59,10,125,10,10,46,112,114,111,103,114,101,115,115,32,123,10,32,32,32,32,119,
+        105,100,116,104,58,32,49,48,48,37,59,10,32,32,32,32,104,101,105,103,104,116,58,32,
+        54,112,120,59,10,32,32,32,32,98,111,114,100,101,114,45,114,97,100,105,117,115,58,32,
+        57,57,57,112,120,59,10,32,32,32,32,111,118,101,114,102,108,111,119,58,32,104,105,100,
+        100,101,110,59,10,32,32,32,32,98,97,99,107,103,114,111,117,110,100,58,32,114,103,98,
+        97,40,50,53,53,44,32,50,53,53,44,32,50,53,53,44,32,48,46,49,41,59,10,125,
+        10,10,46,112,114,111,103,114,101,115,115,95,95,102,105,108,108,32,123,10,32,32,32,32,
+        104,101,105,103,104,116,58,32,49,48,48,37,59,10,32,32,32,32,98,97,99,107,103,114,
+        111,117,110,100,58,32,108,105,110,101,97,114,45,103,114,97,100,105,101,110,116,40,57,48,
+        100,101,103,44,32,35,50,102,100,54,56,48,44,32,35,53,49,99,52,102,55,41,59,10,
+        125,10,10,46,112,114,111,103,114,101,115,115,95,95,108,97,98,101,108,32,123,10,32,32,
+        32,32,109,97,114,103,105,110,45,116,111,112,58,32,54,112,120,59,10,32,32,32,32,102,
+        111,110,116,45,115,105,122,101,58,32,48,46,56,114,101,109,59,10,32,32,32,32,99,111,
+        108,111,114,58,32,114,103,98,97,40,50,53,53,44,32,50,53,53,44,32,50,53,53,44,
+        32,48,46,55,41,59,10,125,10,10,46,116,111,114,114,101,110,116,95,95,100,101,116,97,
+        105,108,115,32,123,10,32,32,32,32,100,105,115,112,108,97,121,58,32,102,108,101,120,59,
+        10,32,32,32,32,102,108,101,120,45,119,114,97,112,58,32,119,114,97,112,59,10,32,32,
+        32,32,103,97,112,58,32,49,50,112,120,59,10,32,32,32,32,109,97,114,103,105,110,45,
+        116,111,112,58,32,49,48,112,120,59,10,32,32,32,32,102,111,110,116,45,115,105,122,101,
+        58,32,48,46,56,53,114,101,109,59,10,32,32,32,32,99,111,108,111,114,58,32,114,103,
+        98,97,40,50,53,53,44,32,50,53,53,44,32,50,53,53,44,32,48,46,55,41,59,10,
+        125,10,10,46,116,111,97,115,116,32,123,10,32,32,32,32,112,111,115,105,116,105,111,110,
+        58,32,102,105,120,101,100,59,10,32,32,32,32,98,111,116,116,111,109,58,32,50,48,112,
+        120,59,10,32,32,32,32,114,105,103,104,116,58,32,50,48,112,120,59,10,32,32,32,32,
+        112,97,100,100,105,110,103,58,32,49,52,112,120,32,49,56,112,120,59,10,32,32,32,32,
+        98,111,114,100,101,114,45,114,97,100,105,117,115,58,32,57,57,57,112,120,59,10,32,32,
+        32,32,98,97,99,107,103,114,111,117,110,100,58,32,114,103,98,97,40,49,53,44,32,49,
+        55,44,32,50,51,44,32,48,46,57,41,59,10,32,32,32,32,98,111,114,100,101,114,58,
+        32,49,112,120,32,115,111,108,105,100,32,114,103,98,97,40,50,53,53,44,32,50,53,53,
+        44,32,50,53,53,44,32,48,46,49,41,59,10,32,32,32,32,111,112,97,99,105,116,121,
+        58,32,48,59,10,32,32,32,32,116,114,97,110,115,102,111,114,109,58,32,116,114,97,110,
+        115,108,97,116,101,89,40,49,48,112,120,41,59,10,32,32,32,32,116,114,97,110,115,105,
+        116,105,111,110,58,32,111,112,97,99,105,116,121,32,48,46,51,115,32,101,97,115,101,44,
+        32,116,114,97,110,115,102,111,114,109,32,48,46,51,115,32,101,97,115,101,59,10,32,32,
+        32,32,112,111,105,110,116,101,114,45,101,118,101,110,116,115,58,32,110,111,110,101,59,10,
+        125,10,10,46,116,111,97,115,116,91,100,97,116,97,45,107,105,110,100,61,34,115,117,99,
+        99,101,115,115,34,93,32,123,10,32,32,32,32,98,111,114,100,101,114,45,99,111,108,111,
+        114,58,32,114,103,98,97,40,56,56,44,32,50,48,48,44,32,49,52,48,44,32,48,46,
+        56,41,59,10,125,10,10,46,116,111,97,115,116,91,100,97,116,97,45,107,105,110,100,61,
+        34,101,114,114,111,114,34,93,32,123,10,32,32,32,32,98,111,114,100,101,114,45,99,111,
+        108,111,114,58,32,114,103,98,97,40,50,53,53,44,32,49,51,48,44,32,49,51,48,44,
+        32,48,46,57,41,59,10,125,10,10,46,116,111,97,115,116,45,45,118,105,115,105,98,108,
+        101,32,123,10,32,32,32,32,111,112,97,99,105,116,121,58,32,49,59,10,32,32,32,32,
+        116,114,97,110,115,102,111,114,109,58,32,116,114,97,110,115,108,97,116,101,89,40,48,41,
+        59,10,125,10,10,64,109,101,100,105,97,32,40,109,97,120,45,119,105,100,116,104,58,32,
+        54,52,48,112,120,41,32,123,10,32,32,32,32,46,104,101,114,111,32,123,10,32,32,32,
+        32,32,32,32,32,102,108,101,120,45,100,105,114,101,99,116,105,111,110,58,32,99,111,108,
+        117,109,110,59,10,32,32,32,32,32,32,32,32,97,108,105,103,110,45,105,116,101,109,115,
+        58,32,102,108,101,120,45,115,116,97,114,116,59,10,32,32,32,32,125,10,10,32,32,32,
+        32,46,116,111,114,114,101,110,116,95,95,104,101,97,100,101,114,32,123,10,32,32,32,32,
+        32,32,32,32,102,108,101,120,45,100,105,114,101,99,116,105,111,110,58,32,99,111,108,117,
+        109,110,59,10,32,32,32,32,125,10,125,10,
+    };
+    const unsigned char kAsset2Gzip[] = {
+        31,139,8,0,0,0,0,0,2,3,173,88,93,143,163,54,20,125,207,175,176,118,180,82,
+        82,225,20,19,200,7,163,74,85,31,42,245,161,79,171,62,84,171,42,50,248,18,220,1,
+        140,108,51,147,108,53,255,189,50,223,16,72,50,219,74,171,236,174,3,215,215,247,158,123,
+        206,113,124,41,132,70,255,44,16,66,40,20,137,144,88,133,49,164,224,35,70,229,203,115,
+        185,30,137,76,227,136,166,60,185,248,232,211,23,56,9,64,127,252,246,201,66,234,162,52,
+        164,184,224,22,194,52,207,19,192,213,138,133,126,73,120,246,242,59,13,191,148,255,255,85,
+        100,218,66,138,102,10,43,144,60,170,194,6,52,124,57,73,81,100,12,151,59,251,232,201,
+        142,8,33,187,231,46,27,31,61,69,94,180,139,130,231,197,251,98,241,67,157,104,32,206,
+        88,241,111,60,59,249,40,16,146,129,196,129,56,151,143,4,130,93,234,167,82,42,79,60,
+        243,145,93,197,75,121,134,99,224,167,88,251,136,216,246,107,60,206,194,71,146,50,78,19,
+        124,50,127,67,166,151,33,151,97,2,136,106,164,69,110,33,121,10,232,210,219,88,232,224,
+        88,136,184,174,133,236,181,183,170,215,137,103,33,178,179,144,179,177,16,89,33,207,251,188,
+        42,19,90,211,60,111,19,58,227,55,206,116,236,163,195,214,206,207,207,195,52,17,45,180,
+        168,214,114,202,88,121,186,141,147,159,145,99,231,103,228,238,243,234,132,235,24,164,168,35,
+        50,174,242,132,94,124,20,37,80,135,251,187,80,154,71,23,28,138,76,67,166,125,164,114,
+        26,2,14,64,191,1,100,213,51,52,225,167,12,115,13,169,170,94,197,74,83,169,171,47,
+        79,52,175,246,237,167,135,3,161,181,72,155,47,154,52,142,71,184,64,32,197,91,157,143,
+        134,179,198,90,210,76,69,66,166,62,42,242,28,100,72,21,84,177,18,208,26,36,54,25,
+        149,167,179,215,14,164,61,140,41,254,13,204,234,206,147,205,186,48,207,234,139,89,221,143,
+        235,101,163,237,160,38,49,153,238,124,47,118,152,208,52,95,146,245,94,26,148,186,175,111,
+        22,114,214,174,132,116,213,63,84,2,148,13,66,97,45,114,31,237,187,154,180,141,244,156,
+        176,6,82,194,51,232,0,182,246,6,40,46,33,226,184,158,133,28,215,128,196,35,6,60,
+        251,193,174,74,83,93,168,6,226,125,88,150,47,123,230,229,246,195,94,219,222,170,70,112,
+        53,1,6,180,133,242,17,105,91,215,162,136,108,107,20,61,119,93,42,49,224,163,16,50,
+        13,114,34,13,149,211,172,206,101,208,155,125,219,154,239,111,118,11,219,32,17,225,203,36,
+        206,220,38,217,155,5,220,77,21,80,105,41,178,211,117,238,164,108,116,245,194,73,114,54,
+        158,33,179,86,143,128,228,12,107,72,243,132,106,48,228,84,164,153,242,145,132,28,168,94,
+        154,49,197,17,215,150,161,148,148,158,151,142,25,102,11,145,72,174,86,189,25,170,10,110,
+        118,11,169,100,179,125,181,205,145,44,180,217,52,136,232,122,234,35,146,159,145,18,9,103,
+        31,5,193,254,10,4,93,255,75,250,140,41,19,111,102,138,136,103,216,197,80,76,185,133,
+        109,161,250,207,122,179,234,40,146,73,145,227,136,39,218,100,21,36,133,92,18,55,63,175,
+        122,231,139,157,137,145,177,39,155,75,182,77,42,131,246,144,182,61,38,32,198,61,8,150,
+        29,169,26,225,35,130,126,68,152,116,79,30,143,49,80,6,114,158,20,7,132,215,64,254,
+        81,182,28,39,223,50,160,209,56,28,20,90,139,172,21,166,170,109,153,200,224,90,94,186,
+        213,70,219,118,81,232,68,181,28,134,133,84,102,49,23,188,203,111,48,122,135,182,62,189,
+        157,253,72,132,133,194,175,92,241,32,129,58,15,81,104,67,71,62,114,90,252,12,246,170,
+        191,199,34,138,20,232,242,177,50,176,25,100,148,208,0,146,249,90,150,122,193,184,132,80,
+        115,97,24,164,236,74,15,247,83,205,181,215,251,142,211,231,10,202,179,188,208,214,98,80,
+        81,19,195,71,60,139,65,114,221,61,53,170,247,189,49,113,166,167,228,122,72,72,55,36,
+        227,65,237,11,188,189,62,172,6,157,236,39,88,229,255,85,95,114,248,233,147,42,130,148,
+        235,79,127,213,9,215,170,65,108,251,243,243,28,98,70,147,108,95,39,233,76,37,105,26,
+        74,101,103,94,200,198,99,112,178,208,147,71,119,97,68,45,244,180,217,29,118,81,52,76,
+        252,45,230,26,122,237,122,171,5,108,107,219,55,96,89,178,62,175,250,95,43,180,169,178,
+        66,80,210,255,92,17,252,88,188,182,99,218,83,246,67,133,106,131,62,140,131,66,93,208,
+        173,26,246,94,172,69,182,206,13,195,43,100,90,53,197,52,33,141,36,168,255,141,232,137,
+        51,73,244,196,185,242,114,253,221,25,127,125,92,212,55,143,139,122,203,67,245,54,250,182,
+        92,223,208,227,59,74,62,178,83,3,69,30,31,96,187,26,228,196,70,142,204,205,207,198,
+        184,77,144,191,211,146,27,164,185,30,123,248,210,193,216,99,69,115,59,69,235,120,128,81,
+        21,195,7,137,160,43,239,148,55,122,248,208,90,72,9,153,198,9,87,250,63,16,40,113,
+        155,206,214,1,63,200,118,246,126,230,148,219,73,103,56,199,119,110,205,119,94,223,170,54,
+        71,196,161,72,243,4,52,12,114,195,253,50,237,247,22,114,108,219,92,149,236,234,170,52,
+        10,145,211,66,1,155,15,80,157,169,140,224,148,17,220,97,132,251,186,255,136,188,87,37,
+        111,235,112,243,110,52,107,5,198,25,197,155,187,87,145,206,237,180,47,167,160,233,131,3,
+        51,16,212,143,128,243,120,164,37,238,212,124,213,202,138,180,218,88,214,224,77,154,53,243,
+        57,25,236,97,126,35,31,244,183,100,198,223,30,14,135,43,44,27,138,32,227,123,67,43,
+        204,147,90,54,113,20,159,113,69,131,164,197,101,79,109,220,97,20,6,17,45,146,74,243,
+        215,185,20,39,9,74,205,233,124,115,49,220,14,41,107,234,64,70,35,163,196,152,243,152,
+        51,214,192,244,177,218,246,83,57,30,35,158,52,70,174,247,203,199,231,251,222,225,96,87,
+        214,193,137,216,118,111,27,15,65,66,55,218,93,109,208,183,138,125,219,63,99,1,31,3,
+        236,110,12,88,6,154,242,68,221,97,212,62,68,103,165,185,74,175,243,84,223,53,81,93,
+        130,180,229,249,92,52,126,40,226,103,96,77,143,43,158,232,174,94,178,234,130,51,97,234,
+        204,164,119,215,182,121,120,60,104,76,31,158,176,213,248,135,150,158,197,171,236,64,249,79,
+        227,144,254,92,154,202,173,110,121,192,77,229,1,173,238,253,110,241,158,89,43,235,249,149,
+        81,77,241,11,207,152,49,126,97,8,74,181,206,239,1,145,217,175,102,98,129,148,66,222,
+        138,84,214,131,108,236,250,163,170,100,27,10,143,111,88,77,185,200,173,114,217,85,136,159,
+        83,96,156,162,101,239,119,163,173,185,113,175,234,96,253,159,244,238,57,132,187,26,245,190,
+        168,98,78,139,228,189,240,239,139,247,197,191,54,183,212,19,20,22,0,0,
+    };
+    const unsigned char kAsset2Brotli[] = {
+        27,19,22,0,156,5,78,153,21,127,216,20,234,28,57,113,28,78,56,210,207,225,244,149,
+        153,182,172,90,149,246,140,247,63,128,74,81,167,36,210,217,62,0,208,152,44,167,245,165,
+        117,158,38,57,131,138,77,155,50,215,19,68,161,47,187,166,146,238,91,123,77,57,4,174,
+        194,212,182,66,87,17,24,83,35,155,129,219,28,230,253,253,193,34,202,223,231,119,118,110,
+        47,0,160,11,44,52,27,81,45,234,92,109,12,125,127,105,255,232,88,137,143,32,158,28,
+        210,49,19,118,138,13,91,136,72,92,6,99,91,214,159,244,105,159,104,249,125,187,125,84,
+        121,122,105,215,200,105,192,144,24,7,147,228,8,171,147,103,43,220,126,22,11,55,248,26,
+        76,221,30,160,104,77,145,215,176,46,201,106,18,109,63,105,221,174,251,21,60,185,46,148,
+        189,25,84,51,176,223,145,148,17,251,152,246,233,220,12,250,201,255,204,136,101,55,155,70,
+        147,210,29,188,147,192,127,172,201,40,251,12,84,111,230,136,158,126,226,203,94,125,44,141,
+        191,37,233,169,175,106,227,59,10,68,133,53,83,13,221,27,244,56,223,215,205,232,102,213,
+        100,231,13,231,34,142,181,82,39,186,212,117,62,175,6,236,204,153,227,81,53,217,32,137,
+        182,71,60,246,208,244,57,71,175,201,205,172,66,161,79,98,223,86,213,251,18,159,129,117,
+        201,119,236,254,114,12,113,157,129,34,7,108,169,29,206,229,20,72,163,147,167,128,9,53,
+        184,29,73,125,108,218,228,1,11,237,52,170,188,250,251,243,139,127,131,26,214,9,32,54,
+        8,80,214,25,250,1,156,36,143,160,155,224,22,123,248,38,186,62,10,156,1,162,97,207,
+        221,138,239,63,89,229,98,224,124,218,97,179,173,216,164,93,86,140,47,71,95,202,255,7,
+        111,185,20,181,98,31,223,190,48,252,127,50,212,253,219,23,186,99,224,24,248,175,75,164,
+        48,10,222,193,124,28,122,139,139,160,211,45,236,129,100,130,73,77,94,173,188,222,12,182,
+        94,201,35,115,148,56,253,6,77,18,208,18,209,19,112,94,67,212,187,136,102,1,0,247,
+        230,208,241,75,92,125,72,234,99,242,62,141,254,20,85,32,128,154,97,27,159,108,148,137,
+        27,112,159,183,82,177,150,120,9,51,226,57,139,124,168,162,127,202,193,166,2,36,229,157,
+        71,176,157,206,225,185,2,222,50,7,115,103,252,203,217,12,83,245,37,194,164,55,110,229,
+        101,33,179,210,155,213,191,201,213,106,125,57,34,32,20,184,161,220,216,38,232,214,147,198,
+        12,21,216,84,80,8,210,93,165,64,56,235,32,149,140,11,37,66,105,74,144,5,0,58,
+        165,235,254,11,120,4,55,205,102,244,6,6,204,192,31,9,127,219,176,223,164,127,206,186,
+        143,43,197,87,211,102,102,12,240,8,179,202,33,234,32,9,29,5,96,72,163,194,131,209,
+        223,250,186,205,213,230,192,252,47,202,80,29,163,230,244,8,246,225,30,83,239,128,241,130,
+        192,115,156,30,153,186,13,29,68,40,222,107,222,35,249,237,198,223,39,246,106,133,219,111,
+        14,109,87,163,80,76,153,126,45,211,127,244,148,89,63,7,195,179,46,28,175,220,101,194,
+        144,57,158,104,147,33,148,24,97,221,130,201,140,89,134,82,246,36,206,112,86,172,52,50,
+        46,246,181,1,6,116,39,113,93,222,168,24,178,140,154,106,36,103,148,125,48,85,167,229,
+        250,209,54,85,102,161,162,148,54,234,147,213,144,60,158,55,79,49,154,66,73,234,195,52,
+        95,175,130,145,83,154,153,3,3,116,5,53,170,158,43,16,245,156,226,143,40,231,4,48,
+        127,162,197,187,143,140,125,188,220,191,133,242,204,55,88,205,90,161,242,24,9,210,86,145,
+        47,216,109,2,208,116,34,202,130,89,26,44,109,127,40,236,47,105,8,74,106,78,187,177,
+        123,54,145,13,8,140,113,189,115,183,144,8,229,196,76,180,172,95,134,168,150,12,74,98,
+        113,113,244,127,56,251,107,83,203,83,241,156,208,96,159,92,50,18,251,69,178,102,201,67,
+        205,186,167,108,157,147,131,217,92,246,76,178,178,222,137,165,121,174,151,39,148,66,106,135,
+        224,77,35,128,46,225,210,203,119,90,203,172,94,86,107,118,133,50,63,165,147,46,246,206,
+        96,149,84,124,84,85,199,111,246,85,187,208,79,176,104,155,40,39,10,236,42,132,86,234,
+        241,86,129,81,87,96,214,243,204,14,111,141,233,70,55,11,172,42,165,126,83,96,170,218,
+        24,165,27,56,78,199,217,226,38,106,89,186,234,66,76,231,248,186,77,103,241,48,238,15,
+        167,120,50,123,115,6,174,143,116,246,210,181,90,91,124,189,28,161,136,71,10,192,119,148,
+        16,62,105,12,169,86,10,80,56,18,167,34,116,203,25,171,16,63,26,200,218,169,221,14,
+        79,233,2,171,241,113,243,201,24,247,124,56,48,31,248,175,193,77,192,244,81,201,89,231,
+        51,189,59,5,103,79,20,198,153,198,37,113,6,229,112,148,124,41,197,245,188,56,4,69,
+        131,58,101,50,210,156,222,171,200,190,82,29,251,247,151,57,159,186,233,0,90,5,198,15,
+        67,19,229,20,45,119,55,240,205,193,183,155,117,127,16,19,46,138,208,191,100,24,88,1,
+        104,207,90,148,23,59,189,14,83,149,158,165,138,171,32,234,188,70,29,20,95,239,100,73,
+        49,115,71,127,200,87,136,229,23,191,40,103,38,5,118,205,190,123,186,28,16,9,15,78,
+        43,157,101,80,36,214,233,210,13,9,156,247,38,98,63,148,245,102,173,227,192,118,155,100,
+        100,56,59,66,2,54,178,105,250,149,90,135,111,217,22,127,170,178,243,132,104,90,134,46,
+        15,211,161,234,149,28,106,75,187,110,179,51,230,116,88,101,25,147,157,55,51,136,73,31,
+        95,220,50,89,229,142,108,186,53,89,160,72,235,5,69,9,97,60,85,63,122,82,33,202,
+        208,67,128,4,123,
+    };
+}
+
+// Sorted by path for http_assets_find().
+extern const HttpAsset kHttpAssets[] = {
+    { "/app.js", "text/javascript; charset=utf-8", "\"06e0136d7928da8d5543b1bbc54c0c25\"", "06e0136d7928",
+        kAsset0, sizeof(kAsset0), kAsset0Gzip, sizeof(kAsset0Gzip), kAsset0Brotli, sizeof(kAsset0Brotli) },
+    { "/index.html", "text/html; charset=utf-8", "\"bebc74d71bd30eb3023631fd638bd01d\"", "bebc74d71bd3",
+        kAsset1, sizeof(kAsset1), kAsset1Gzip, sizeof(kAsset1Gzip), kAsset1Brotli, sizeof(kAsset1Brotli) },
+    { "/styles.css", "text/css; charset=utf-8", "\"59bd3382df18c13dc30fcfdbe93e37bd\"", "59bd3382df18",
+        kAsset2, sizeof(kAsset2), kAsset2Gzip, sizeof(kAsset2Gzip), kAsset2Brotli, sizeof(kAsset2Brotli) },
+};
+
+extern const size_t kHttpAssetCount = sizeof(kHttpAssets) / sizeof(kHttpAssets[0]);
@@ -0,0 +1,187 @@
+#include "net/http_local.h"
+
+#include <afunix.h>
+#include <sddl.h>
+
+#include <wchar.h>
+
+#include "debug.h"
+
+namespace
+{
+    // Owner and SYSTEM only. Protected, so nothing is inherited from the
+    // directory the socket lives in.
+    const wchar_t kLocalSocketSddl[] = L"D:P(A;;FA;;;OW)(A;;FA;;;SY)";
+    const DWORD kAcceptRetryMs = 100;
+
+    static bool make_address(const wchar_t* path, SOCKADDR_UN* address)
+    {
+        ZeroMemory(address, sizeof(*address));
+        address->sun_family = AF_UNIX;
+        // Fails rather than truncates when the path does not fit.
+        return WideCharToMultiByte(CP_UTF8, 0, path, -1, address->sun_path,
+            static_cast<int>(sizeof(address->sun_path)), nullptr, nullptr) > 1;
+    }
+
+    // bind() wants the path free, but a crash leaves the socket file
+    // behind. Removes it unless a listener still answers there; anything
+    // that is not a socket file is left alone.
+    static bool clear_stale_socket(const wchar_t* path, const SOCKADDR_UN* address)
+    {
+        const DWORD attributes = GetFileAttributesW(path);
+        if(attributes == INVALID_FILE_ATTRIBUTES)
+        {
+            return true;
+        }
+        if((attributes & FILE_ATTRIBUTE_REPARSE_POINT) == 0)
+        {
+            return false;
+        }
+
+        SOCKET probe = socket(AF_UNIX, SOCK_STREAM, 0);
+        if(probe == INVALID_SOCKET)
+        {
+            return false;
+        }
+        const bool live = connect(probe, reinterpret_cast<const sockaddr*>(address), sizeof(*address)) == 0;
+        closesocket(probe);
+        return !live && DeleteFileW(path) != 0;
+    }
+
+    // The socket file is a reparse point, so it is opened as one rather
+    // than followed.
+    static bool restrict_socket_file(const wchar_t* path)
+    {
+        PSECURITY_DESCRIPTOR descriptor = nullptr;
+        if(!ConvertStringSecurityDescriptorToSecurityDescriptorW(kLocalSocketSddl, SDDL_REVISION_1, &descriptor, nullptr))
+        {
+            return false;
+        }
+
+        bool applied = false;
+        HANDLE file = CreateFileW(path, WRITE_DAC, 0, nullptr, OPEN_EXISTING,
+            FILE_FLAG_OPEN_REPARSE_POINT | FILE_FLAG_BACKUP_SEMANTICS, nullptr);
+        if(file != INVALID_HANDLE_VALUE)
+        {
+            applied = SetKernelObjectSecurity(file, DACL_SECURITY_INFORMATION, descriptor) != 0;
+            CloseHandle(file);
+        }
+        LocalFree(descriptor);
+        return applied;
+    }
+
+    DWORD WINAPI local_accept_thread(LPVOID context)
+    {
+        HttpLocalListener* listener = reinterpret_cast<HttpLocalListener*>(context);
+        while(!listener->stopping)
+        {
+            SOCKET client = accept(listener->socket, nullptr, nullptr);
+            if(client == INVALID_SOCKET)
+            {
+                if(listener->stopping)
+                {
+                    break;
+                }
+                // Out of buffers or a client that gave up mid-accept; back
+                // off instead of spinning.
+                Sleep(kAcceptRetryMs);
+                continue;
+            }
+
+            u_long non_blocking = 1;
+            if(ioctlsocket(client, FIONBIO, &non_blocking) != 0)
+            {
+                closesocket(client);
+                continue;
+            }
+            listener->on_accept(listener->context, client);
+        }
+        return 0;
+    }
+}
+
+// Expects Winsock to be started already; the poll loop's mg_mgr_init does.
+int http_local_listener_init(HttpLocalListener* listener, const wchar_t* path, HttpLocalAcceptFn on_accept, void* context)
+{
+    if(!listener)
+    {
+        return -1;
+    }
+    ZeroMemory(listener, sizeof(*listener));
+    listener->socket = INVALID_SOCKET;
+    if(!path || path[0] == L'\0' || !on_accept || wcslen(path) >= MAX_PATH)
+    {
+        return -1;
+    }
+
+    SOCKADDR_UN address;
+    if(!make_address(path, &address))
+    {
+        DebugOut("http_local: Socket path too long for AF_UNIX.\n");
+        return -1;
+    }
+    if(!clear_stale_socket(path, &address))
+    {
+        DebugOut("http_local: Socket path is in use or is not a socket.\n");
+        return -2;
+    }
+
+    listener->socket = socket(AF_UNIX, SOCK_STREAM, 0);
+    if(listener->socket == INVALID_SOCKET)
+    {
+        DebugOut("http_local: AF_UNIX sockets unavailable (error %d).\n", WSAGetLastError());
+        return -3;
+    }
+    if(bind(listener->socket, reinterpret_cast<const sockaddr*>(&address), sizeof(address)) != 0)
+    {
+        DebugOut("http_local: bind failed (error %d).\n", WSAGetLastError());
+        http_local_listener_shutdown(listener);
+        return -4;
+    }
+    wcscpy_s(listener->path, MAX_PATH, path);
+
+    // Nothing can connect before listen(), so the file is locked down first.
+    if(!restrict_socket_file(path) || listen(listener->socket, SOMAXCONN) != 0)
+    {
+        DebugOut("http_local: Could not secure or listen on the socket.\n");
+        http_local_listener_shutdown(listener);
+        return -5;
+    }
+
+    listener->on_accept = on_accept;
+    listener->context = context;
+    listener->thread = CreateThread(nullptr, 0, local_accept_thread, listener, 0, nullptr);
+    if(!listener->thread)
+    {
+        http_local_listener_shutdown(listener);
+        return -6;
+    }
+    return 0;
+}
+
+void http_local_listener_shutdown(HttpLocalListener* listener)
+{
+    if(!listener)
+    {
+        return;
+    }
+
+    InterlockedExchange(&listener->stopping, 1);
+    if(listener->socket != INVALID_SOCKET)
+    {
+        // Fails the accept() the thread is blocked in.
+        closesocket(listener->socket);
+    }
+    if(listener->thread)
+    {
+        WaitForSingleObject(listener->thread, INFINITE);
+        CloseHandle(listener->thread);
+    }
+    if(listener->path[0] != L'\0')
+    {
+        DeleteFileW(listener->path);
+    }
+
+    ZeroMemory(listener, sizeof(*listener));
+    listener->socket = INVALID_SOCKET;
+}
@@ -0,0 +1,29 @@
+#pragma once
+
+#include <winsock2.h>
+#include <windows.h>
+
+// Optional AF_UNIX listener for local automation (Windows 10 1803 and
+// later). It only accepts: a thread blocks in accept() and passes each
+// socket, already non-blocking, to the callback, which hands it to a poll
+// loop. Access is controlled by the socket file's DACL, which admits the
+// file's owner and SYSTEM only.
+
+typedef void (*HttpLocalAcceptFn)(void* context, SOCKET socket);
+
+struct HttpLocalListener
+{
+    SOCKET socket;
+    HANDLE thread;
+    volatile LONG stopping;
+    HttpLocalAcceptFn on_accept;
+    void* context;
+    wchar_t path[MAX_PATH];
+};
+
+// Fails when the path is too long for AF_UNIX, names something other than a
+// stale socket file, or already has a live listener behind it.
+int http_local_listener_init(HttpLocalListener* listener, const wchar_t* path, HttpLocalAcceptFn on_accept, void* context);
+// Joins the accept thread and removes the socket file. Sockets already
+// passed to the callback are the callee's.
+void http_local_listener_shutdown(HttpLocalListener* listener);
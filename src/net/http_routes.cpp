@@ -0,0 +1,315 @@
+#include "net/http_routes.h"
+
+#include <string.h>
+
+namespace
+{
+    struct HttpRouteSpec
+    {
+        const char* pattern;
+        unsigned int methods;
+        HttpRouteId route;
+    };
+
+    // Every API endpoint. A segment is a literal, `{id}` or `{action}`; at
+    // most one capture may sit beside the literals at any depth.
+    constexpr HttpRouteSpec kRouteSpecs[] = {
+        { "/api/session", HttpMethod_Get | HttpMethod_Head, HttpRoute_Session },
+        { "/api/debug/connections", HttpMethod_Get, HttpRoute_DebugConnections },
+        { "/api/torrents", HttpMethod_Get | HttpMethod_Post, HttpRoute_Torrents },
+        { "/api/torrents/{id}", HttpMethod_Delete, HttpRoute_Torrent },
+        { "/api/torrents/{id}/{action}", HttpMethod_Post, HttpRoute_TorrentAction },
+        { "/ws", HttpMethod_Get, HttpRoute_WebSocket },
+        { "/api/events", HttpMethod_Get, HttpRoute_Events },
+        { "/api/rpc", HttpMethod_Post, HttpRoute_Rpc },
+    };
+
+    const unsigned int kMaxRouteNodes = 64;
+
+    enum RouteSegmentKind
+    {
+        RouteSegment_Literal = 0,
+        RouteSegment_Id,
+        RouteSegment_Action
+    };
+
+    // Trie node. A node's children are contiguous: its literal children
+    // sorted for binary search, then its capture child, if any.
+    struct RouteNode
+    {
+        const char* literal;
+        size_t literal_len;
+        RouteSegmentKind kind;
+        unsigned int first_child;
+        unsigned int literal_children;
+        // Index of the capture child; 0 (the root) means none.
+        unsigned int capture_child;
+        HttpRouteId route;
+        unsigned int methods;
+        // Only used while building.
+        unsigned int parent;
+    };
+
+    struct RouteTrie
+    {
+        RouteNode nodes[kMaxRouteNodes];
+        unsigned int count;
+    };
+
+    constexpr int compare_segment(const char* a, size_t a_len, const char* b, size_t b_len)
+    {
+        for(size_t i = 0; i < a_len && i < b_len; ++i)
+        {
+            if(a[i] != b[i])
+            {
+                return static_cast<unsigned char>(a[i]) < static_cast<unsigned char>(b[i]) ? -1 : 1;
+            }
+        }
+        if(a_len == b_len)
+        {
+            return 0;
+        }
+        return a_len < b_len ? -1 : 1;
+    }
+
+    constexpr RouteSegmentKind segment_kind(const char* text, size_t len)
+    {
+        if(compare_segment(text, len, "{id}", 4) == 0)
+        {
+            return RouteSegment_Id;
+        }
+        if(compare_segment(text, len, "{action}", 8) == 0)
+        {
+            return RouteSegment_Action;
+        }
+        return RouteSegment_Literal;
+    }
+
+    // First inserts every pattern into a draft whose nodes only know their
+    // parent, then lays the draft out breadth-first so each node's children
+    // are contiguous and sorted. Runs at compile time; overflowing
+    // kMaxRouteNodes is a compile error.
+    constexpr RouteTrie build_route_trie()
+    {
+        RouteTrie draft{};
+        draft.count = 1;
+        for(const HttpRouteSpec& spec : kRouteSpecs)
+        {
+            unsigned int node = 0;
+            const char* cursor = spec.pattern;
+            while(*cursor == '/')
+            {
+                const char* segment = cursor + 1;
+                size_t len = 0;
+                while(segment[len] != '\0' && segment[len] != '/')
+                {
+                    ++len;
+                }
+                const RouteSegmentKind kind = segment_kind(segment, len);
+
+                unsigned int child = 0;
+                for(unsigned int i = 1; i < draft.count && child == 0; ++i)
+                {
+                    const RouteNode& candidate = draft.nodes[i];
+                    if(candidate.parent == node && candidate.kind == kind &&
+                        (kind != RouteSegment_Literal || compare_segment(candidate.literal, candidate.literal_len, segment, len) == 0))
+                    {
+                        child = i;
+                    }
+                }
+                if(child == 0)
+                {
+                    child = draft.count++;
+                    draft.nodes[child].literal = kind == RouteSegment_Literal ? segment : nullptr;
+                    draft.nodes[child].literal_len = kind == RouteSegment_Literal ? len : 0;
+                    draft.nodes[child].kind = kind;
+                    draft.nodes[child].parent = node;
+                }
+                node = child;
+                cursor = segment + len;
+            }
+            draft.nodes[node].route = spec.route;
+            draft.nodes[node].methods = spec.methods;
+        }
+
+        RouteTrie trie{};
+        unsigned int source[kMaxRouteNodes] = {};
+        trie.nodes[0] = draft.nodes[0];
+        trie.count = 1;
+        for(unsigned int at = 0; at < trie.count; ++at)
+        {
+            const unsigned int first = trie.count;
+            for(unsigned int i = 1; i < draft.count; ++i)
+            {
+                if(draft.nodes[i].parent != source[at] || draft.nodes[i].kind != RouteSegment_Literal)
+                {
+                    continue;
+                }
+                unsigned int pos = trie.count++;
+                while(pos > first && compare_segment(trie.nodes[pos - 1].literal, trie.nodes[pos - 1].literal_len,
+                    draft.nodes[i].literal, draft.nodes[i].literal_len) > 0)
+                {
+                    trie.nodes[pos] = trie.nodes[pos - 1];
+                    source[pos] = source[pos - 1];
+                    --pos;
+                }
+                trie.nodes[pos] = draft.nodes[i];
+                source[pos] = i;
+            }
+            trie.nodes[at].first_child = first;
+            trie.nodes[at].literal_children = trie.count - first;
+
+            for(unsigned int i = 1; i < draft.count; ++i)
+            {
+                if(draft.nodes[i].parent == source[at] && draft.nodes[i].kind != RouteSegment_Literal)
+                {
+                    trie.nodes[at].capture_child = trie.count;
+                    trie.nodes[trie.count] = draft.nodes[i];
+                    source[trie.count++] = i;
+                }
+            }
+        }
+        return trie;
+    }
+
+    constexpr RouteTrie kRouteTrie = build_route_trie();
+
+    static const RouteNode* find_literal_child(const RouteNode& node, const char* segment, size_t len)
+    {
+        unsigned int low = node.first_child;
+        unsigned int high = node.first_child + node.literal_children;
+        while(low < high)
+        {
+            const unsigned int mid = low + (high - low) / 2;
+            const RouteNode& candidate = kRouteTrie.nodes[mid];
+            const int order = compare_segment(candidate.literal, candidate.literal_len, segment, len);
+            if(order == 0)
+            {
+                return &candidate;
+            }
+            if(order < 0)
+            {
+                low = mid + 1;
+            }
+            else
+            {
+                high = mid;
+            }
+        }
+        return nullptr;
+    }
+
+    static bool parse_id(const char* text, size_t len, unsigned int* out_id)
+    {
+        if(len == 0 || len > 10)
+        {
+            return false;
+        }
+        unsigned long long value = 0;
+        for(size_t i = 0; i < len; ++i)
+        {
+            if(text[i] < '0' || text[i] > '9')
+            {
+                return false;
+            }
+            value = value * 10 + static_cast<unsigned int>(text[i] - '0');
+        }
+        if(value == 0 || value > 0xFFFFFFFFull)
+        {
+            return false;
+        }
+        *out_id = static_cast<unsigned int>(value);
+        return true;
+    }
+
+    struct HttpMethodName
+    {
+        const char* name;
+        size_t len;
+        HttpMethod method;
+    };
+
+    const HttpMethodName kMethodNames[] = {
+        { "GET", 3, HttpMethod_Get },
+        { "HEAD", 4, HttpMethod_Head },
+        { "POST", 4, HttpMethod_Post },
+        { "PUT", 3, HttpMethod_Put },
+        { "DELETE", 6, HttpMethod_Delete },
+    };
+}
+
+HttpMethod http_method_parse(const char* text, size_t len)
+{
+    if(!text)
+    {
+        return HttpMethod_Other;
+    }
+    for(size_t i = 0; i < sizeof(kMethodNames) / sizeof(kMethodNames[0]); ++i)
+    {
+        if(kMethodNames[i].len == len && memcmp(kMethodNames[i].name, text, len) == 0)
+        {
+            return kMethodNames[i].method;
+        }
+    }
+    return HttpMethod_Other;
+}
+
+bool http_routes_match(HttpMethod method, const char* path, size_t path_len, HttpRouteMatch* out)
+{
+    if(!out)
+    {
+        return false;
+    }
+    memset(out, 0, sizeof(*out));
+    if(!path || path_len == 0 || path[0] != '/')
+    {
+        return false;
+    }
+
+    const RouteNode* node = &kRouteTrie.nodes[0];
+    size_t pos = 0;
+    while(pos < path_len)
+    {
+        const char* segment = path + pos + 1;
+        const char* slash = static_cast<const char*>(memchr(segment, '/', path_len - pos - 1));
+        const size_t len = slash ? static_cast<size_t>(slash - segment) : path_len - pos - 1;
+        pos += len + 1;
+
+        const RouteNode* child = find_literal_child(*node, segment, len);
+        if(child)
+        {
+            node = child;
+            continue;
+        }
+        if(node->capture_child == 0)
+        {
+            return false;
+        }
+        node = &kRouteTrie.nodes[node->capture_child];
+        if(node->kind == RouteSegment_Id)
+        {
+            if(!parse_id(segment, len, &out->id))
+            {
+                return false;
+            }
+        }
+        else
+        {
+            if(len == 0)
+            {
+                return false;
+            }
+            out->action = segment;
+            out->action_len = len;
+        }
+    }
+
+    if(node->route == HttpRoute_None)
+    {
+        memset(out, 0, sizeof(*out));
+        return false;
+    }
+    out->route = node->route;
+    out->method_allowed = (node->methods & static_cast<unsigned int>(method)) != 0;
+    return true;
+}
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stddef.h>
+
+// API endpoints. Each is one pattern in the table in http_routes.cpp.
+enum HttpRouteId
+{
+    HttpRoute_None = 0,
+    HttpRoute_Session,
+    HttpRoute_DebugConnections,
+    HttpRoute_Torrents,
+    HttpRoute_Torrent,
+    HttpRoute_TorrentAction,
+    HttpRoute_WebSocket,
+    HttpRoute_Events,
+    HttpRoute_Rpc,
+    HttpRoute_Count
+};
+
+// Request methods as bits, so a route can allow several.
+enum HttpMethod
+{
+    HttpMethod_Other = 0,
+    HttpMethod_Get = 1u << 0,
+    HttpMethod_Head = 1u << 1,
+    HttpMethod_Post = 1u << 2,
+    HttpMethod_Put = 1u << 3,
+    HttpMethod_Delete = 1u << 4
+};
+
+// Result of a match. Captures point into the matched path; nothing is
+// allocated or copied.
+struct HttpRouteMatch
+{
+    HttpRouteId route;
+    // False when the path names a route that does not take this method.
+    bool method_allowed;
+    // `{id}`: a non-zero decimal that fits in 32 bits; 0 when not captured.
+    unsigned int id;
+    // `{action}`: any non-empty segment; null when not captured.
+    const char* action;
+    size_t action_len;
+};
+
+HttpMethod http_method_parse(const char* text, size_t len);
+
+// Matches a request path (without the query string) segment by segment.
+// Returns false when no route has this path, whatever the method.
+bool http_routes_match(HttpMethod method, const char* path, size_t path_len, HttpRouteMatch* out);
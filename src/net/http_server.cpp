@@ -5,18 +5,395 @@
 #include <string.h>
 #include <wchar.h>
 #include <errno.h>
+#include <stdint.h>
 
+#include <algorithm>
+#include <deque>
+#include <new>
 #include <string>
+#include <vector>
 
 extern "C" {
 #include "mongoose.h"
 }
 
 #include "engine/engine_session.h"
+#include "net/deflate.h"
+#include "net/json_reader.h"
+#include "net/http_assets.h"
+#include "net/http_local.h"
+#include "net/http_routes.h"
+#include "net/http_workers.h"
+#include "net/json_writer.h"
+#include "net/torrent_schema.h"
 #include "debug.h"
 
 namespace
 {
+    const unsigned int kSearchDefaultLimit = 50;
+    const unsigned int kSearchMaxLimit = 1000;
+
+    // Queued frames move into mongoose's send buffer only while it holds less
+    // than this, so each connection copies at most about one window of data.
+    const size_t kWsSendWindow = 64 * 1024;
+
+    // Cap on frames queued behind a non-empty queue. State frames never wait
+    // behind each other (a busy client is coalesced to the latest state), so
+    // only replies such as error frames can hit it; they are dropped.
+    const size_t kWsQueueLimit = 256 * 1024;
+
+    // A client with output pending and no bytes written for this long is
+    // disconnected.
+    const ULONGLONG kWsStallTimeoutMs = 30000;
+
+    // Longest the loop blocks with nothing to do. Engine changes and shutdown
+    // wake it through mg_wakeup, so this is only a safety net.
+    const unsigned int kHttpIdleWaitMs = 60000;
+
+    // Torrent lists at least this long are serialized on the worker pool;
+    // shorter ones cost less to build than to hand off.
+    const size_t kHttpOffloadMinRows = 2000;
+
+    // Full torrent lists expected to be at least this long are streamed with
+    // chunked encoding instead of being built whole (see HttpListStream).
+    // Rows are taken from the engine kHttpStreamBatchRows at a time and go
+    // out about kHttpStreamChunkBytes at a time, only while the send buffer
+    // holds less than kWsSendWindow.
+    const size_t kHttpStreamMinRows = 20000;
+    const unsigned int kHttpStreamBatchRows = 512;
+    const size_t kHttpStreamChunkBytes = 16 * 1024;
+
+    // Request scratch buffers that grew past this are released once the
+    // response is out rather than kept for the next request.
+    const size_t kHttpScratchRetainBytes = 1024 * 1024;
+    // Retired cache entries and large-list row buffers kept for reuse.
+    const size_t kHttpSparePayloads = 8;
+    const size_t kHttpSpareRowSets = 2;
+
+    // /api/events: events per response, and how long a long-poll is held
+    // (`timeout`, in seconds) before it is answered with none.
+    const unsigned int kEventsDefaultLimit = 256;
+    const unsigned int kEventsMaxLimit = 1024;
+    const unsigned int kEventsDefaultTimeoutS = 25;
+    const unsigned int kEventsMaxTimeoutS = 60;
+    // A quiet SSE stream gets a comment line this often, so proxies and
+    // clients do not take it for dead.
+    const unsigned int kSseHeartbeatMs = 15000;
+
+    // /api/rpc: commands per request. The engine holds its state lock for
+    // the whole batch.
+    const size_t kRpcMaxCommands = 1024;
+
+    // Upper bound for HttpServerConfig::loop_count.
+    const unsigned int kHttpMaxLoops = 8;
+
+    // API bodies at least this large are gzipped for clients that accept it;
+    // below that the saving is not worth the CPU.
+    const size_t kHttpCompressMinBytes = 1024;
+
+    // Sec-WebSocket-Protocol value that selects binary frames; clients that
+    // do not offer it get JSON text frames.
+    const char kWsBinaryProtocol[] = "rawbit.bin.v1";
+
+    // permessage-deflate (RFC 7692) without context takeover on either side:
+    // every message is compressed on its own, so one compressed frame can be
+    // shared by all clients and client messages inflate without history.
+    const char kWsDeflateResponse[] =
+        "Sec-WebSocket-Extensions: permessage-deflate; server_no_context_takeover; client_no_context_takeover\r\n";
+    const unsigned char kWsFrameRsv1 = 0x40;
+    // Server payloads shorter than this go out uncompressed.
+    const size_t kWsCompressMinBytes = 256;
+
+    // Binary frame header: "RBW1", u8 kind, u8 flags, u16 record size, u64 seq.
+    const unsigned int kWsBinaryMagic = 0x31574252u;
+    const unsigned char kWsBinaryHasStats = 1u << 0;
+    const unsigned char kWsBinaryHasStrings = 1u << 1;
+
+    // Subscription topics; clients that never subscribe get both.
+    const unsigned int kWsTopicStats = 1u << 0;
+    const unsigned int kWsTopicTorrents = 1u << 1;
+    const unsigned int kWsTopicsAll = kWsTopicStats | kWsTopicTorrents;
+
+    const unsigned int kWsMinRateMs = 50;
+    const unsigned int kWsMaxRateMs = 60000;
+    const size_t kWsMaxSubscribedIds = 1024;
+
+    // Per-connection state kept inside mg_connection::data.
+    struct HttpConnectionState
+    {
+        unsigned int field_mask;
+        // Set when the client negotiated kWsBinaryProtocol.
+        unsigned int ws_binary : 1;
+        // Set when the client negotiated permessage-deflate.
+        unsigned int ws_deflate : 1;
+        // Plain HTTP: set while `event_feed` is the live union member.
+        unsigned int http_events : 1;
+        // Last delta sequence this WebSocket client holds (0 = none yet).
+        unsigned long long ws_seq;
+        // Private stream after a subscribe message (HttpWsSubscription*);
+        // null while the client follows the shared stream.
+        void* ws_subscription;
+        union
+        {
+            // Frames queued by reference (HttpWsOutput*), created on first send.
+            void* ws_output;
+            // Plain HTTP: torrent list being streamed (HttpListStream*).
+            void* http_stream;
+            // Plain HTTP: /api/events long-poll or SSE stream (HttpEventFeed*).
+            void* event_feed;
+        };
+    };
+
+    static_assert(sizeof(HttpConnectionState) <= MG_DATA_SIZE, "HttpConnectionState must fit in mg_connection::data");
+
+    // Cache key of the /api/session body. Torrent payloads are keyed by
+    // torrent_payload_key(format, field mask).
+    const unsigned int kSessionPayloadKey = ~0u;
+    const unsigned int kPayloadFormatShift = 16;
+
+    struct HttpCachedPayload
+    {
+        unsigned int key;
+        std::string body;
+        char etag[64];
+        // gzip form of `body`, built by the first request that accepts it;
+        // stays empty when compress_body() finds it not worth sending.
+        std::string gzip;
+        bool gzip_ready;
+    };
+
+    enum HttpWsFrameKind
+    {
+        HttpWsFrame_Full = 0,
+        HttpWsFrame_Resync,
+        HttpWsFrame_Patch,
+        HttpWsFrame_Count
+    };
+
+    // One encoded WebSocket frame, header included. Built once and shared by
+    // every connection it is queued on; freed when the last reference goes.
+    // Only the server thread touches it, so the count is a plain integer.
+    struct HttpWsFrameBuffer
+    {
+        unsigned int refs;
+        std::string bytes;
+    };
+
+    // Per-connection queue of frames not yet copied into `conn->send`.
+    struct HttpWsOutput
+    {
+        std::deque<HttpWsFrameBuffer*> frames;
+        size_t queued_bytes;
+        // 0 while nothing is pending; otherwise when output was first seen
+        // pending or last written.
+        ULONGLONG stall_tick;
+        // Broadcast intervals skipped because the client was still busy, and
+        // frames refused by kWsQueueLimit.
+        unsigned long long coalesced;
+        unsigned long long dropped;
+    };
+
+    // Wire form of a frame: JSON text or binary records, each either plain
+    // or permessage-deflate compressed.
+    enum HttpWsEncoding
+    {
+        HttpWsEncoding_Text = 0,
+        HttpWsEncoding_Binary,
+        HttpWsEncoding_TextDeflate,
+        HttpWsEncoding_BinaryDeflate,
+        HttpWsEncoding_Count
+    };
+
+    // Encoded WebSocket frames of one projection for the current sequence;
+    // null slots are built on first use. Each slot holds one reference.
+    struct HttpWsFrames
+    {
+        unsigned int field_mask;
+        HttpWsFrameBuffer* slots[HttpWsEncoding_Count][HttpWsFrame_Count];
+    };
+
+    struct HttpWsChangedRow
+    {
+        unsigned int index;
+        unsigned int fields;
+    };
+
+    // WebSocket delta stream. `published` is the state every client at `seq`
+    // holds; the lists describe how it differs from the state at `seq - 1`
+    // (indexes point into `published.torrents`).
+    struct HttpWsDelta
+    {
+        bool primed;
+        unsigned int topics;
+        unsigned long long seq;
+        EngineSessionSnapshot published;
+        bool stats_changed;
+        std::vector<unsigned int> added;
+        std::vector<HttpWsChangedRow> changed;
+        std::vector<unsigned int> removed;
+        std::vector<HttpWsFrames> frames;
+    };
+
+    enum HttpWsFilter
+    {
+        HttpWsFilter_All = 0,
+        HttpWsFilter_Active,
+        HttpWsFilter_Paused,
+        HttpWsFilter_Complete
+    };
+
+    // A subscribed client's own delta stream, advanced at its own rate over
+    // only the rows it asked for. Owned by the connection, freed on close.
+    struct HttpWsSubscription
+    {
+        unsigned int rate_ms;
+        ULONGLONG last_tick;
+        HttpWsFilter filter;
+        // Sorted; empty means every torrent that passes the filter.
+        std::vector<unsigned int> ids;
+        HttpWsDelta delta;
+        EngineSessionSnapshot view;
+    };
+
+    // A connection parked on a payload job. The ID is looked up again on
+    // completion since the socket may have closed.
+    struct HttpPayloadWaiter
+    {
+        unsigned long id;
+        bool gzip;
+    };
+
+    // A torrent list or page body built on a worker. `compress` is fixed at
+    // submission (the first waiter accepts gzip), so the worker also builds
+    // `gzip`; later waiters that want it when it was not are served from the
+    // I/O thread.
+    struct HttpPayloadJob
+    {
+        HttpWorkItem item;
+        HttpServer* server;
+        unsigned int key;
+        bool paged;
+        bool compress;
+        EngineTorrentQuery query;
+        EngineSessionSnapshot snapshot;
+        unsigned int total;
+        std::string body;
+        std::string gzip;
+        std::vector<HttpPayloadWaiter> waiters;
+    };
+
+    // A full torrent list sent with chunked encoding, one bounded chunk per
+    // send-buffer refill. Rows are paged from the engine in ID order by
+    // keyset cursor, so one batch and one chunk are held however long the
+    // list is. Owned by the connection; freed after the last chunk or when
+    // the socket closes.
+    struct HttpListStream
+    {
+        EngineTorrentQuery query;
+        EngineSessionSnapshot batch;
+        // Set once a short batch shows the engine has no rows past it.
+        bool final_batch;
+        TorrentRowCursor cursor;
+        // JSON wraps the rows as {"stats":{...},"torrents":[...]}.
+        bool json_envelope;
+        std::string chunk;
+    };
+
+    // A connection following /api/events: a long-poll parked until events
+    // arrive or `deadline` passes, or an SSE stream that stays open. Owned
+    // by the connection; freed once answered or when the socket closes.
+    struct HttpEventFeed
+    {
+        bool sse;
+        // Last sequence the client holds.
+        unsigned long long since;
+        unsigned int limit;
+        ULONGLONG deadline;
+        ULONGLONG last_write;
+    };
+
+    // Temporaries of whatever the loop is handling: a request, a client
+    // message or a broadcast. A loop handles one at a time and copies each
+    // response into `conn->send` before moving on, so one set per loop
+    // serves every connection. Buffers are cleared, not freed, between uses
+    // (see trim_request_scratch), so steady traffic stops allocating.
+    struct HttpRequestScratch
+    {
+        EngineSessionSnapshot snapshot;
+        std::vector<EngineSearchHit> hits;
+        std::vector<EngineCommand> commands;
+        // Response body or frame payload, and its compressed form.
+        std::string body;
+        std::string compressed;
+        // Inflated client message; tokens point into it while it is handled.
+        std::string message;
+        std::vector<EngineEvent> events;
+        // Lists advance_delta() builds; swapped with the published ones, so
+        // each broadcast reuses the storage of the one before.
+        std::vector<unsigned int> added;
+        std::vector<HttpWsChangedRow> changed;
+        std::vector<unsigned int> removed;
+    };
+
+    // One snapshot and its serialized forms, shared by every HTTP poller and
+    // WebSocket client until the engine version moves. `epoch` keeps ETags
+    // from a previous run from matching after a restart.
+    struct HttpPayloadCache
+    {
+        bool valid;
+        unsigned long long epoch;
+        EngineSessionSnapshot snapshot;
+        // Entries before `payload_count` belong to `snapshot`; the rest are
+        // retired slots whose strings keep their capacity.
+        std::vector<HttpCachedPayload> payloads;
+        size_t payload_count;
+        HttpWsDelta ws;
+        // Jobs in flight on the worker pool, so repeat requests can join them.
+        std::vector<HttpPayloadJob*> jobs;
+        // Rows in the newest snapshot this loop took, streamed lists
+        // included; sizes the next list request. SIZE_MAX before the first.
+        size_t list_rows;
+        // Row buffers of finished payload jobs and streams, lent to the next.
+        std::vector<std::vector<EngineTorrentStatus>> spare_rows;
+        // Connections on this loop with an HttpEventFeed.
+        unsigned int event_feeds;
+        HttpRequestScratch scratch;
+    };
+
+    // An extra event loop in multi-loop mode. `server` shadows the primary:
+    // same config and ETag epoch, but its own cache and wakeup. Sockets the
+    // primary accepts for this loop wait in `handoff`.
+    struct HttpLoopShard
+    {
+        HttpServer server;
+        mg_event_handler_t http_protocol;
+        CRITICAL_SECTION handoff_lock;
+        std::vector<SOCKET> handoff;
+    };
+
+    struct HttpLoopSet
+    {
+        std::vector<HttpLoopShard*> shards;
+        unsigned int next;
+    };
+
+    // The optional local socket. Its accept thread queues sockets in
+    // `accepted` for the primary loop, which adopts them as it does TCP
+    // accepts.
+    struct HttpLocalTransport
+    {
+        HttpServer* server;
+        HttpLocalListener listener;
+        mg_event_handler_t http_protocol;
+        CRITICAL_SECTION accepted_lock;
+        std::vector<SOCKET> accepted;
+    };
+
+    static HttpConnectionState* connection_state(struct mg_connection* connection)
+    {
+        return reinterpret_cast<HttpConnectionState*>(connection->data);
+    }
+
     static void determine_web_root(wchar_t* dest, size_t dest_count, const wchar_t* requested)
     {
         if(!dest || dest_count == 0)
@@ -79,10 +456,7 @@ namespace
             return;
         }
         snapshot->torrents.clear();
-        snapshot->stats.torrent_count = 0;
-        snapshot->stats.active_count = 0;
-        snapshot->stats.download_rate = 0;
-        snapshot->stats.upload_rate = 0;
+        ZeroMemory(&snapshot->stats, sizeof(snapshot->stats));
     }
 
     static void collect_snapshot(const HttpServer* server, EngineSessionSnapshot* snapshot)
@@ -98,481 +472,3432 @@ namespace
         }
     }
 
-    static void append_json_escape(std::string& out, const char* text)
+    static void append_stats_fields(std::string& out, const EngineSessionStats& stats, unsigned short port)
+    {
+        out.append("\"port\":");
+        json_write_uint(out, port);
+        out.append(",\"torrent_count\":");
+        json_write_uint(out, stats.torrent_count);
+        out.append(",\"active\":");
+        json_write_uint(out, stats.active_count);
+        out.append(",\"download_rate\":");
+        json_write_uint(out, stats.download_rate);
+        out.append(",\"upload_rate\":");
+        json_write_uint(out, stats.upload_rate);
+    }
+
+    static void build_session_payload(const HttpServer* server, const EngineSessionSnapshot& snapshot, std::string& out)
+    {
+        out.clear();
+        out.reserve(256);
+        out.push_back('{');
+        append_stats_fields(out, snapshot.stats, server->config.port);
+        out.append(",\"hot_count\":");
+        json_write_uint(out, snapshot.stats.hot_count);
+        out.append(",\"cold_count\":");
+        json_write_uint(out, snapshot.stats.cold_count);
+        out.append(",\"hot_bytes\":");
+        json_write_uint(out, snapshot.stats.hot_bytes);
+        out.append(",\"cold_bytes\":");
+        json_write_uint(out, snapshot.stats.cold_bytes);
+        out.push_back('}');
+    }
+
+    // Parses a comma-separated `fields=` list into a mask. Unknown names fail.
+    static bool parse_field_mask(const char* text, unsigned int* out_mask)
     {
-        out.push_back('"');
-        if(text)
+        unsigned int mask = 0;
+        const char* cursor = text;
+        while(*cursor)
         {
-            while(*text)
+            const char* end = strchr(cursor, ',');
+            const size_t len = end ? static_cast<size_t>(end - cursor) : strlen(cursor);
+            if(len != 0)
             {
-                const unsigned char ch = static_cast<unsigned char>(*text);
-                switch(ch)
+                const int field = torrent_schema_find_field(cursor, len);
+                if(field < 0)
                 {
-                    case '\\': out.append("\\\\"); break;
-                    case '"': out.append("\\\""); break;
-                    case '\b': out.append("\\b"); break;
-                    case '\f': out.append("\\f"); break;
-                    case '\n': out.append("\\n"); break;
-                    case '\r': out.append("\\r"); break;
-                    case '\t': out.append("\\t"); break;
-                    default:
-                        if(ch < 0x20)
-                        {
-                            const char hex[] = "0123456789abcdef";
-                            out.append("\\u00");
-                            out.push_back(hex[(ch >> 4) & 0x0F]);
-                            out.push_back(hex[ch & 0x0F]);
-                        }
-                        else
-                        {
-                            out.push_back(static_cast<char>(ch));
-                        }
-                        break;
+                    return false;
                 }
-                ++text;
+                mask |= 1u << field;
+            }
+            cursor += len;
+            if(*cursor == ',')
+            {
+                ++cursor;
             }
         }
-        out.push_back('"');
+
+        if(mask == 0)
+        {
+            return false;
+        }
+        *out_mask = mask;
+        return true;
     }
 
-    static void append_uint(std::string& out, unsigned long long value)
+    static void build_torrents_payload(const HttpServer* server, const EngineSessionSnapshot& snapshot, unsigned int field_mask, std::string& out)
     {
-        char buffer[32];
-        _snprintf_s(buffer, sizeof(buffer), _TRUNCATE, "%llu", value);
-        out.append(buffer);
+        out.clear();
+        out.reserve(512);
+        out.append("{\"stats\":{");
+        append_stats_fields(out, snapshot.stats, server->config.port);
+        out.append("},\"torrents\":");
+        torrent_schema_write_json_array(out, snapshot.torrents, field_mask);
+        out.push_back('}');
     }
 
-    static void append_float(std::string& out, float value)
+    static void build_torrents_page_payload(const HttpServer* server, const EngineSessionSnapshot& snapshot,
+        const EngineTorrentQuery& query, unsigned int total, unsigned int field_mask, std::string& out)
     {
-        char buffer[32];
-        _snprintf_s(buffer, sizeof(buffer), _TRUNCATE, "%.4f", value);
-        out.append(buffer);
+        out.clear();
+        out.reserve(512);
+        out.append("{\"stats\":{");
+        append_stats_fields(out, snapshot.stats, server->config.port);
+        out.append("},\"total\":");
+        json_write_uint(out, total);
+        out.append(",\"offset\":");
+        json_write_uint(out, query.offset);
+        out.append(",\"torrents\":");
+        torrent_schema_write_json_array(out, snapshot.torrents, field_mask);
+        out.push_back('}');
     }
 
-    static void append_stats_fields(std::string& out, const EngineSessionSnapshot& snapshot, unsigned short port)
+    // JSON keeps the stats envelope; the export formats carry rows only.
+    static void build_torrents_body(const HttpServer* server, const EngineSessionSnapshot& snapshot, TorrentFormat format,
+        unsigned int field_mask, std::string& out)
     {
-        out.append("\"port\":");
-        append_uint(out, port);
-        out.append(",\"torrent_count\":");
-        append_uint(out, snapshot.stats.torrent_count);
-        out.append(",\"active\":");
-        append_uint(out, snapshot.stats.active_count);
-        out.append(",\"download_rate\":");
-        append_uint(out, snapshot.stats.download_rate);
-        out.append(",\"upload_rate\":");
-        append_uint(out, snapshot.stats.upload_rate);
+        if(format == TorrentFormat_Json)
+        {
+            build_torrents_payload(server, snapshot, field_mask, out);
+            return;
+        }
+        out.clear();
+        torrent_schema_write_rows(out, snapshot.torrents, field_mask, format);
     }
 
-    static void build_session_payload(const HttpServer* server, const EngineSessionSnapshot& snapshot, std::string& out)
+    static unsigned int torrent_payload_key(TorrentFormat format, unsigned int field_mask)
     {
-        out.clear();
-        out.reserve(256);
-        out.push_back('{');
-        append_stats_fields(out, snapshot, server->config.port);
-        out.push_back('}');
+        return (static_cast<unsigned int>(format) << kPayloadFormatShift) | field_mask;
     }
 
-    static void build_torrents_payload(const HttpServer* server, const EngineSessionSnapshot& snapshot, std::string& out)
+    static TorrentFormat payload_key_format(unsigned int key)
     {
-        out.clear();
-        out.reserve(512);
-        out.append("{\"stats\":{");
-        append_stats_fields(out, snapshot, server->config.port);
-        out.append("},\"torrents\":[");
-        for(size_t i = 0; i < snapshot.torrents.size(); ++i)
+        return static_cast<TorrentFormat>(key >> kPayloadFormatShift);
+    }
+
+    static unsigned int payload_key_fields(unsigned int key)
+    {
+        return key & ((1u << kPayloadFormatShift) - 1u);
+    }
+
+    static HttpPayloadCache* payload_cache(HttpServer* server)
+    {
+        return reinterpret_cast<HttpPayloadCache*>(server->payload_cache);
+    }
+
+    static void format_etag(const HttpPayloadCache* cache, unsigned long long version, const char* key, char* out, size_t out_len)
+    {
+        _snprintf_s(out, out_len, _TRUNCATE, "\"%llx-%llx-%s\"", cache->epoch, version, key);
+    }
+
+    static void format_payload_etag(const HttpPayloadCache* cache, unsigned long long version, unsigned int key, char* out, size_t out_len)
+    {
+        char key_text[16];
+        _snprintf_s(key_text, sizeof(key_text), _TRUNCATE, "%x", key);
+        format_etag(cache, version, key_text, out, out_len);
+    }
+
+    // A strong ETag names one encoding of a body, so a compressed form sends
+    // the quoted base ETag with `suffix` (e.g. "-gz") inside the quotes.
+    static void format_encoded_etag(const char* etag, const char* suffix, char* out, size_t out_len)
+    {
+        const size_t len = strlen(etag);
+        _snprintf_s(out, out_len, _TRUNCATE, "%.*s%s\"", static_cast<int>(len > 0 ? len - 1 : 0), etag, suffix);
+    }
+
+    // Drops every entry for the old snapshot, keeping a few slots for reuse.
+    static void retire_cached_payloads(HttpPayloadCache* cache)
+    {
+        cache->payload_count = 0;
+        if(cache->payloads.size() > kHttpSparePayloads)
         {
-            if(i != 0)
+            cache->payloads.resize(kHttpSparePayloads);
+        }
+    }
+
+    // Large-list snapshots (payload jobs, streams) take their row storage
+    // from the loop's spares and give it back when done, so a big list is not
+    // reallocated for every engine version.
+    static void borrow_snapshot_rows(HttpPayloadCache* cache, EngineSessionSnapshot* snapshot)
+    {
+        if(!cache->spare_rows.empty())
+        {
+            snapshot->torrents.swap(cache->spare_rows.back());
+            cache->spare_rows.pop_back();
+        }
+    }
+
+    static void return_snapshot_rows(HttpPayloadCache* cache, EngineSessionSnapshot* snapshot)
+    {
+        if(cache->spare_rows.size() < kHttpSpareRowSets && snapshot->torrents.capacity() != 0)
+        {
+            snapshot->torrents.clear();
+            cache->spare_rows.push_back(std::vector<EngineTorrentStatus>());
+            cache->spare_rows.back().swap(snapshot->torrents);
+        }
+    }
+
+    template <typename Buffer>
+    static void trim_scratch_buffer(Buffer& buffer)
+    {
+        if(buffer.capacity() * sizeof(buffer[0]) > kHttpScratchRetainBytes)
+        {
+            Buffer().swap(buffer);
+        }
+        buffer.clear();
+    }
+
+    // Resets the scratch once a response or broadcast is out. Buffers keep
+    // their capacity unless one outsized request grew them past
+    // kHttpScratchRetainBytes.
+    static void trim_request_scratch(HttpRequestScratch* scratch)
+    {
+        trim_scratch_buffer(scratch->snapshot.torrents);
+        trim_scratch_buffer(scratch->hits);
+        trim_scratch_buffer(scratch->commands);
+        trim_scratch_buffer(scratch->body);
+        trim_scratch_buffer(scratch->compressed);
+        trim_scratch_buffer(scratch->message);
+        trim_scratch_buffer(scratch->events);
+        trim_scratch_buffer(scratch->added);
+        trim_scratch_buffer(scratch->changed);
+        trim_scratch_buffer(scratch->removed);
+    }
+
+    // Next free entry, emptied and keyed; a retired slot when there is one.
+    static HttpCachedPayload* add_cached_payload(HttpPayloadCache* cache, unsigned int key)
+    {
+        if(cache->payload_count == cache->payloads.size())
+        {
+            cache->payloads.push_back(HttpCachedPayload());
+        }
+        HttpCachedPayload* payload = &cache->payloads[cache->payload_count++];
+        payload->key = key;
+        payload->body.clear();
+        payload->gzip.clear();
+        payload->gzip_ready = false;
+        return payload;
+    }
+
+    // Re-snapshots only when the engine version has moved since the last call.
+    static void refresh_payload_cache(HttpServer* server, HttpPayloadCache* cache)
+    {
+        const unsigned long long version = server->config.engine ? engine_session_version(server->config.engine) : 0;
+        if(cache->valid && version == cache->snapshot.version)
+        {
+            return;
+        }
+
+        collect_snapshot(server, &cache->snapshot);
+        retire_cached_payloads(cache);
+        cache->valid = true;
+        cache->list_rows = cache->snapshot.torrents.size();
+    }
+
+    static HttpCachedPayload* find_cached_payload(HttpPayloadCache* cache, unsigned int key)
+    {
+        for(size_t i = 0; i < cache->payload_count; ++i)
+        {
+            if(cache->payloads[i].key == key)
             {
-                out.push_back(',');
+                return &cache->payloads[i];
             }
-            const EngineTorrentStatus& status = snapshot.torrents[i];
-            out.append("{\"id\":");
-            append_uint(out, status.id);
-            out.append(",\"name\":");
-            append_json_escape(out, status.name);
-            out.append(",\"magnet\":");
-            append_json_escape(out, status.magnet_uri);
-            out.append(",\"progress\":");
-            append_float(out, status.progress);
-            out.append(",\"size\":");
-            append_uint(out, status.size_bytes);
-            out.append(",\"downloaded\":");
-            append_uint(out, status.downloaded_bytes);
-            out.append(",\"download_rate\":");
-            append_uint(out, status.download_rate);
-            out.append(",\"upload_rate\":");
-            append_uint(out, status.upload_rate);
-            out.append(",\"paused\":");
-            out.append(status.is_paused ? "true" : "false");
-            out.append(",\"complete\":");
-            out.append(status.is_complete ? "true" : "false");
-            out.push_back('}');
         }
-        out.append("]}");
+        return nullptr;
     }
 
-    static void respond_json(struct mg_connection* connection, int code, const std::string& body)
+    static HttpCachedPayload* cached_payload(HttpServer* server, unsigned int key)
     {
-        mg_http_reply(connection, code,
-            "Content-Type: application/json\r\nCache-Control: no-cache\r\n",
-            "%s", body.c_str());
+        HttpPayloadCache* cache = payload_cache(server);
+        refresh_payload_cache(server, cache);
+
+        HttpCachedPayload* existing = find_cached_payload(cache, key);
+        if(existing)
+        {
+            return existing;
+        }
+
+        HttpCachedPayload& payload = *add_cached_payload(cache, key);
+        format_payload_etag(cache, cache->snapshot.version, key, payload.etag, sizeof(payload.etag));
+        if(key == kSessionPayloadKey)
+        {
+            build_session_payload(server, cache->snapshot, payload.body);
+        }
+        else
+        {
+            build_torrents_body(server, cache->snapshot, payload_key_format(key), payload_key_fields(key), payload.body);
+        }
+        return &payload;
     }
 
-    static void respond_error(struct mg_connection* connection, int code, const char* message)
+    // True when the comma-separated header `name` lists `token` (case-
+    // insensitively). A `;q=0` parameter counts as refusing it.
+    static bool header_lists_token(const struct mg_http_message* message, const char* name, const char* token)
     {
-        mg_http_reply(connection, code,
-            "Content-Type: application/json\r\nCache-Control: no-cache\r\n",
-            "{ \"error\": \"%s\" }\n", message ? message : "unknown");
+        const struct mg_str* header = mg_http_get_header(const_cast<struct mg_http_message*>(message), name);
+        if(!header)
+        {
+            return false;
+        }
+
+        const size_t token_len = strlen(token);
+        const char* cursor = header->buf;
+        const char* end = header->buf + header->len;
+        while(cursor < end)
+        {
+            while(cursor < end && (*cursor == ' ' || *cursor == ','))
+            {
+                ++cursor;
+            }
+            const char* item = cursor;
+            while(cursor < end && *cursor != ',' && *cursor != ' ' && *cursor != ';')
+            {
+                ++cursor;
+            }
+            const bool named = static_cast<size_t>(cursor - item) == token_len && _strnicmp(item, token, token_len) == 0;
+
+            bool refused = false;
+            while(cursor < end && *cursor != ',')
+            {
+                if(*cursor == 'q' && cursor + 1 < end && cursor[1] == '=')
+                {
+                    refused = true;
+                    for(cursor += 2; cursor < end && *cursor != ',' && *cursor != ';' && *cursor != ' '; ++cursor)
+                    {
+                        if(*cursor != '0' && *cursor != '.')
+                        {
+                            refused = false;
+                        }
+                    }
+                    continue;
+                }
+                ++cursor;
+            }
+            if(named)
+            {
+                return !refused;
+            }
+        }
+        return false;
     }
 
-    static void respond_ok(struct mg_connection* connection)
+    // Sec-WebSocket-Protocol is a comma-separated list of offered names.
+    static bool offers_ws_protocol(struct mg_http_message* message, const char* protocol)
     {
-        mg_http_reply(connection, 200,
-            "Content-Type: application/json\r\nCache-Control: no-cache\r\n",
-            "{ \"status\": \"ok\" }\n");
+        return header_lists_token(message, "Sec-WebSocket-Protocol", protocol);
+    }
+
+    static bool accepts_gzip(const struct mg_http_message* message)
+    {
+        return header_lists_token(message, "Accept-Encoding", "gzip");
+    }
+
+    // Offers that restrict our window (server_max_window_bits) are declined;
+    // the encoder always uses the full 32 KB.
+    static bool offers_ws_deflate(struct mg_http_message* message)
+    {
+        const struct mg_str* header = mg_http_get_header(message, "Sec-WebSocket-Extensions");
+        if(!header || !header_lists_token(message, "Sec-WebSocket-Extensions", "permessage-deflate"))
+        {
+            return false;
+        }
+        const char* option = "server_max_window_bits";
+        const size_t option_len = strlen(option);
+        for(size_t pos = 0; pos + option_len <= header->len; ++pos)
+        {
+            if(_strnicmp(header->buf + pos, option, option_len) == 0)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // True when the request's If-None-Match list names `etag` (or is "*").
+    static bool etag_matches(const struct mg_http_message* message, const char* etag)
+    {
+        const struct mg_str header_name = mg_str("If-None-Match");
+        for(size_t i = 0; i < MG_MAX_HTTP_HEADERS && message->headers[i].name.len != 0; ++i)
+        {
+            if(mg_strcasecmp(message->headers[i].name, header_name) != 0)
+            {
+                continue;
+            }
+
+            const struct mg_str value = message->headers[i].value;
+            const size_t etag_len = strlen(etag);
+            if(value.len == 1 && value.buf[0] == '*')
+            {
+                return true;
+            }
+            for(size_t pos = 0; pos + etag_len <= value.len; ++pos)
+            {
+                if(memcmp(value.buf + pos, etag, etag_len) == 0)
+                {
+                    return true;
+                }
+            }
+            return false;
+        }
+        return false;
+    }
+
+    // Which of a body's ETags, plain (`etag`) or gzip (`gzip_etag`), the
+    // request's If-None-Match names, or nullptr for neither. Either encoding
+    // is a valid copy, so a 304 echoes the one the client holds.
+    static const char* held_etag(const struct mg_http_message* message, const char* etag, const char* gzip_etag)
+    {
+        if(etag_matches(message, gzip_etag))
+        {
+            return accepts_gzip(message) || !etag_matches(message, etag) ? gzip_etag : etag;
+        }
+        return etag_matches(message, etag) ? etag : nullptr;
     }
 
-    static bool parse_torrent_path(const struct mg_http_message* message, unsigned int* out_id, std::string& action)
-    {
-        if(!message)
-        {
-            return false;
-        }
+    static void respond_json(struct mg_connection* connection, int code, const std::string& body)
+    {
+        mg_http_reply(connection, code,
+            "Content-Type: application/json\r\nCache-Control: no-cache\r\n",
+            "%s", body.c_str());
+    }
+
+    // Leaves `out` holding the gzip form of `body`, or empty when the body is
+    // too small or does not shrink.
+    static void compress_body(const std::string& body, std::string& out)
+    {
+        out.clear();
+        if(body.size() < kHttpCompressMinBytes)
+        {
+            return;
+        }
+        deflate_gzip(body.data(), body.size(), out);
+        if(out.size() >= body.size())
+        {
+            out.clear();
+        }
+    }
+
+    static const std::string* payload_gzip(HttpCachedPayload* payload)
+    {
+        if(!payload->gzip_ready)
+        {
+            compress_body(payload->body, payload->gzip);
+            payload->gzip_ready = true;
+        }
+        return payload->gzip.empty() ? nullptr : &payload->gzip;
+    }
+
+    // Sends `body` verbatim (it may be binary), or `gzip` in its place when
+    // non-null. `etag` is the plain body's; the gzip form gets its "-gz" one.
+    static void respond_body(struct mg_connection* connection, const char* content_type, const std::string& body,
+        const std::string* gzip, const char* etag)
+    {
+        const std::string& sent = gzip ? *gzip : body;
+        char gzip_etag[112];
+        if(gzip)
+        {
+            format_encoded_etag(etag, "-gz", gzip_etag, sizeof(gzip_etag));
+        }
+        mg_printf(connection,
+            "HTTP/1.1 200 OK\r\nContent-Type: %s\r\n%sCache-Control: no-cache\r\nETag: %s\r\nVary: Accept-Encoding\r\nContent-Length: %lu\r\n\r\n",
+            content_type, gzip ? "Content-Encoding: gzip\r\n" : "", gzip ? gzip_etag : etag, static_cast<unsigned long>(sent.size()));
+        mg_send(connection, sent.data(), sent.size());
+    }
+
+    static void respond_not_modified(struct mg_connection* connection, const char* etag)
+    {
+        char headers[160];
+        _snprintf_s(headers, sizeof(headers), _TRUNCATE, "Cache-Control: no-cache\r\nETag: %s\r\nVary: Accept-Encoding\r\n", etag);
+        mg_http_reply(connection, 304, headers, "");
+    }
+
+    // 304 when the client holds the body tagged `etag` in either encoding.
+    static bool respond_if_held(struct mg_connection* connection, const struct mg_http_message* message, const char* etag)
+    {
+        char gzip_etag[112];
+        format_encoded_etag(etag, "-gz", gzip_etag, sizeof(gzip_etag));
+        const char* held = held_etag(message, etag, gzip_etag);
+        if(!held)
+        {
+            return false;
+        }
+        respond_not_modified(connection, held);
+        return true;
+    }
+
+    // As respond_body, or 304 when the client already holds `etag`. The body
+    // is gzipped here, into `gzip`, when the client accepts it.
+    static void respond_body_etag(struct mg_connection* connection, const struct mg_http_message* message,
+        const char* content_type, const std::string& body, const char* etag, std::string& gzip)
+    {
+        if(respond_if_held(connection, message, etag))
+        {
+            return;
+        }
+        gzip.clear();
+        if(accepts_gzip(message))
+        {
+            compress_body(body, gzip);
+        }
+        respond_body(connection, content_type, body, gzip.empty() ? nullptr : &gzip, etag);
+    }
+
+    // As respond_body_etag for a cached payload, whose gzip form is built once
+    // and reused until the engine version moves.
+    static void respond_payload(struct mg_connection* connection, const struct mg_http_message* message,
+        const char* content_type, HttpCachedPayload* payload)
+    {
+        if(respond_if_held(connection, message, payload->etag))
+        {
+            return;
+        }
+        respond_body(connection, content_type, payload->body, accepts_gzip(message) ? payload_gzip(payload) : nullptr, payload->etag);
+    }
+
+    static void respond_error(struct mg_connection* connection, int code, const char* message)
+    {
+        mg_http_reply(connection, code,
+            "Content-Type: application/json\r\nCache-Control: no-cache\r\n",
+            "{ \"error\": \"%s\" }\n", message ? message : "unknown");
+    }
+
+    static void respond_ok(struct mg_connection* connection)
+    {
+        mg_http_reply(connection, 200,
+            "Content-Type: application/json\r\nCache-Control: no-cache\r\n",
+            "{ \"status\": \"ok\" }\n");
+    }
+
+    // Takes one add-torrent member. String options point into the request
+    // body, decoded and NUL-terminated there. Returns false for members that
+    // are not add options, leaving the value to the caller.
+    static bool read_add_option(const char* name, JsonToken* value, EngineAddTorrentOptions* options)
+    {
+        if(strcmp(name, "magnet") == 0 && value->type == JsonToken_String)
+        {
+            options->magnet_uri = json_token_cstr(value);
+        }
+        else if(strcmp(name, "name") == 0 && value->type == JsonToken_String)
+        {
+            options->display_name = json_token_cstr(value);
+        }
+        else if(strcmp(name, "size") == 0 && value->type == JsonToken_Number)
+        {
+            double size_value = 0;
+            if(json_token_number(value, &size_value) && size_value > 0)
+            {
+                options->size_bytes = static_cast<unsigned long long>(size_value);
+            }
+        }
+        else
+        {
+            return false;
+        }
+        return true;
+    }
+
+    // Reads one add-torrent object whose `{` has already been consumed.
+    static bool parse_add_options(JsonReader* reader, EngineAddTorrentOptions* options)
+    {
+        ZeroMemory(options, sizeof(*options));
+
+        JsonToken key;
+        while(json_reader_next(reader, &key) && key.type != JsonToken_ObjectEnd)
+        {
+            JsonToken value;
+            if(!json_reader_next(reader, &value))
+            {
+                return false;
+            }
+
+            const char* name = json_token_cstr(&key);
+            if(!read_add_option(name, &value, options) && !json_reader_skip(reader, &value))
+            {
+                return false;
+            }
+        }
+        return key.type == JsonToken_ObjectEnd;
+    }
+
+    static bool http_method_is(const struct mg_http_message* message, const char* method)
+    {
+        if(!message || !method)
+        {
+            return false;
+        }
+        const struct mg_str expected = mg_str(method);
+        return mg_strcmp(message->method, expected) == 0;
+    }
+
+    // Serves a packed UI asset in the best encoding the client accepts. URLs
+    // pinned to the asset's version (`?v=`) are immutable; plain ones
+    // revalidate against the strong ETag of the encoding chosen, which is
+    // the raw bytes' ETag with "-br" or "-gz" inside the quotes.
+    static void respond_asset(struct mg_connection* connection, struct mg_http_message* message, const HttpAsset* asset)
+    {
+        char version[32];
+        const bool pinned = mg_http_get_var(&message->query, "v", version, sizeof(version)) > 0 && strcmp(version, asset->version) == 0;
+        const char* cache_control = pinned ? "public, max-age=31536000, immutable" : "no-cache";
+
+        const unsigned char* body = asset->data;
+        size_t size = asset->size;
+        const char* encoding = "";
+        char etag[96];
+        _snprintf_s(etag, sizeof(etag), _TRUNCATE, "%s", asset->etag);
+        if(asset->brotli && header_lists_token(message, "Accept-Encoding", "br"))
+        {
+            body = asset->brotli;
+            size = asset->brotli_size;
+            encoding = "Content-Encoding: br\r\n";
+            format_encoded_etag(asset->etag, "-br", etag, sizeof(etag));
+        }
+        else if(asset->gzip && header_lists_token(message, "Accept-Encoding", "gzip"))
+        {
+            body = asset->gzip;
+            size = asset->gzip_size;
+            encoding = "Content-Encoding: gzip\r\n";
+            format_encoded_etag(asset->etag, "-gz", etag, sizeof(etag));
+        }
+
+        if(etag_matches(message, etag))
+        {
+            char headers[192];
+            _snprintf_s(headers, sizeof(headers), _TRUNCATE, "Cache-Control: %s\r\nETag: %s\r\nVary: Accept-Encoding\r\n",
+                cache_control, etag);
+            mg_http_reply(connection, 304, headers, "");
+            return;
+        }
+
+        mg_printf(connection,
+            "HTTP/1.1 200 OK\r\nContent-Type: %s\r\n%sCache-Control: %s\r\nETag: %s\r\nVary: Accept-Encoding\r\nContent-Length: %lu\r\n\r\n",
+            asset->content_type, encoding, cache_control, etag, static_cast<unsigned long>(size));
+        if(!http_method_is(message, "HEAD"))
+        {
+            mg_send(connection, body, size);
+        }
+    }
+
+    // Body is one `{ "magnet": ..., "name": ..., "size": ... }` object or an
+    // array of them. The body is tokenized once and a batch is validated in
+    // full, then added as one engine command batch: all of it or none, and no
+    // snapshot sees part of it.
+    static void handle_add_torrent(struct mg_connection* connection, HttpServer* server, const struct mg_http_message* message)
+    {
+        if(!server->config.engine)
+        {
+            respond_error(connection, 503, "engine-unavailable");
+            return;
+        }
+
+        JsonReader reader;
+        json_reader_init(&reader, message->body.buf, message->body.len);
+
+        JsonToken first;
+        if(!json_reader_next(&reader, &first) || (first.type != JsonToken_ObjectBegin && first.type != JsonToken_ArrayBegin))
+        {
+            respond_error(connection, 400, "invalid-json");
+            return;
+        }
+
+        const bool batch = first.type == JsonToken_ArrayBegin;
+        HttpRequestScratch* scratch = &payload_cache(server)->scratch;
+        std::vector<EngineCommand>& commands = scratch->commands;
+        commands.clear();
+        JsonToken token = first;
+        while(true)
+        {
+            if(batch && (!json_reader_next(&reader, &token) || token.type == JsonToken_ArrayEnd))
+            {
+                break;
+            }
+            commands.resize(commands.size() + 1);
+            EngineCommand& command = commands.back();
+            ZeroMemory(&command, sizeof(command));
+            command.type = EngineCommand_Add;
+            if(token.type != JsonToken_ObjectBegin || !parse_add_options(&reader, &command.add))
+            {
+                respond_error(connection, 400, "invalid-json");
+                return;
+            }
+            if(!command.add.magnet_uri || command.add.magnet_uri[0] == '\0')
+            {
+                respond_error(connection, 400, "missing-magnet");
+                return;
+            }
+            if(!batch)
+            {
+                break;
+            }
+        }
+
+        if(!json_reader_done(&reader))
+        {
+            respond_error(connection, 400, "invalid-json");
+            return;
+        }
+        if(commands.empty())
+        {
+            respond_error(connection, 400, "missing-magnet");
+            return;
+        }
+        if(engine_session_run_commands(server->config.engine, commands.data(), commands.size(), true) != 0)
+        {
+            respond_error(connection, 500, "add-failed");
+            return;
+        }
+
+        std::string& body = scratch->body;
+        body.clear();
+        body.append(batch ? "{ \"status\": \"ok\", \"ids\": [" : "{ \"status\": \"ok\", \"id\": ");
+        for(size_t i = 0; i < commands.size(); ++i)
+        {
+            if(i != 0)
+            {
+                body.push_back(',');
+            }
+            json_write_uint(body, commands[i].torrent_id);
+        }
+        body.append(batch ? "] }\n" : " }\n");
+        respond_json(connection, 200, body);
+    }
+
+    static bool segment_is(const char* segment, size_t len, const char* literal)
+    {
+        return strlen(literal) == len && memcmp(segment, literal, len) == 0;
+    }
+
+    static void handle_modify_torrent(struct mg_connection* connection, HttpServer* server, const HttpRouteMatch& route)
+    {
+        if(!server->config.engine)
+        {
+            respond_error(connection, 503, "engine-unavailable");
+            return;
+        }
+
+        const unsigned int torrent_id = route.id;
+        int result = -1;
+        if(segment_is(route.action, route.action_len, "pause"))
+        {
+            result = engine_session_pause_torrent(server->config.engine, torrent_id);
+        }
+        else if(segment_is(route.action, route.action_len, "resume"))
+        {
+            result = engine_session_resume_torrent(server->config.engine, torrent_id);
+        }
+        else
+        {
+            respond_error(connection, 404, "unknown-action");
+            return;
+        }
+
+        if(result != 0)
+        {
+            respond_error(connection, 404, "not-found");
+            return;
+        }
+
+        respond_ok(connection);
+    }
+
+    static void handle_remove_torrent(struct mg_connection* connection, HttpServer* server, unsigned int torrent_id)
+    {
+        if(!server->config.engine)
+        {
+            respond_error(connection, 503, "engine-unavailable");
+            return;
+        }
+
+        if(engine_session_remove_torrent(server->config.engine, torrent_id) != 0)
+        {
+            respond_error(connection, 404, "not-found");
+            return;
+        }
+
+        respond_ok(connection);
+    }
+
+    static bool parse_rpc_op(const char* text, EngineCommandType* out_type)
+    {
+        static const struct
+        {
+            const char* name;
+            EngineCommandType type;
+        } kRpcOps[] = {
+            { "add", EngineCommand_Add },
+            { "pause", EngineCommand_Pause },
+            { "resume", EngineCommand_Resume },
+            { "remove", EngineCommand_Remove },
+            { "query", EngineCommand_Query },
+        };
+
+        for(size_t i = 0; i < sizeof(kRpcOps) / sizeof(kRpcOps[0]); ++i)
+        {
+            if(strcmp(text, kRpcOps[i].name) == 0)
+            {
+                *out_type = kRpcOps[i].type;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Reads one command object whose `{` has already been consumed. Returns
+    // the error to report, or null.
+    static const char* parse_rpc_command(JsonReader* reader, EngineCommand* command)
+    {
+        ZeroMemory(command, sizeof(*command));
+        const char* op = nullptr;
+
+        JsonToken key;
+        while(json_reader_next(reader, &key) && key.type != JsonToken_ObjectEnd)
+        {
+            JsonToken value;
+            if(!json_reader_next(reader, &value))
+            {
+                return "invalid-json";
+            }
+
+            const char* name = json_token_cstr(&key);
+            if(strcmp(name, "op") == 0 && value.type == JsonToken_String)
+            {
+                op = json_token_cstr(&value);
+            }
+            else if(strcmp(name, "id") == 0 && value.type == JsonToken_Number)
+            {
+                double id_value = 0;
+                if(!json_token_number(&value, &id_value) || id_value < 1 || id_value > 4294967295.0 ||
+                    id_value != static_cast<double>(static_cast<unsigned int>(id_value)))
+                {
+                    return "invalid-id";
+                }
+                command->torrent_id = static_cast<unsigned int>(id_value);
+            }
+            else if(!read_add_option(name, &value, &command->add) && !json_reader_skip(reader, &value))
+            {
+                return "invalid-json";
+            }
+        }
+        if(key.type != JsonToken_ObjectEnd)
+        {
+            return "invalid-json";
+        }
+
+        if(!op || !parse_rpc_op(op, &command->type))
+        {
+            return "unknown-op";
+        }
+        if(command->type == EngineCommand_Add && (!command->add.magnet_uri || command->add.magnet_uri[0] == '\0'))
+        {
+            return "missing-magnet";
+        }
+        if(command->type != EngineCommand_Add && command->type != EngineCommand_Query && command->torrent_id == 0)
+        {
+            return "missing-id";
+        }
+        return nullptr;
+    }
+
+    // Reads a command array whose `[` has already been consumed.
+    static const char* parse_rpc_commands(JsonReader* reader, std::vector<EngineCommand>& commands)
+    {
+        JsonToken token;
+        while(json_reader_next(reader, &token) && token.type != JsonToken_ArrayEnd)
+        {
+            if(commands.size() == kRpcMaxCommands)
+            {
+                return "too-many-commands";
+            }
+            if(token.type != JsonToken_ObjectBegin)
+            {
+                return "invalid-json";
+            }
+            commands.resize(commands.size() + 1);
+            const char* error = parse_rpc_command(reader, &commands.back());
+            if(error)
+            {
+                return error;
+            }
+        }
+        return token.type == JsonToken_ArrayEnd ? nullptr : "invalid-json";
+    }
+
+    static void append_rpc_result(std::string& out, const HttpServer* server, const EngineCommand& command)
+    {
+        if(command.result != kEngineCommandOk)
+        {
+            out.append(command.result == kEngineCommandNotFound ? "{\"ok\":false,\"error\":\"not-found\"}" :
+                "{\"ok\":false,\"error\":\"not-run\"}");
+            return;
+        }
+
+        out.append("{\"ok\":true");
+        if(command.type == EngineCommand_Add)
+        {
+            out.append(",\"id\":");
+            json_write_uint(out, command.torrent_id);
+        }
+        else if(command.type == EngineCommand_Query && command.torrent_id == 0)
+        {
+            out.append(",\"stats\":{");
+            append_stats_fields(out, command.stats, server->config.port);
+            out.push_back('}');
+        }
+        else if(command.type == EngineCommand_Query)
+        {
+            out.append(",\"torrent\":");
+            torrent_schema_write_json_object(out, command.status, kTorrentFieldsAll);
+        }
+        out.push_back('}');
+    }
+
+    // Body is a command array, or `{ "atomic": true, "commands": [...] }` to
+    // apply all of them or none. The request is parsed and checked in full,
+    // then the commands run in one engine pass and are answered in order.
+    static void handle_rpc_request(struct mg_connection* connection, HttpServer* server, const struct mg_http_message* message)
+    {
+        if(!server->config.engine)
+        {
+            respond_error(connection, 503, "engine-unavailable");
+            return;
+        }
+
+        JsonReader reader;
+        json_reader_init(&reader, message->body.buf, message->body.len);
+
+        JsonToken first;
+        if(!json_reader_next(&reader, &first) || (first.type != JsonToken_ObjectBegin && first.type != JsonToken_ArrayBegin))
+        {
+            respond_error(connection, 400, "invalid-json");
+            return;
+        }
+
+        HttpRequestScratch* scratch = &payload_cache(server)->scratch;
+        std::vector<EngineCommand>& commands = scratch->commands;
+        commands.clear();
+        bool atomic = false;
+        const char* error = nullptr;
+        if(first.type == JsonToken_ArrayBegin)
+        {
+            error = parse_rpc_commands(&reader, commands);
+        }
+        else
+        {
+            bool has_commands = false;
+            JsonToken key;
+            while(!error && json_reader_next(&reader, &key) && key.type != JsonToken_ObjectEnd)
+            {
+                JsonToken value;
+                if(!json_reader_next(&reader, &value))
+                {
+                    error = "invalid-json";
+                    break;
+                }
+                const char* name = json_token_cstr(&key);
+                if(strcmp(name, "atomic") == 0 && (value.type == JsonToken_True || value.type == JsonToken_False))
+                {
+                    atomic = value.type == JsonToken_True;
+                }
+                else if(strcmp(name, "commands") == 0 && value.type == JsonToken_ArrayBegin && !has_commands)
+                {
+                    has_commands = true;
+                    error = parse_rpc_commands(&reader, commands);
+                }
+                else if(!json_reader_skip(&reader, &value))
+                {
+                    error = "invalid-json";
+                }
+            }
+            if(!error && (key.type != JsonToken_ObjectEnd || !has_commands))
+            {
+                error = "invalid-json";
+            }
+        }
+        if(!error && !json_reader_done(&reader))
+        {
+            error = "invalid-json";
+        }
+        if(error)
+        {
+            respond_error(connection, strcmp(error, "too-many-commands") == 0 ? 413 : 400, error);
+            return;
+        }
+
+        const int result = engine_session_run_commands(server->config.engine, commands.data(), commands.size(), atomic);
+        if(result != 0 && result != -3)
+        {
+            respond_error(connection, 503, "engine-unavailable");
+            return;
+        }
+
+        std::string& body = scratch->body;
+        body.clear();
+        body.append(result == 0 ? "{ \"status\": \"ok\", \"results\": [" : "{ \"status\": \"rejected\", \"results\": [");
+        for(size_t i = 0; i < commands.size(); ++i)
+        {
+            if(i != 0)
+            {
+                body.push_back(',');
+            }
+            append_rpc_result(body, server, commands[i]);
+        }
+        body.append("] }\n");
+        respond_json(connection, result == 0 ? 200 : 409, body);
+    }
+
+    static void handle_session_request(struct mg_connection* connection, HttpServer* server, const struct mg_http_message* message)
+    {
+        HttpCachedPayload* payload = cached_payload(server, kSessionPayloadKey);
+        respond_payload(connection, message, "application/json", payload);
+    }
+
+    static bool query_var(const struct mg_http_message* message, const char* name, char* buffer, size_t buffer_len)
+    {
+        if(!message || !buffer || buffer_len == 0)
+        {
+            return false;
+        }
+        buffer[0] = '\0';
+        return mg_http_get_var(&message->query, name, buffer, buffer_len) > 0;
+    }
+
+    static unsigned int query_uint(const struct mg_http_message* message, const char* name, unsigned int fallback)
+    {
+        char buffer[16];
+        if(!query_var(message, name, buffer, sizeof(buffer)))
+        {
+            return fallback;
+        }
+        char* end_ptr = nullptr;
+        const unsigned long value = strtoul(buffer, &end_ptr, 10);
+        if(end_ptr && *end_ptr != '\0')
+        {
+            return fallback;
+        }
+        return static_cast<unsigned int>(value);
+    }
+
+    static bool parse_sort_key(const char* text, EngineSortKey* out_key)
+    {
+        static const struct
+        {
+            const char* name;
+            EngineSortKey key;
+        } kSortKeys[] = {
+            { "id", EngineSortKey_Id },
+            { "name", EngineSortKey_Name },
+            { "size", EngineSortKey_Size },
+            { "progress", EngineSortKey_Progress },
+            { "download_rate", EngineSortKey_DownloadRate },
+            { "upload_rate", EngineSortKey_UploadRate },
+        };
+
+        for(size_t i = 0; i < sizeof(kSortKeys) / sizeof(kSortKeys[0]); ++i)
+        {
+            if(strcmp(text, kSortKeys[i].name) == 0)
+            {
+                *out_key = kSortKeys[i].key;
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Returns false for malformed parameters; `out_paged` reports whether any
+    // paging parameter was present at all.
+    static bool parse_torrent_query(const struct mg_http_message* message, EngineTorrentQuery* query, bool* out_paged)
+    {
+        ZeroMemory(query, sizeof(*query));
+        query->sort_key = EngineSortKey_Id;
+        *out_paged = false;
+
+        char buffer[32];
+        if(query_var(message, "sort", buffer, sizeof(buffer)))
+        {
+            *out_paged = true;
+            if(!parse_sort_key(buffer, &query->sort_key))
+            {
+                return false;
+            }
+        }
+        if(query_var(message, "order", buffer, sizeof(buffer)))
+        {
+            *out_paged = true;
+            if(strcmp(buffer, "desc") == 0)
+            {
+                query->descending = 1;
+            }
+            else if(strcmp(buffer, "asc") != 0)
+            {
+                return false;
+            }
+        }
+        if(query_var(message, "offset", buffer, sizeof(buffer)))
+        {
+            *out_paged = true;
+            query->offset = query_uint(message, "offset", 0);
+        }
+        if(query_var(message, "limit", buffer, sizeof(buffer)))
+        {
+            *out_paged = true;
+            query->limit = query_uint(message, "limit", 0);
+        }
+        return true;
+    }
+
+    // Reads an optional `fields=` projection; absent means every column.
+    static bool query_field_mask(const struct mg_http_message* message, unsigned int* out_mask)
+    {
+        *out_mask = kTorrentFieldsAll;
+        char buffer[256];
+        if(!query_var(message, "fields", buffer, sizeof(buffer)))
+        {
+            return true;
+        }
+        return parse_field_mask(buffer, out_mask);
+    }
+
+    // Reads an optional `format=` (json, ndjson, csv, bin); absent means JSON.
+    static bool query_format(const struct mg_http_message* message, TorrentFormat* out_format)
+    {
+        *out_format = TorrentFormat_Json;
+        char buffer[16];
+        if(!query_var(message, "format", buffer, sizeof(buffer)))
+        {
+            return true;
+        }
+        return torrent_schema_parse_format(buffer, out_format);
+    }
+
+    static void format_page_etag(const HttpServer* server, unsigned long long version, const EngineTorrentQuery& query,
+        unsigned int payload_key, char* out, size_t out_len)
+    {
+        char key_text[64];
+        _snprintf_s(key_text, sizeof(key_text), _TRUNCATE, "%x.p%d%c.%u.%u",
+            payload_key, static_cast<int>(query.sort_key), query.descending ? 'd' : 'a', query.offset, query.limit);
+        format_etag(reinterpret_cast<const HttpPayloadCache*>(server->payload_cache), version, key_text, out, out_len);
+    }
+
+    static void build_torrents_page_body(const HttpServer* server, const EngineSessionSnapshot& snapshot, const EngineTorrentQuery& query,
+        unsigned int total, TorrentFormat format, unsigned int field_mask, std::string& out)
+    {
+        if(format == TorrentFormat_Json)
+        {
+            build_torrents_page_payload(server, snapshot, query, total, field_mask, out);
+            return;
+        }
+        out.clear();
+        torrent_schema_write_rows(out, snapshot.torrents, field_mask, format);
+    }
+
+    // Sizes the list by the last snapshot this thread saw. Before any
+    // snapshot the list is assumed large.
+    static bool should_offload(const HttpServer* server)
+    {
+        if(!server->workers || !server->config.engine)
+        {
+            return false;
+        }
+        return reinterpret_cast<const HttpPayloadCache*>(server->payload_cache)->list_rows >= kHttpOffloadMinRows;
+    }
+
+    // Worker side: takes its own snapshot, so the I/O thread never copies or
+    // serializes the list.
+    static void run_payload_job(HttpWorkItem* item)
+    {
+        HttpPayloadJob* job = reinterpret_cast<HttpPayloadJob*>(item);
+        const HttpServer* server = job->server;
+        const TorrentFormat format = payload_key_format(job->key);
+        const unsigned int field_mask = payload_key_fields(job->key);
+        reset_snapshot(&job->snapshot);
+        if(job->paged)
+        {
+            if(server->config.engine)
+            {
+                engine_session_snapshot_page(server->config.engine, &job->query, &job->snapshot, &job->total);
+            }
+            build_torrents_page_body(server, job->snapshot, job->query, job->total, format, field_mask, job->body);
+        }
+        else
+        {
+            collect_snapshot(server, &job->snapshot);
+            build_torrents_body(server, job->snapshot, format, field_mask, job->body);
+        }
+        if(job->compress)
+        {
+            compress_body(job->body, job->gzip);
+        }
+    }
+
+    // Stores a finished list body in the cache unless the cache has already
+    // moved past its version. Returns the cached entry, or nullptr if stale.
+    static HttpCachedPayload* adopt_payload_job(HttpPayloadCache* cache, HttpPayloadJob* job)
+    {
+        const unsigned long long version = job->snapshot.version;
+        if(cache->valid && cache->snapshot.version > version)
+        {
+            return nullptr;
+        }
+        if(!cache->valid || cache->snapshot.version != version)
+        {
+            std::swap(cache->snapshot, job->snapshot);
+            retire_cached_payloads(cache);
+            cache->valid = true;
+            cache->list_rows = cache->snapshot.torrents.size();
+        }
+
+        HttpCachedPayload* existing = find_cached_payload(cache, job->key);
+        if(existing)
+        {
+            return existing;
+        }
+        HttpCachedPayload& payload = *add_cached_payload(cache, job->key);
+        payload.body.swap(job->body);
+        payload.gzip.swap(job->gzip);
+        payload.gzip_ready = job->compress;
+        format_payload_etag(cache, version, job->key, payload.etag, sizeof(payload.etag));
+        return &payload;
+    }
+
+    // A page's gzip form, built here when the worker was not asked for it.
+    static const std::string* job_gzip(HttpPayloadJob* job)
+    {
+        if(!job->compress)
+        {
+            compress_body(job->body, job->gzip);
+            job->compress = true;
+        }
+        return job->gzip.empty() ? nullptr : &job->gzip;
+    }
+
+    static struct mg_connection* find_connection(struct mg_mgr* mgr, unsigned long id)
+    {
+        for(struct mg_connection* conn = mgr->conns; conn != nullptr; conn = conn->next)
+        {
+            if(conn->id == id)
+            {
+                return conn;
+            }
+        }
+        return nullptr;
+    }
+
+    // I/O thread side: caches the body and answers every waiter still open.
+    static void complete_payload_job(HttpWorkItem* item, void* context)
+    {
+        HttpPayloadJob* job = reinterpret_cast<HttpPayloadJob*>(item);
+        struct mg_mgr* mgr = reinterpret_cast<struct mg_mgr*>(context);
+        HttpPayloadCache* cache = payload_cache(job->server);
+        cache->jobs.erase(std::remove(cache->jobs.begin(), cache->jobs.end(), job), cache->jobs.end());
+
+        if(!item->cancelled)
+        {
+            const unsigned long long version = job->snapshot.version;
+            HttpCachedPayload* payload = nullptr;
+            char etag[96];
+            if(job->paged)
+            {
+                format_page_etag(job->server, version, job->query, job->key, etag, sizeof(etag));
+            }
+            else
+            {
+                format_payload_etag(cache, version, job->key, etag, sizeof(etag));
+                payload = adopt_payload_job(cache, job);
+            }
+            const std::string* body = payload ? &payload->body : &job->body;
+
+            const char* content_type = torrent_schema_content_type(payload_key_format(job->key));
+            for(size_t i = 0; i < job->waiters.size(); ++i)
+            {
+                struct mg_connection* conn = find_connection(mgr, job->waiters[i].id);
+                if(!conn || conn->is_closing)
+                {
+                    continue;
+                }
+                const std::string* gzip = nullptr;
+                if(job->waiters[i].gzip)
+                {
+                    gzip = payload ? payload_gzip(payload) : job_gzip(job);
+                }
+                respond_body(conn, content_type, *body, gzip, etag);
+                conn->is_resp = 0;
+            }
+        }
+        return_snapshot_rows(cache, &job->snapshot);
+        delete job;
+    }
+
+    static bool same_payload_job(const HttpPayloadJob* job, unsigned int key, const EngineTorrentQuery* query)
+    {
+        if(job->key != key || job->paged != (query != nullptr))
+        {
+            return false;
+        }
+        return !query || (job->query.sort_key == query->sort_key && job->query.descending == query->descending &&
+            job->query.offset == query->offset && job->query.limit == query->limit);
+    }
+
+    // Hands a large list (or, with `query`, page) to the worker pool and
+    // parks the connection until it completes; is_resp holds back any
+    // pipelined request meanwhile. A request for a body already being built
+    // joins that job. Returns false when the caller should answer inline.
+    static bool defer_torrents_body(struct mg_connection* connection, HttpServer* server, unsigned int key,
+        const EngineTorrentQuery* query, bool gzip)
+    {
+        if(!should_offload(server))
+        {
+            return false;
+        }
+
+        HttpPayloadCache* cache = payload_cache(server);
+        if(!query && cache->valid && find_cached_payload(cache, key) &&
+            cache->snapshot.version == engine_session_version(server->config.engine))
+        {
+            return false;
+        }
+
+        HttpPayloadJob* job = nullptr;
+        for(size_t i = 0; i < cache->jobs.size(); ++i)
+        {
+            if(same_payload_job(cache->jobs[i], key, query))
+            {
+                job = cache->jobs[i];
+                break;
+            }
+        }
+        if(!job)
+        {
+            job = new (std::nothrow) HttpPayloadJob();
+            if(!job)
+            {
+                return false;
+            }
+            job->item.run = run_payload_job;
+            job->item.complete = complete_payload_job;
+            job->server = server;
+            borrow_snapshot_rows(cache, &job->snapshot);
+            job->key = key;
+            job->paged = query != nullptr;
+            job->compress = gzip;
+            if(query)
+            {
+                job->query = *query;
+            }
+            if(!http_workers_submit(reinterpret_cast<HttpWorkerPool*>(server->workers), &job->item))
+            {
+                return_snapshot_rows(cache, &job->snapshot);
+                delete job;
+                return false;
+            }
+            cache->jobs.push_back(job);
+        }
+
+        HttpPayloadWaiter waiter = { connection->id, gzip };
+        job->waiters.push_back(waiter);
+        connection->is_resp = 1;
+        return true;
+    }
+
+    static HttpListStream* connection_stream(struct mg_connection* connection)
+    {
+        const HttpConnectionState* state = connection_state(connection);
+        return connection->is_websocket || state->http_events ? nullptr : reinterpret_cast<HttpListStream*>(state->http_stream);
+    }
+
+    static void release_list_stream(struct mg_connection* connection)
+    {
+        HttpListStream* stream = connection_stream(connection);
+        if(stream)
+        {
+            delete stream;
+            connection_state(connection)->http_stream = nullptr;
+        }
+    }
+
+    // Takes the rows after the last one sent. Each batch is its own engine
+    // version: a torrent added meanwhile shows up if its ID is still ahead of
+    // the cursor, one removed meanwhile is skipped, and none is sent twice.
+    static void fetch_stream_batch(HttpServer* server, HttpListStream* stream, unsigned int* out_total)
+    {
+        if(!stream->batch.torrents.empty())
+        {
+            stream->query.after_id = stream->batch.torrents.back().id;
+        }
+        engine_session_snapshot_page(server->config.engine, &stream->query, &stream->batch, out_total);
+        stream->final_batch = stream->batch.torrents.size() < stream->query.limit;
+        stream->cursor.next_row = 0;
+    }
+
+    // Tops the send buffer up with further chunks. The terminating chunk
+    // frees the stream and lets mongoose parse the next pipelined request.
+    static void pump_list_stream(struct mg_connection* connection)
+    {
+        HttpServer* server = reinterpret_cast<HttpServer*>(connection->fn_data);
+        HttpListStream* stream = connection_stream(connection);
+        while(stream && connection->send.len < kWsSendWindow)
+        {
+            const bool batch_done = torrent_schema_write_rows_chunk(stream->chunk, stream->batch.torrents, &stream->cursor,
+                kHttpStreamChunkBytes, stream->final_batch);
+            const bool done = batch_done && stream->final_batch;
+            if(done && stream->json_envelope)
+            {
+                stream->chunk.push_back('}');
+            }
+            // An empty chunk would end the response.
+            if(!stream->chunk.empty())
+            {
+                mg_http_write_chunk(connection, stream->chunk.data(), stream->chunk.size());
+                stream->chunk.clear();
+            }
+            if(done)
+            {
+                mg_http_write_chunk(connection, "", 0);
+                release_list_stream(connection);
+                connection->is_resp = 0;
+                return;
+            }
+            if(batch_done)
+            {
+                fetch_stream_batch(server, stream, nullptr);
+            }
+        }
+    }
+
+    // Streams a very large full list instead of building, caching and
+    // sending it whole; the response is never compressed. The body spans
+    // several engine versions, so it carries no ETag. Returns false when the
+    // caller should answer normally: when the body is already cached for the
+    // current version, and for the binary format, whose preamble needs the
+    // row count up front.
+    static bool stream_torrents_body(struct mg_connection* connection, HttpServer* server, unsigned int key)
+    {
+        HttpPayloadCache* cache = payload_cache(server);
+        const TorrentFormat format = payload_key_format(key);
+        if(!server->config.engine || cache->list_rows < kHttpStreamMinRows || format == TorrentFormat_Binary)
+        {
+            return false;
+        }
+        if(cache->valid && find_cached_payload(cache, key) &&
+            cache->snapshot.version == engine_session_version(server->config.engine))
+        {
+            return false;
+        }
+
+        HttpListStream* stream = new (std::nothrow) HttpListStream();
+        if(!stream)
+        {
+            return false;
+        }
+        ZeroMemory(&stream->query, sizeof(stream->query));
+        stream->query.sort_key = EngineSortKey_Id;
+        stream->query.limit = kHttpStreamBatchRows;
+        stream->batch.torrents.reserve(kHttpStreamBatchRows);
+        torrent_schema_cursor_init(&stream->cursor, payload_key_fields(key), format);
+        unsigned int total = 0;
+        fetch_stream_batch(server, stream, &total);
+        cache->list_rows = total;
+
+        // Stats describe the list as of its first batch.
+        stream->json_envelope = format == TorrentFormat_Json;
+        if(stream->json_envelope)
+        {
+            stream->chunk.append("{\"stats\":{");
+            append_stats_fields(stream->chunk, stream->batch.stats, server->config.port);
+            stream->chunk.append("},\"torrents\":");
+        }
+
+        mg_printf(connection,
+            "HTTP/1.1 200 OK\r\nContent-Type: %s\r\nCache-Control: no-cache\r\nTransfer-Encoding: chunked\r\n\r\n",
+            torrent_schema_content_type(format));
+        connection_state(connection)->http_stream = stream;
+        connection->is_resp = 1;
+        pump_list_stream(connection);
+        return true;
+    }
+
+    // Pages are not cached, but an unchanged engine version still answers a
+    // revalidation with 304 before any snapshot is taken.
+    static void handle_torrents_page_request(struct mg_connection* connection, HttpServer* server,
+        const struct mg_http_message* message, const EngineTorrentQuery& query, TorrentFormat format, unsigned int field_mask)
+    {
+        const unsigned int payload_key = torrent_payload_key(format, field_mask);
+        const char* content_type = torrent_schema_content_type(format);
+        char etag[96];
+        const unsigned long long version = server->config.engine ? engine_session_version(server->config.engine) : 0;
+        format_page_etag(server, version, query, payload_key, etag, sizeof(etag));
+        if(respond_if_held(connection, message, etag))
+        {
+            return;
+        }
+        if(defer_torrents_body(connection, server, payload_key, &query, accepts_gzip(message)))
+        {
+            return;
+        }
+
+        HttpRequestScratch* scratch = &payload_cache(server)->scratch;
+        EngineSessionSnapshot& snapshot = scratch->snapshot;
+        reset_snapshot(&snapshot);
+        snapshot.version = 0;
+        unsigned int total = 0;
+        if(server->config.engine)
+        {
+            engine_session_snapshot_page(server->config.engine, &query, &snapshot, &total);
+        }
+
+        build_torrents_page_body(server, snapshot, query, total, format, field_mask, scratch->body);
+        format_page_etag(server, snapshot.version, query, payload_key, etag, sizeof(etag));
+        respond_body_etag(connection, message, content_type, scratch->body, etag, scratch->compressed);
+    }
+
+    static void handle_search_request(struct mg_connection* connection, HttpServer* server, const struct mg_http_message* message, const char* query)
+    {
+        if(!server->config.engine)
+        {
+            respond_error(connection, 503, "engine-unavailable");
+            return;
+        }
+
+        unsigned int limit = query_uint(message, "limit", kSearchDefaultLimit);
+        if(limit == 0 || limit > kSearchMaxLimit)
+        {
+            limit = kSearchMaxLimit;
+        }
+
+        HttpRequestScratch* scratch = &payload_cache(server)->scratch;
+        std::vector<EngineSearchHit>& hits = scratch->hits;
+        hits.resize(limit);
+        unsigned int total = 0;
+        const unsigned int count = engine_session_search(server->config.engine, query, hits.data(), limit, &total);
+
+        std::string& body = scratch->body;
+        body.clear();
+        body.append("{\"query\":");
+        json_write_string(body, query);
+        body.append(",\"total\":");
+        json_write_uint(body, total);
+        body.append(",\"results\":[");
+        for(unsigned int i = 0; i < count; ++i)
+        {
+            if(i != 0)
+            {
+                body.push_back(',');
+            }
+            body.append("{\"id\":");
+            json_write_uint(body, hits[i].id);
+            body.append(",\"score\":");
+            json_write_uint(body, hits[i].score);
+            body.push_back('}');
+        }
+        body.append("]}");
+        respond_json(connection, 200, body);
+    }
+
+    // GET /api/torrents: search with `q=`, otherwise the list or a page.
+    static void handle_torrent_list_request(struct mg_connection* connection, HttpServer* server, const struct mg_http_message* message)
+    {
+        // mg_http_get_var() fails with -3 when `q` does not fit; that is
+        // rejected rather than searched truncated or ignored.
+        char search_query[kEngineSearchMaxQuery + 1];
+        const int query_len = mg_http_get_var(&message->query, "q", search_query, sizeof(search_query));
+        if(query_len == -3)
+        {
+            respond_error(connection, 400, "invalid-query");
+            return;
+        }
+        if(query_len > 0)
+        {
+            handle_search_request(connection, server, message, search_query);
+            return;
+        }
+
+        EngineTorrentQuery query;
+        bool paged = false;
+        unsigned int field_mask = kTorrentFieldsAll;
+        TorrentFormat format = TorrentFormat_Json;
+        if(!parse_torrent_query(message, &query, &paged) || !query_field_mask(message, &field_mask) || !query_format(message, &format))
+        {
+            respond_error(connection, 400, "invalid-query");
+            return;
+        }
+        if(paged)
+        {
+            handle_torrents_page_request(connection, server, message, query, format, field_mask);
+            return;
+        }
+
+        const unsigned int key = torrent_payload_key(format, field_mask);
+        const char* content_type = torrent_schema_content_type(format);
+        if(server->config.engine)
+        {
+            // Revalidation against the live version needs no snapshot.
+            char etag[64];
+            format_payload_etag(payload_cache(server), engine_session_version(server->config.engine), key, etag, sizeof(etag));
+            if(respond_if_held(connection, message, etag))
+            {
+                return;
+            }
+            if(stream_torrents_body(connection, server, key) ||
+                defer_torrents_body(connection, server, key, nullptr, accepts_gzip(message)))
+            {
+                return;
+            }
+        }
+
+        HttpCachedPayload* payload = cached_payload(server, key);
+        respond_payload(connection, message, content_type, payload);
+    }
+
+    // GET /api/debug/connections: one row per connection with its output
+    // backlog, so slow or stuck clients can be spotted.
+    static void handle_debug_connections(struct mg_connection* connection)
+    {
+        const ULONGLONG now = GetTickCount64();
+        std::string body;
+        body.reserve(1024);
+        body.append("{\"connections\":[");
+        bool first = true;
+        for(struct mg_connection* conn = connection->mgr->conns; conn != nullptr; conn = conn->next)
+        {
+            if(conn->is_listening)
+            {
+                continue;
+            }
+            if(!first)
+            {
+                body.push_back(',');
+            }
+            first = false;
+
+            const HttpConnectionState* state = connection_state(conn);
+            const HttpWsOutput* output = conn->is_websocket ? reinterpret_cast<const HttpWsOutput*>(state->ws_output) : nullptr;
+            body.append("{\"id\":");
+            json_write_uint(body, conn->id);
+            body.append(",\"websocket\":");
+            json_write_bool(body, conn->is_websocket != 0);
+            body.append(",\"send_bytes\":");
+            json_write_uint(body, conn->send.len);
+            body.append(",\"queued_frames\":");
+            json_write_uint(body, output ? output->frames.size() : 0);
+            body.append(",\"queued_bytes\":");
+            json_write_uint(body, output ? output->queued_bytes : 0);
+            if(conn->is_websocket)
+            {
+                body.append(",\"seq\":");
+                json_write_uint(body, state->ws_seq);
+                body.append(",\"subscribed\":");
+                json_write_bool(body, state->ws_subscription != nullptr);
+                body.append(",\"binary\":");
+                json_write_bool(body, state->ws_binary != 0);
+                body.append(",\"deflate\":");
+                json_write_bool(body, state->ws_deflate != 0);
+                body.append(",\"coalesced\":");
+                json_write_uint(body, output ? output->coalesced : 0);
+                body.append(",\"dropped\":");
+                json_write_uint(body, output ? output->dropped : 0);
+                body.append(",\"pending_ms\":");
+                json_write_uint(body, output && output->stall_tick != 0 ? now - output->stall_tick : 0);
+            }
+            body.push_back('}');
+        }
+        body.append("]}\n");
+        respond_json(connection, 200, body);
+    }
+
+    static void handle_ws_upgrade(struct mg_connection* connection, struct mg_http_message* message)
+    {
+        unsigned int field_mask = kTorrentFieldsAll;
+        if(!query_field_mask(message, &field_mask))
+        {
+            respond_error(connection, 400, "invalid-fields");
+            return;
+        }
+        HttpConnectionState* state = connection_state(connection);
+        state->field_mask = field_mask;
+        state->ws_seq = 0;
+        state->ws_subscription = nullptr;
+        state->ws_output = nullptr;
+        state->ws_binary = offers_ws_protocol(message, kWsBinaryProtocol) ? 1u : 0u;
+        state->ws_deflate = offers_ws_deflate(message) ? 1u : 0u;
+
+        // mg_ws_upgrade() echoes the request's Sec-WebSocket-Protocol value
+        // verbatim, and a browser rejects an answer that is not exactly one
+        // of the names it offered. The copy it sees carries the one we chose,
+        // or none, so the 101 has at most one protocol line.
+        struct mg_http_message upgrade = *message;
+        const struct mg_str protocol_header = mg_str("Sec-WebSocket-Protocol");
+        bool selected = false;
+        for(size_t i = 0; i < MG_MAX_HTTP_HEADERS && upgrade.headers[i].name.len != 0; ++i)
+        {
+            if(mg_strcasecmp(upgrade.headers[i].name, protocol_header) != 0)
+            {
+                continue;
+            }
+            if(state->ws_binary && !selected)
+            {
+                upgrade.headers[i].value = mg_str(kWsBinaryProtocol);
+                selected = true;
+            }
+            else
+            {
+                upgrade.headers[i].name = mg_str("X-Offered-Protocol");
+            }
+        }
+        mg_ws_upgrade(connection, &upgrade, "%s", state->ws_deflate ? kWsDeflateResponse : "");
+    }
+
+    // The journal feed of an /api/events request, or null for other connections.
+    static HttpEventFeed* connection_event_feed(struct mg_connection* connection)
+    {
+        const HttpConnectionState* state = connection_state(connection);
+        return !connection->is_websocket && state->http_events ? reinterpret_cast<HttpEventFeed*>(state->event_feed) : nullptr;
+    }
+
+    static void release_event_feed(struct mg_connection* connection)
+    {
+        HttpEventFeed* feed = connection_event_feed(connection);
+        if(feed)
+        {
+            payload_cache(reinterpret_cast<HttpServer*>(connection->fn_data))->event_feeds--;
+            delete feed;
+            HttpConnectionState* state = connection_state(connection);
+            state->http_events = 0;
+            state->event_feed = nullptr;
+        }
+    }
+
+    static const char* event_type_name(EngineEventType type)
+    {
+        switch(type)
+        {
+            case EngineEvent_TorrentAdded:
+                return "torrent_added";
+            case EngineEvent_TorrentRemoved:
+                return "torrent_removed";
+            case EngineEvent_TorrentPaused:
+                return "torrent_paused";
+            case EngineEvent_TorrentResumed:
+                return "torrent_resumed";
+            case EngineEvent_TorrentFinished:
+                return "torrent_finished";
+            case EngineEvent_TorrentError:
+                return "torrent_error";
+            default:
+                return "unknown";
+        }
+    }
+
+    static void append_event_json(std::string& out, const EngineEvent& event)
+    {
+        out.append("{\"seq\":");
+        json_write_uint(out, event.seq);
+        out.append(",\"type\":\"");
+        out.append(event_type_name(event.type));
+        out.append("\",\"id\":");
+        json_write_uint(out, event.torrent_id);
+        out.append(",\"name\":");
+        json_write_string(out, event.name);
+        out.append(",\"time\":");
+        json_write_uint(out, event.time_ms);
+        if(event.type == EngineEvent_TorrentError)
+        {
+            out.append(",\"error\":");
+            json_write_uint(out, event.error_code);
+        }
+        out.push_back('}');
+    }
+
+    // Event sequences are decimal; 19 digits always fit in 64 bits.
+    static bool parse_event_seq(const char* text, size_t len, unsigned long long* out_seq)
+    {
+        if(len == 0 || len > 19)
+        {
+            return false;
+        }
+        unsigned long long value = 0;
+        for(size_t i = 0; i < len; ++i)
+        {
+            if(text[i] < '0' || text[i] > '9')
+            {
+                return false;
+            }
+            value = value * 10 + static_cast<unsigned int>(text[i] - '0');
+        }
+        *out_seq = value;
+        return true;
+    }
+
+    // Writes the events after feed->since: all of them to an SSE stream,
+    // while its send buffer has room, or one batch as the long-poll answer,
+    // which also ends the feed.
+    static void send_feed_events(struct mg_connection* connection, HttpServer* server, HttpEventFeed* feed)
+    {
+        HttpRequestScratch* scratch = &payload_cache(server)->scratch;
+        std::vector<EngineEvent>& events = scratch->events;
+        events.resize(feed->limit);
+        std::string& body = scratch->body;
+        do
+        {
+            unsigned long long next = feed->since;
+            bool gap = false;
+            const unsigned int count = engine_session_read_events(server->config.engine, feed->since, events.data(),
+                feed->limit, &next, &gap);
+            feed->since = next;
+
+            body.clear();
+            if(!feed->sse)
+            {
+                body.append("{\"events\":[");
+                for(unsigned int i = 0; i < count; ++i)
+                {
+                    if(i != 0)
+                    {
+                        body.push_back(',');
+                    }
+                    append_event_json(body, events[i]);
+                }
+                body.append("],\"next\":");
+                json_write_uint(body, next);
+                body.append(",\"gap\":");
+                json_write_bool(body, gap);
+                body.append("}\n");
+                respond_json(connection, 200, body);
+                release_event_feed(connection);
+                connection->is_resp = 0;
+                return;
+            }
+
+            if(gap)
+            {
+                body.append("event: gap\ndata: {}\n\n");
+            }
+            for(unsigned int i = 0; i < count; ++i)
+            {
+                body.append("id: ");
+                json_write_uint(body, events[i].seq);
+                body.append("\nevent: ");
+                body.append(event_type_name(events[i].type));
+                body.append("\ndata: ");
+                append_event_json(body, events[i]);
+                body.append("\n\n");
+            }
+            if(body.empty())
+            {
+                return;
+            }
+            mg_send(connection, body.data(), body.size());
+        } while(feed->since != engine_session_event_head(server->config.engine) && connection->send.len < kWsSendWindow);
+    }
+
+    // Answers a parked long-poll once there are events or its deadline has
+    // passed. An SSE stream gets new events, or a comment line after
+    // kSseHeartbeatMs of quiet.
+    static void pump_event_feed(struct mg_connection* connection, HttpServer* server, ULONGLONG now)
+    {
+        HttpEventFeed* feed = connection_event_feed(connection);
+        if(!feed || connection->is_closing)
+        {
+            return;
+        }
+        const bool pending = engine_session_event_head(server->config.engine) != feed->since;
+        if(!feed->sse)
+        {
+            if(pending || now >= feed->deadline)
+            {
+                send_feed_events(connection, server, feed);
+            }
+            return;
+        }
+        if(pending && connection->send.len < kWsSendWindow)
+        {
+            send_feed_events(connection, server, feed);
+            feed->last_write = now;
+        }
+        else if(now - feed->last_write >= kSseHeartbeatMs)
+        {
+            mg_send(connection, ":\n\n", 3);
+            feed->last_write = now;
+        }
+    }
+
+    // Runs after every loop pass, like maybe_broadcast_updates(), and
+    // shortens `wait_ms` to the next long-poll deadline or heartbeat. New
+    // events always come with a version bump, whose wakeup ends the poll.
+    static unsigned int pump_event_feeds(struct mg_mgr* mgr, HttpServer* server, unsigned int wait_ms)
+    {
+        if(!server->config.engine || payload_cache(server)->event_feeds == 0)
+        {
+            return wait_ms;
+        }
+        const ULONGLONG now = GetTickCount64();
+        for(struct mg_connection* conn = mgr->conns; conn != nullptr; conn = conn->next)
+        {
+            pump_event_feed(conn, server, now);
+            const HttpEventFeed* feed = connection_event_feed(conn);
+            if(!feed)
+            {
+                continue;
+            }
+            const ULONGLONG due = feed->sse ? feed->last_write + kSseHeartbeatMs : feed->deadline;
+            const unsigned int remaining = due > now ? static_cast<unsigned int>(due - now) : 0;
+            wait_ms = remaining < wait_ms ? remaining : wait_ms;
+        }
+        return wait_ms;
+    }
+
+    // GET /api/events: engine events after `since` (by default, only those
+    // still to come). A long-poll is answered at once when there are any and
+    // otherwise held up to `timeout` seconds. With Accept: text/event-stream
+    // the response is an SSE stream instead, resuming after Last-Event-ID
+    // when the query has no `since`.
+    static void handle_events_request(struct mg_connection* connection, HttpServer* server, const struct mg_http_message* message)
+    {
+        if(!server->config.engine)
+        {
+            respond_error(connection, 503, "engine-unavailable");
+            return;
+        }
+
+        const bool sse = header_lists_token(message, "Accept", "text/event-stream");
+        unsigned long long since = engine_session_event_head(server->config.engine);
+        char text[24];
+        const struct mg_str* last_id = mg_http_get_header(const_cast<struct mg_http_message*>(message), "Last-Event-ID");
+        bool valid = true;
+        if(query_var(message, "since", text, sizeof(text)))
+        {
+            valid = parse_event_seq(text, strlen(text), &since);
+        }
+        else if(sse && last_id)
+        {
+            valid = parse_event_seq(last_id->buf, last_id->len, &since);
+        }
+        unsigned int limit = query_uint(message, "limit", kEventsDefaultLimit);
+        const unsigned int timeout_s = query_uint(message, "timeout", kEventsDefaultTimeoutS);
+        if(!valid || limit == 0 || timeout_s > kEventsMaxTimeoutS)
+        {
+            respond_error(connection, 400, "invalid-query");
+            return;
+        }
+        if(limit > kEventsMaxLimit)
+        {
+            limit = kEventsMaxLimit;
+        }
+
+        HttpEventFeed* feed = new (std::nothrow) HttpEventFeed();
+        if(!feed)
+        {
+            respond_error(connection, 503, "busy");
+            return;
+        }
+        const ULONGLONG now = GetTickCount64();
+        feed->sse = sse;
+        feed->since = since;
+        feed->limit = sse ? kEventsMaxLimit : limit;
+        feed->deadline = now + timeout_s * 1000ull;
+        feed->last_write = now;
+
+        HttpConnectionState* state = connection_state(connection);
+        state->http_events = 1;
+        state->event_feed = feed;
+        payload_cache(server)->event_feeds++;
+        // Held until answered; an SSE stream is never answered.
+        connection->is_resp = 1;
+        if(sse)
+        {
+            mg_printf(connection,
+                "HTTP/1.1 200 OK\r\nContent-Type: text/event-stream\r\nCache-Control: no-cache\r\nX-Accel-Buffering: no\r\n\r\n");
+        }
+        pump_event_feed(connection, server, now);
+    }
+
+    // Dispatches through the route table (http_routes.cpp). Returns false
+    // for paths that are not API routes, which fall through to the UI.
+    static bool handle_api_request(struct mg_connection* connection, HttpServer* server, struct mg_http_message* message)
+    {
+        HttpRouteMatch route;
+        const HttpMethod method = http_method_parse(message->method.buf, message->method.len);
+        if(!http_routes_match(method, message->uri.buf, message->uri.len, &route))
+        {
+            return false;
+        }
+        if(!route.method_allowed)
+        {
+            respond_error(connection, 405, "unsupported-method");
+            return true;
+        }
+
+        switch(route.route)
+        {
+            case HttpRoute_Session:
+                handle_session_request(connection, server, message);
+                break;
+            case HttpRoute_DebugConnections:
+                handle_debug_connections(connection);
+                break;
+            case HttpRoute_Torrents:
+                if(method == HttpMethod_Post)
+                {
+                    handle_add_torrent(connection, server, message);
+                }
+                else
+                {
+                    handle_torrent_list_request(connection, server, message);
+                }
+                break;
+            case HttpRoute_Torrent:
+                handle_remove_torrent(connection, server, route.id);
+                break;
+            case HttpRoute_TorrentAction:
+                handle_modify_torrent(connection, server, route);
+                break;
+            case HttpRoute_WebSocket:
+                handle_ws_upgrade(connection, message);
+                break;
+            case HttpRoute_Events:
+                handle_events_request(connection, server, message);
+                break;
+            case HttpRoute_Rpc:
+                handle_rpc_request(connection, server, message);
+                break;
+            default:
+                return false;
+        }
+        return true;
+    }
+
+    static HttpWsFrameBuffer* ws_frame_create(int op, const std::string& payload)
+    {
+        HttpWsFrameBuffer* frame = new (std::nothrow) HttpWsFrameBuffer();
+        if(!frame)
+        {
+            return nullptr;
+        }
+
+        // Server frames are unmasked: FIN + opcode, then a 7-bit, 16-bit or
+        // 64-bit big-endian payload length.
+        const size_t len = payload.size();
+        unsigned char header[10];
+        size_t header_len = 2;
+        header[0] = static_cast<unsigned char>(0x80 | op);
+        if(len < 126)
+        {
+            header[1] = static_cast<unsigned char>(len);
+        }
+        else if(len < 65536)
+        {
+            header[1] = 126;
+            header[2] = static_cast<unsigned char>(len >> 8);
+            header[3] = static_cast<unsigned char>(len);
+            header_len = 4;
+        }
+        else
+        {
+            header[1] = 127;
+            for(int i = 0; i < 8; ++i)
+            {
+                header[2 + i] = static_cast<unsigned char>(static_cast<unsigned long long>(len) >> (56 - 8 * i));
+            }
+            header_len = 10;
+        }
+
+        frame->refs = 1;
+        frame->bytes.reserve(header_len + len);
+        frame->bytes.append(reinterpret_cast<const char*>(header), header_len);
+        frame->bytes.append(payload);
+        return frame;
+    }
+
+    // Frame for a client that negotiated permessage-deflate: compressed with
+    // RSV1 set when that makes it smaller, otherwise plain.
+    // `compressed` is scratch space for the deflated payload.
+    static HttpWsFrameBuffer* ws_frame_create_deflate(int op, const std::string& payload, std::string& compressed)
+    {
+        if(payload.size() < kWsCompressMinBytes)
+        {
+            return ws_frame_create(op, payload);
+        }
+
+        compressed.clear();
+        deflate_raw(payload.data(), payload.size(), DeflateFlush_Sync, compressed);
+        // The flush's 00 00 FF FF tail is implied on the wire (RFC 7692 7.2.1).
+        compressed.resize(compressed.size() - 4);
+        if(compressed.size() >= payload.size())
+        {
+            return ws_frame_create(op, payload);
+        }
+        HttpWsFrameBuffer* frame = ws_frame_create(op, compressed);
+        if(frame)
+        {
+            frame->bytes[0] = static_cast<char>(frame->bytes[0] | kWsFrameRsv1);
+        }
+        return frame;
+    }
+
+    static void ws_frame_release(HttpWsFrameBuffer* frame)
+    {
+        if(frame && --frame->refs == 0)
+        {
+            delete frame;
+        }
+    }
+
+    static void release_ws_frames(HttpWsDelta& ws)
+    {
+        for(size_t i = 0; i < ws.frames.size(); ++i)
+        {
+            for(unsigned int encoding = 0; encoding < HttpWsEncoding_Count; ++encoding)
+            {
+                for(unsigned int kind = 0; kind < HttpWsFrame_Count; ++kind)
+                {
+                    ws_frame_release(ws.frames[i].slots[encoding][kind]);
+                }
+            }
+        }
+        ws.frames.clear();
+    }
+
+    static HttpWsOutput* connection_output(struct mg_connection* connection)
+    {
+        return reinterpret_cast<HttpWsOutput*>(connection_state(connection)->ws_output);
+    }
+
+    // Bytes waiting for this client, in mongoose's buffer and in our queue.
+    static size_t ws_pending_bytes(struct mg_connection* connection)
+    {
+        const HttpWsOutput* output = connection_output(connection);
+        return connection->send.len + (output ? output->queued_bytes : 0);
+    }
+
+    // Moves whole queued frames into the send buffer while it is below the
+    // window. Whole frames keep mongoose's own control frames (pong, close)
+    // from landing inside one of ours.
+    static void pump_ws_output(struct mg_connection* connection)
+    {
+        HttpWsOutput* output = connection_output(connection);
+        if(!output)
+        {
+            return;
+        }
+        while(!output->frames.empty() && connection->send.len < kWsSendWindow)
+        {
+            HttpWsFrameBuffer* frame = output->frames.front();
+            output->frames.pop_front();
+            output->queued_bytes -= frame->bytes.size();
+            mg_send(connection, frame->bytes.data(), frame->bytes.size());
+            ws_frame_release(frame);
+        }
+    }
+
+    static HttpWsOutput* ensure_ws_output(struct mg_connection* connection)
+    {
+        HttpWsOutput* output = connection_output(connection);
+        if(!output)
+        {
+            output = new (std::nothrow) HttpWsOutput();
+            if(output)
+            {
+                output->queued_bytes = 0;
+                output->stall_tick = 0;
+                output->coalesced = 0;
+                output->dropped = 0;
+                connection_state(connection)->ws_output = output;
+            }
+        }
+        return output;
+    }
+
+    // True while the client has not yet taken its last frame into the send
+    // window; new state waits and is coalesced into one later frame.
+    static bool ws_output_busy(struct mg_connection* connection)
+    {
+        const HttpWsOutput* output = connection_output(connection);
+        return (output && !output->frames.empty()) || connection->send.len >= kWsSendWindow;
+    }
+
+    // Called on every loop pass; a client counts as stalled once its output
+    // has stayed pending with no write for kWsStallTimeoutMs.
+    static bool ws_output_stalled(struct mg_connection* connection, ULONGLONG now)
+    {
+        HttpWsOutput* output = connection_output(connection);
+        if(!output)
+        {
+            return false;
+        }
+        if(ws_pending_bytes(connection) == 0)
+        {
+            output->stall_tick = 0;
+            return false;
+        }
+        if(output->stall_tick == 0)
+        {
+            output->stall_tick = now;
+        }
+        return now - output->stall_tick > kWsStallTimeoutMs;
+    }
+
+    static void queue_ws_frame(struct mg_connection* connection, HttpWsFrameBuffer* frame)
+    {
+        if(!frame)
+        {
+            return;
+        }
+
+        HttpWsOutput* output = ensure_ws_output(connection);
+        if(!output)
+        {
+            return;
+        }
+        if(!output->frames.empty() && output->queued_bytes + frame->bytes.size() > kWsQueueLimit)
+        {
+            output->dropped++;
+            return;
+        }
+        frame->refs++;
+        output->frames.push_back(frame);
+        output->queued_bytes += frame->bytes.size();
+        pump_ws_output(connection);
+    }
+
+    static void release_ws_output(struct mg_connection* connection)
+    {
+        HttpConnectionState* state = connection_state(connection);
+        HttpWsOutput* output = connection_output(connection);
+        if(!output)
+        {
+            return;
+        }
+        for(size_t i = 0; i < output->frames.size(); ++i)
+        {
+            ws_frame_release(output->frames[i]);
+        }
+        delete output;
+        state->ws_output = nullptr;
+    }
+
+    static bool stats_equal(const EngineSessionStats& a, const EngineSessionStats& b)
+    {
+        return a.torrent_count == b.torrent_count && a.active_count == b.active_count &&
+            a.download_rate == b.download_rate && a.upload_rate == b.upload_rate;
+    }
+
+    // Moves a delta stream to `current`. Both torrent lists are ID-ordered,
+    // so one merge walk finds added, removed and changed rows. Returns false,
+    // leaving the sequence alone, when nothing visible changed.
+    static bool advance_delta(HttpWsDelta& ws, const EngineSessionSnapshot& current, HttpRequestScratch* scratch)
+    {
+        if(ws.primed && current.version == ws.published.version)
+        {
+            return false;
+        }
+
+        std::vector<unsigned int>& added = scratch->added;
+        std::vector<HttpWsChangedRow>& changed = scratch->changed;
+        std::vector<unsigned int>& removed = scratch->removed;
+        added.clear();
+        changed.clear();
+        removed.clear();
+        bool stats_changed = true;
+
+        if(ws.primed)
+        {
+            const std::vector<EngineTorrentStatus>& before = ws.published.torrents;
+            const std::vector<EngineTorrentStatus>& after = current.torrents;
+            size_t b = 0;
+            size_t a = 0;
+            while(b < before.size() || a < after.size())
+            {
+                if(a == after.size() || (b < before.size() && before[b].id < after[a].id))
+                {
+                    removed.push_back(before[b++].id);
+                }
+                else if(b == before.size() || after[a].id < before[b].id)
+                {
+                    added.push_back(static_cast<unsigned int>(a++));
+                }
+                else
+                {
+                    const unsigned int fields = torrent_schema_diff(before[b], after[a]);
+                    if(fields != 0)
+                    {
+                        HttpWsChangedRow row;
+                        row.index = static_cast<unsigned int>(a);
+                        row.fields = fields;
+                        changed.push_back(row);
+                    }
+                    ++a;
+                    ++b;
+                }
+            }
+            stats_changed = (ws.topics & kWsTopicStats) && !stats_equal(ws.published.stats, current.stats);
+
+            if(!stats_changed && added.empty() && changed.empty() && removed.empty())
+            {
+                // Clients at seq - 1 may still need the current patch.
+                ws.published.version = current.version;
+                return false;
+            }
+        }
+
+        ws.added.swap(added);
+        ws.changed.swap(changed);
+        ws.removed.swap(removed);
+        ws.stats_changed = stats_changed;
+        release_ws_frames(ws);
+        ws.published = current;
+        ws.seq++;
+        ws.primed = true;
+        return true;
+    }
+
+    static bool advance_ws_delta(HttpServer* server, HttpPayloadCache* cache)
+    {
+        refresh_payload_cache(server, cache);
+        return advance_delta(cache->ws, cache->snapshot, &cache->scratch);
+    }
+
+    static bool subscription_wants(const HttpWsSubscription* subscription, const EngineTorrentStatus& status)
+    {
+        switch(subscription->filter)
+        {
+            case HttpWsFilter_Active:
+                return !status.is_paused && !status.is_complete;
+            case HttpWsFilter_Paused:
+                return status.is_paused != 0;
+            case HttpWsFilter_Complete:
+                return status.is_complete != 0;
+            default:
+                return true;
+        }
+    }
+
+    static bool status_id_less(const EngineTorrentStatus& status, unsigned int id)
+    {
+        return status.id < id;
+    }
+
+    // Cuts the subscriber's rows out of the shared snapshot and advances its
+    // private stream. ID subscriptions bisect instead of scanning every row.
+    static bool advance_subscription(HttpServer* server, HttpWsSubscription* subscription)
+    {
+        HttpPayloadCache* cache = payload_cache(server);
+        refresh_payload_cache(server, cache);
+        const EngineSessionSnapshot& snapshot = cache->snapshot;
+        if(subscription->delta.primed && snapshot.version == subscription->delta.published.version)
+        {
+            return false;
+        }
+
+        EngineSessionSnapshot& view = subscription->view;
+        view.version = snapshot.version;
+        view.stats = snapshot.stats;
+        view.torrents.clear();
+        if(subscription->delta.topics & kWsTopicTorrents)
+        {
+            const std::vector<EngineTorrentStatus>& rows = snapshot.torrents;
+            if(!subscription->ids.empty())
+            {
+                for(size_t i = 0; i < subscription->ids.size(); ++i)
+                {
+                    std::vector<EngineTorrentStatus>::const_iterator it =
+                        std::lower_bound(rows.begin(), rows.end(), subscription->ids[i], status_id_less);
+                    if(it != rows.end() && it->id == subscription->ids[i] && subscription_wants(subscription, *it))
+                    {
+                        view.torrents.push_back(*it);
+                    }
+                }
+            }
+            else
+            {
+                for(size_t i = 0; i < rows.size(); ++i)
+                {
+                    if(subscription_wants(subscription, rows[i]))
+                    {
+                        view.torrents.push_back(rows[i]);
+                    }
+                }
+            }
+        }
+        return advance_delta(subscription->delta, view, &cache->scratch);
+    }
+
+    static HttpWsSubscription* connection_subscription(struct mg_connection* connection)
+    {
+        return reinterpret_cast<HttpWsSubscription*>(connection_state(connection)->ws_subscription);
+    }
+
+    static HttpWsDelta& connection_delta(HttpServer* server, struct mg_connection* connection)
+    {
+        HttpWsSubscription* subscription = connection_subscription(connection);
+        return subscription ? subscription->delta : payload_cache(server)->ws;
+    }
+
+    static HttpWsFrames* ws_frames(HttpWsDelta& ws, unsigned int field_mask)
+    {
+        for(size_t i = 0; i < ws.frames.size(); ++i)
+        {
+            if(ws.frames[i].field_mask == field_mask)
+            {
+                return &ws.frames[i];
+            }
+        }
+        HttpWsFrames frames;
+        memset(&frames, 0, sizeof(frames));
+        frames.field_mask = field_mask;
+        ws.frames.push_back(frames);
+        return &ws.frames.back();
+    }
+
+    // {"type":"full"|"resync","seq":N,"stats":{...},"torrents":[...]}
+    static void build_ws_full_frame(const HttpServer* server, const HttpWsDelta& ws, unsigned int field_mask, bool resync, std::string& out)
+    {
+        out.clear();
+        out.reserve(512);
+        out.append(resync ? "{\"type\":\"resync\",\"seq\":" : "{\"type\":\"full\",\"seq\":");
+        json_write_uint(out, ws.seq);
+        if(ws.topics & kWsTopicStats)
+        {
+            out.append(",\"stats\":{");
+            append_stats_fields(out, ws.published.stats, server->config.port);
+            out.push_back('}');
+        }
+        if(ws.topics & kWsTopicTorrents)
+        {
+            out.append(",\"torrents\":");
+            torrent_schema_write_json_array(out, ws.published.torrents, field_mask);
+        }
+        out.push_back('}');
+    }
+
+    // {"type":"patch","seq":N[,"stats":{...}],"added":[rows],"updated":[{"id":..,changed fields}],"removed":[ids]}
+    // Updated rows carry only fields in the client's projection; rows whose
+    // changes are all outside it are left out.
+    static void build_ws_patch_frame(const HttpServer* server, const HttpWsDelta& ws, unsigned int field_mask, std::string& out)
+    {
+        const std::vector<EngineTorrentStatus>& rows = ws.published.torrents;
+
+        out.clear();
+        out.reserve(128 + ws.changed.size() * 48);
+        out.append("{\"type\":\"patch\",\"seq\":");
+        json_write_uint(out, ws.seq);
+        if(ws.stats_changed)
+        {
+            out.append(",\"stats\":{");
+            append_stats_fields(out, ws.published.stats, server->config.port);
+            out.push_back('}');
+        }
+
+        out.append(",\"added\":[");
+        for(size_t i = 0; i < ws.added.size(); ++i)
+        {
+            if(i != 0)
+            {
+                out.push_back(',');
+            }
+            torrent_schema_write_json_object(out, rows[ws.added[i]], field_mask);
+        }
+
+        out.append("],\"updated\":[");
+        bool first = true;
+        for(size_t i = 0; i < ws.changed.size(); ++i)
+        {
+            const unsigned int visible = ws.changed[i].fields & field_mask;
+            if(visible == 0)
+            {
+                continue;
+            }
+            if(!first)
+            {
+                out.push_back(',');
+            }
+            first = false;
+            torrent_schema_write_json_object(out, rows[ws.changed[i].index], visible | (1u << TorrentField_Id));
+        }
+
+        out.append("],\"removed\":[");
+        for(size_t i = 0; i < ws.removed.size(); ++i)
+        {
+            if(i != 0)
+            {
+                out.push_back(',');
+            }
+            json_write_uint(out, ws.removed[i]);
+        }
+        out.append("]}");
+    }
+
+    template <typename T>
+    static void append_le(std::string& out, T value)
+    {
+        unsigned char bytes[sizeof(T)];
+        memcpy(bytes, &value, sizeof(T));
+        out.append(reinterpret_cast<const char*>(bytes), sizeof(T));
+    }
+
+    // Binary counterpart of the JSON frames, all little-endian:
+    //   header   "RBW1", u8 kind (HttpWsFrameKind), u8 flags, u16 record size, u64 seq
+    //   stats    (flag 1) u32 port, u32 torrent_count, u32 active, u32 reserved,
+    //            u64 download_rate, u64 upload_rate
+    //   records  u32 count, then fixed-width rows (torrent_schema.h)
+    //   removed  u32 count, then u32 ids
+    //   strings  (flag 2) u32 count, then string entries (torrent_schema.h)
+    // Patches carry records for added rows and rows with a changed numeric
+    // column in the projection, and strings only for rows whose name or
+    // magnet changed.
+    static void build_ws_binary_frame(const HttpServer* server, const HttpWsDelta& ws, unsigned int field_mask, HttpWsFrameKind kind, std::string& out)
+    {
+        const std::vector<EngineTorrentStatus>& rows = ws.published.torrents;
+        const bool patch = kind == HttpWsFrame_Patch;
+        const unsigned int string_mask = field_mask & kTorrentStringFields;
+        const unsigned int numeric_mask = field_mask & ~kTorrentStringFields;
+
+        std::vector<unsigned int> records;
+        std::vector<unsigned int> strings;
+        if(patch)
+        {
+            records.reserve(ws.added.size() + ws.changed.size());
+            for(size_t i = 0; i < ws.added.size(); ++i)
+            {
+                records.push_back(ws.added[i]);
+                if(string_mask != 0)
+                {
+                    strings.push_back(ws.added[i]);
+                }
+            }
+            for(size_t i = 0; i < ws.changed.size(); ++i)
+            {
+                if(ws.changed[i].fields & numeric_mask)
+                {
+                    records.push_back(ws.changed[i].index);
+                }
+                if(ws.changed[i].fields & string_mask)
+                {
+                    strings.push_back(ws.changed[i].index);
+                }
+            }
+        }
+
+        const bool has_stats = (ws.topics & kWsTopicStats) && (!patch || ws.stats_changed);
+        const bool has_strings = patch ? !strings.empty() : string_mask != 0;
+        const size_t record_count = patch ? records.size() : rows.size();
+        const size_t removed_count = patch ? ws.removed.size() : 0;
+
+        out.clear();
+        out.reserve(64 + record_count * kTorrentBinaryRecordSize + removed_count * 4);
+        append_le<uint32_t>(out, kWsBinaryMagic);
+        out.push_back(static_cast<char>(kind));
+        out.push_back(static_cast<char>((has_stats ? kWsBinaryHasStats : 0) | (has_strings ? kWsBinaryHasStrings : 0)));
+        append_le<uint16_t>(out, static_cast<uint16_t>(kTorrentBinaryRecordSize));
+        append_le<uint64_t>(out, ws.seq);
+
+        if(has_stats)
+        {
+            append_le<uint32_t>(out, server->config.port);
+            append_le<uint32_t>(out, ws.published.stats.torrent_count);
+            append_le<uint32_t>(out, ws.published.stats.active_count);
+            append_le<uint32_t>(out, 0);
+            append_le<uint64_t>(out, ws.published.stats.download_rate);
+            append_le<uint64_t>(out, ws.published.stats.upload_rate);
+        }
+
+        append_le<uint32_t>(out, static_cast<uint32_t>(record_count));
+        for(size_t i = 0; i < record_count; ++i)
+        {
+            torrent_schema_write_binary_record(out, rows[patch ? records[i] : i]);
+        }
+
+        append_le<uint32_t>(out, static_cast<uint32_t>(removed_count));
+        for(size_t i = 0; i < removed_count; ++i)
+        {
+            append_le<uint32_t>(out, ws.removed[i]);
+        }
+
+        if(has_strings)
+        {
+            const size_t string_count = patch ? strings.size() : rows.size();
+            append_le<uint32_t>(out, static_cast<uint32_t>(string_count));
+            for(size_t i = 0; i < string_count; ++i)
+            {
+                torrent_schema_write_binary_strings(out, rows[patch ? strings[i] : i], string_mask);
+            }
+        }
+    }
+
+    // Brings one client to the current sequence: a patch when it holds the
+    // previous one, otherwise a full frame ("resync" if it had fallen behind).
+    static void send_ws_update(HttpServer* server, struct mg_connection* conn)
+    {
+        HttpWsDelta& ws = connection_delta(server, conn);
+        HttpConnectionState* state = connection_state(conn);
+        if(state->ws_seq == ws.seq)
+        {
+            return;
+        }
+
+        HttpWsFrameKind kind = HttpWsFrame_Full;
+        if(state->ws_seq != 0)
+        {
+            kind = state->ws_seq + 1 == ws.seq ? HttpWsFrame_Patch : HttpWsFrame_Resync;
+        }
+
+        // Every client on this stream and projection shares the same encoded
+        // frame; it is serialized once and queued by reference.
+        HttpWsFrames* frames = ws_frames(ws, state->field_mask);
+        HttpWsEncoding encoding = state->ws_binary ? HttpWsEncoding_Binary : HttpWsEncoding_Text;
+        if(state->ws_deflate)
+        {
+            encoding = state->ws_binary ? HttpWsEncoding_BinaryDeflate : HttpWsEncoding_TextDeflate;
+        }
+        HttpWsFrameBuffer*& frame = frames->slots[encoding][kind];
+        if(!frame)
+        {
+            HttpRequestScratch* scratch = &payload_cache(server)->scratch;
+            std::string& payload = scratch->body;
+            payload.clear();
+            if(state->ws_binary)
+            {
+                build_ws_binary_frame(server, ws, state->field_mask, kind, payload);
+            }
+            else if(kind == HttpWsFrame_Patch)
+            {
+                build_ws_patch_frame(server, ws, state->field_mask, payload);
+            }
+            else
+            {
+                build_ws_full_frame(server, ws, state->field_mask, kind == HttpWsFrame_Resync, payload);
+            }
+            const int op = state->ws_binary ? WEBSOCKET_OP_BINARY : WEBSOCKET_OP_TEXT;
+            frame = state->ws_deflate ? ws_frame_create_deflate(op, payload, scratch->compressed) : ws_frame_create(op, payload);
+            if(!frame)
+            {
+                return;
+            }
+        }
+        queue_ws_frame(conn, frame);
+        state->ws_seq = ws.seq;
+    }
+
+    // Runs after every loop pass and returns how long the loop may block.
+    // A stream advances only when the engine version moved, and at most once
+    // per broadcast interval (shared stream) or rate_ms (subscriptions); the
+    // returned wait is the time until the next such slot. A client still
+    // busy with its previous frame gets nothing new: once it drains it is
+    // sent one frame that brings it to the latest state (a patch if it is
+    // only one step behind, otherwise a resync). Pending output keeps the
+    // wait at poll_interval_ms so stalled clients are noticed and dropped.
+    static unsigned int maybe_broadcast_updates(struct mg_mgr* mgr, HttpServer* server)
+    {
+        if(!server || !mgr || !server->config.engine)
+        {
+            return kHttpIdleWaitMs;
+        }
+
+        const unsigned int interval = server->config.broadcast_interval_ms ? server->config.broadcast_interval_ms : 1000;
+        const ULONGLONG now = GetTickCount64();
+        const unsigned long long version = engine_session_version(server->config.engine);
+        HttpPayloadCache* cache = payload_cache(server);
+        unsigned int wait_ms = server->wake_mgr ? kHttpIdleWaitMs : server->config.poll_interval_ms;
+        bool shared_checked = false;
+        bool shared_advanced = false;
+
+        for(struct mg_connection* conn = mgr->conns; conn != nullptr; conn = conn->next)
+        {
+            if(!conn->is_websocket || conn->is_closing)
+            {
+                continue;
+            }
+            if(ws_output_stalled(conn, now))
+            {
+                DebugOut("http_server: Dropping stalled WebSocket client %lu.\n", conn->id);
+                conn->is_closing = 1;
+                continue;
+            }
+
+            const bool busy = ws_output_busy(conn);
+            if(ws_pending_bytes(conn) != 0 && server->config.poll_interval_ms < wait_ms)
+            {
+                wait_ms = server->config.poll_interval_ms;
+            }
+
+            HttpWsSubscription* subscription = connection_subscription(conn);
+            if(subscription)
+            {
+                if(subscription->delta.primed && subscription->delta.published.version == version)
+                {
+                    continue;
+                }
+                const ULONGLONG elapsed = now - subscription->last_tick;
+                if(elapsed < subscription->rate_ms)
+                {
+                    const unsigned int remaining = static_cast<unsigned int>(subscription->rate_ms - elapsed);
+                    wait_ms = remaining < wait_ms ? remaining : wait_ms;
+                    continue;
+                }
+                if(busy)
+                {
+                    continue;
+                }
+                subscription->last_tick = now;
+                advance_subscription(server, subscription);
+                send_ws_update(server, conn);
+                continue;
+            }
+
+            if(!shared_checked)
+            {
+                shared_checked = true;
+                if(!cache->ws.primed || cache->ws.published.version != version)
+                {
+                    const ULONGLONG elapsed = now - server->last_broadcast_tick;
+                    if(elapsed >= interval)
+                    {
+                        server->last_broadcast_tick = now;
+                        shared_advanced = advance_ws_delta(server, cache);
+                    }
+                    else
+                    {
+                        const unsigned int remaining = static_cast<unsigned int>(interval - elapsed);
+                        wait_ms = remaining < wait_ms ? remaining : wait_ms;
+                    }
+                }
+            }
+
+            if(connection_state(conn)->ws_seq == cache->ws.seq)
+            {
+                continue;
+            }
+            if(busy)
+            {
+                if(shared_advanced)
+                {
+                    connection_output(conn)->coalesced++;
+                }
+                continue;
+            }
+            send_ws_update(server, conn);
+        }
+        trim_request_scratch(&cache->scratch);
+        return wait_ms;
+    }
+
+    static void send_ws_error(struct mg_connection* connection, const char* code)
+    {
+        std::string frame("{\"type\":\"error\",\"error\":");
+        json_write_string(frame, code);
+        frame.push_back('}');
+        HttpWsFrameBuffer* buffer = ws_frame_create(WEBSOCKET_OP_TEXT, frame);
+        queue_ws_frame(connection, buffer);
+        ws_frame_release(buffer);
+    }
+
+    static bool parse_ws_topics(JsonReader* reader, unsigned int* out_topics)
+    {
+        unsigned int topics = 0;
+        JsonToken token;
+        while(json_reader_next(reader, &token) && token.type != JsonToken_ArrayEnd)
+        {
+            if(token.type != JsonToken_String)
+            {
+                return false;
+            }
+            const char* name = json_token_cstr(&token);
+            if(strcmp(name, "stats") == 0)
+            {
+                topics |= kWsTopicStats;
+            }
+            else if(strcmp(name, "torrents") == 0)
+            {
+                topics |= kWsTopicTorrents;
+            }
+            else
+            {
+                return false;
+            }
+        }
+        *out_topics = topics;
+        return token.type == JsonToken_ArrayEnd;
+    }
+
+    static bool parse_ws_ids(JsonReader* reader, std::vector<unsigned int>& ids)
+    {
+        JsonToken token;
+        while(json_reader_next(reader, &token) && token.type != JsonToken_ArrayEnd)
+        {
+            double value = 0;
+            if(token.type != JsonToken_Number || !json_token_number(&token, &value) || value < 1 || value > 4294967295.0 ||
+                ids.size() >= kWsMaxSubscribedIds)
+            {
+                return false;
+            }
+            ids.push_back(static_cast<unsigned int>(value));
+        }
+        std::sort(ids.begin(), ids.end());
+        ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+        return token.type == JsonToken_ArrayEnd;
+    }
+
+    static bool parse_ws_fields(JsonReader* reader, unsigned int* out_mask)
+    {
+        unsigned int mask = 0;
+        JsonToken token;
+        while(json_reader_next(reader, &token) && token.type != JsonToken_ArrayEnd)
+        {
+            if(token.type != JsonToken_String)
+            {
+                return false;
+            }
+            const int field = torrent_schema_find_field(token.text, token.len);
+            if(field < 0)
+            {
+                return false;
+            }
+            mask |= 1u << field;
+        }
+        if(token.type != JsonToken_ArrayEnd || mask == 0)
+        {
+            return false;
+        }
+        // Patches are keyed by ID, so a subscriber always gets it.
+        *out_mask = mask | (1u << TorrentField_Id);
+        return true;
+    }
+
+    static bool parse_ws_filter(const char* text, HttpWsFilter* out_filter)
+    {
+        static const char* const kNames[] = { "all", "active", "paused", "complete" };
+        for(unsigned int i = 0; i < sizeof(kNames) / sizeof(kNames[0]); ++i)
+        {
+            if(strcmp(text, kNames[i]) == 0)
+            {
+                *out_filter = static_cast<HttpWsFilter>(i);
+                return true;
+            }
+        }
+        return false;
+    }
+
+    // Rest of a {"type":"subscribe", "topics":[..], "ids":[..], "filter":"..",
+    // "fields":[..], "rate_ms":N} object; every member is optional.
+    static bool parse_ws_subscription(JsonReader* reader, const HttpServer* server, HttpWsSubscription* subscription, unsigned int* field_mask)
+    {
+        subscription->delta.topics = kWsTopicsAll;
+        subscription->filter = HttpWsFilter_All;
+        subscription->rate_ms = server->config.broadcast_interval_ms ? server->config.broadcast_interval_ms : 1000;
+
+        JsonToken key;
+        while(json_reader_next(reader, &key) && key.type != JsonToken_ObjectEnd)
+        {
+            JsonToken value;
+            if(!json_reader_next(reader, &value))
+            {
+                return false;
+            }
+
+            const char* name = json_token_cstr(&key);
+            bool ok = true;
+            if(strcmp(name, "topics") == 0)
+            {
+                ok = value.type == JsonToken_ArrayBegin && parse_ws_topics(reader, &subscription->delta.topics);
+            }
+            else if(strcmp(name, "ids") == 0)
+            {
+                ok = value.type == JsonToken_ArrayBegin && parse_ws_ids(reader, subscription->ids);
+            }
+            else if(strcmp(name, "fields") == 0)
+            {
+                ok = value.type == JsonToken_ArrayBegin && parse_ws_fields(reader, field_mask);
+            }
+            else if(strcmp(name, "filter") == 0)
+            {
+                ok = value.type == JsonToken_String && parse_ws_filter(json_token_cstr(&value), &subscription->filter);
+            }
+            else if(strcmp(name, "rate_ms") == 0)
+            {
+                double rate = 0;
+                ok = value.type == JsonToken_Number && json_token_number(&value, &rate);
+                if(ok)
+                {
+                    rate = rate < kWsMinRateMs ? kWsMinRateMs : rate;
+                    rate = rate > kWsMaxRateMs ? kWsMaxRateMs : rate;
+                    subscription->rate_ms = static_cast<unsigned int>(rate);
+                }
+            }
+            else
+            {
+                ok = json_reader_skip(reader, &value);
+            }
+
+            if(!ok)
+            {
+                return false;
+            }
+        }
+        return key.type == JsonToken_ObjectEnd;
+    }
+
+    static void release_ws_subscription(struct mg_connection* connection)
+    {
+        HttpConnectionState* state = connection_state(connection);
+        HttpWsSubscription* subscription = reinterpret_cast<HttpWsSubscription*>(state->ws_subscription);
+        if(subscription)
+        {
+            release_ws_frames(subscription->delta);
+            delete subscription;
+        }
+        state->ws_subscription = nullptr;
+    }
+
+    // Replaces the client's stream with a private one and sends its first
+    // full frame right away.
+    static void handle_ws_subscribe(struct mg_connection* connection, HttpServer* server, JsonReader* reader)
+    {
+        HttpWsSubscription* subscription = new (std::nothrow) HttpWsSubscription();
+        if(!subscription)
+        {
+            send_ws_error(connection, "out-of-memory");
+            return;
+        }
+
+        HttpConnectionState* state = connection_state(connection);
+        unsigned int field_mask = state->field_mask;
+        if(!parse_ws_subscription(reader, server, subscription, &field_mask))
+        {
+            delete subscription;
+            send_ws_error(connection, "invalid-subscription");
+            return;
+        }
+
+        release_ws_subscription(connection);
+        state->ws_subscription = subscription;
+        state->field_mask = field_mask;
+        state->ws_seq = 0;
+        subscription->last_tick = GetTickCount64();
+        advance_subscription(server, subscription);
+        send_ws_update(server, connection);
+    }
+
+    // Client messages: {"type":"resync"} after a sequence gap, and
+    // {"type":"subscribe",...} to choose what and how often to receive.
+    // "type" must come first. With permessage-deflate, messages with RSV1 set
+    // are inflated first.
+    static void handle_ws_message(struct mg_connection* connection, HttpServer* server, struct mg_ws_message* message)
+    {
+        char* data = message->data.buf;
+        size_t data_len = message->data.len;
+        if(message->flags & kWsFrameRsv1)
+        {
+            HttpRequestScratch* scratch = &payload_cache(server)->scratch;
+            std::string& compressed = scratch->compressed;
+            std::string& inflated = scratch->message;
+            compressed.assign(message->data.buf, message->data.len);
+            compressed.append("\x00\x00\xFF\xFF", 4);
+            inflated.clear();
+            if(!connection_state(connection)->ws_deflate ||
+                !deflate_inflate_raw(compressed.data(), compressed.size(), kHttpWsMaxInflatedBytes, inflated))
+            {
+                send_ws_error(connection, "invalid-message");
+                return;
+            }
+            data = &inflated[0];
+            data_len = inflated.size();
+        }
+
+        JsonReader reader;
+        json_reader_init(&reader, data, data_len);
+
+        JsonToken token;
+        JsonToken value;
+        if(!json_reader_next(&reader, &token) || token.type != JsonToken_ObjectBegin ||
+            !json_reader_next(&reader, &token) || token.type != JsonToken_String ||
+            !json_reader_next(&reader, &value) || value.type != JsonToken_String ||
+            strcmp(json_token_cstr(&token), "type") != 0)
+        {
+            send_ws_error(connection, "invalid-message");
+            return;
+        }
+
+        const char* type = json_token_cstr(&value);
+        if(strcmp(type, "resync") == 0)
+        {
+            connection_state(connection)->ws_seq = 0;
+            send_ws_update(server, connection);
+        }
+        else if(strcmp(type, "subscribe") == 0)
+        {
+            handle_ws_subscribe(connection, server, &reader);
+        }
+        else
+        {
+            send_ws_error(connection, "unknown-type");
+        }
+    }
+
+    // Pokes the poll loop from any thread. mg_wakeup writes to mongoose's
+    // socketpair; wake_lock keeps the manager alive while it does.
+    static void wake_server(HttpServer* server)
+    {
+        if(!server->wake_lock_initialized)
+        {
+            return;
+        }
+        EnterCriticalSection(&server->wake_lock);
+        if(server->wake_mgr)
+        {
+            mg_wakeup(server->wake_mgr, server->wake_conn_id, "w", 1);
+        }
+        LeaveCriticalSection(&server->wake_lock);
+    }
+
+    // Deals accepted connections round-robin over the loops. One bound for
+    // another loop gives up its socket before mongoose has read from it and
+    // is then closed here without touching the socket.
+    static void hand_off_connection(HttpServer* server, struct mg_connection* connection)
+    {
+        HttpLoopSet* loops = reinterpret_cast<HttpLoopSet*>(server->loops);
+        const unsigned int slot = loops->next++ % static_cast<unsigned int>(loops->shards.size() + 1);
+        if(slot == 0)
+        {
+            return;
+        }
+
+        HttpLoopShard* shard = loops->shards[slot - 1];
+        EnterCriticalSection(&shard->handoff_lock);
+        const bool was_empty = shard->handoff.empty();
+        shard->handoff.push_back(static_cast<SOCKET>(reinterpret_cast<size_t>(connection->fd)));
+        LeaveCriticalSection(&shard->handoff_lock);
+
+        connection->fd = reinterpret_cast<void*>(static_cast<size_t>(INVALID_SOCKET));
+        connection->is_closing = 1;
+        if(was_empty)
+        {
+            wake_server(&shard->server);
+        }
+    }
+
+    static void handle_http_event(struct mg_connection* connection, int event, void* event_data)
+    {
+        if(!connection)
+        {
+            return;
+        }
+
+        HttpServer* server = reinterpret_cast<HttpServer*>(connection->fn_data);
+        if(!server)
+        {
+            return;
+        }
+
+        switch(event)
+        {
+            case MG_EV_HTTP_MSG:
+            {
+                struct mg_http_message* message = reinterpret_cast<struct mg_http_message*>(event_data);
+                if(handle_api_request(connection, server, message))
+                {
+                    trim_request_scratch(&payload_cache(server)->scratch);
+                    return;
+                }
+
+                if(server->serve_embedded_assets)
+                {
+                    const HttpAsset* asset = http_assets_find(message->uri.buf, message->uri.len);
+                    if(!asset)
+                    {
+                        respond_error(connection, 404, "not-found");
+                    }
+                    else if(!http_method_is(message, "GET") && !http_method_is(message, "HEAD"))
+                    {
+                        respond_error(connection, 405, "unsupported-method");
+                    }
+                    else
+                    {
+                        respond_asset(connection, message, asset);
+                    }
+                    break;
+                }
+
+                struct mg_http_serve_opts opts;
+                memset(&opts, 0, sizeof(opts));
+                opts.root_dir = server->web_root_utf8[0] ? server->web_root_utf8 : ".";
+                mg_http_serve_dir(connection, message, &opts);
+                break;
+            }
+
+            case MG_EV_WS_OPEN:
+            {
+                DebugOut("http_server: WebSocket client connected.\n");
+                // Full state as of the current sequence; the next broadcast
+                // patches it forward.
+                HttpPayloadCache* cache = payload_cache(server);
+                if(!cache->ws.primed)
+                {
+                    advance_ws_delta(server, cache);
+                }
+                connection_state(connection)->ws_seq = 0;
+                send_ws_update(server, connection);
+                break;
+            }
+
+            case MG_EV_WS_MSG:
+            {
+                handle_ws_message(connection, server, reinterpret_cast<struct mg_ws_message*>(event_data));
+                trim_request_scratch(&payload_cache(server)->scratch);
+                break;
+            }
 
-        std::string uri(message->uri.buf, message->uri.len);
-        const std::string prefix = "/api/torrents/";
-        if(uri.rfind(prefix, 0) != 0)
-        {
-            return false;
-        }
+            case MG_EV_WRITE:
+            {
+                if(connection->is_websocket)
+                {
+                    HttpWsOutput* output = connection_output(connection);
+                    if(output && output->stall_tick != 0)
+                    {
+                        output->stall_tick = GetTickCount64();
+                    }
+                    pump_ws_output(connection);
+                }
+                else
+                {
+                    pump_list_stream(connection);
+                }
+                break;
+            }
 
-        const size_t id_start = prefix.length();
-        const size_t slash_pos = uri.find('/', id_start);
-        std::string id_str = uri.substr(id_start, slash_pos - id_start);
-        if(id_str.empty())
-        {
-            return false;
-        }
+            case MG_EV_POLL:
+            {
+                if(connection->is_websocket)
+                {
+                    pump_ws_output(connection);
+                }
+                else
+                {
+                    pump_list_stream(connection);
+                }
+                break;
+            }
 
-        char* end_ptr = nullptr;
-        const unsigned long value = strtoul(id_str.c_str(), &end_ptr, 10);
-        if(value == 0 || (end_ptr && *end_ptr != '\0'))
-        {
-            return false;
-        }
+            case MG_EV_ACCEPT:
+            {
+                if(server->loops)
+                {
+                    hand_off_connection(server, connection);
+                }
+                break;
+            }
 
-        if(out_id)
-        {
-            *out_id = static_cast<unsigned int>(value);
-        }
+            case MG_EV_CLOSE:
+            {
+                if(connection->is_websocket)
+                {
+                    release_ws_subscription(connection);
+                    release_ws_output(connection);
+                }
+                else
+                {
+                    release_list_stream(connection);
+                    release_event_feed(connection);
+                }
+                break;
+            }
 
-        if(slash_pos != std::string::npos && slash_pos + 1 < uri.length())
-        {
-            action = uri.substr(slash_pos + 1);
-        }
-        else
-        {
-            action.clear();
+            default:
+                break;
         }
-
-        return true;
     }
 
-    static bool extract_json_string(struct mg_str json, const char* path, char* buffer, size_t buffer_len)
+    static void notify_change(HttpServer* server)
     {
-        if(!buffer || buffer_len == 0)
+        if(InterlockedExchange(&server->wake_pending, 1) == 0)
         {
-            return false;
-        }
-        buffer[0] = '\0';
-
-        char* value = mg_json_get_str(json, path);
-        if(!value)
-        {
-            return false;
+            wake_server(server);
         }
-
-        const errno_t copy_result = strncpy_s(buffer, buffer_len, value, _TRUNCATE);
-        free(value);
-        return copy_result == 0 && buffer[0] != '\0';
     }
 
-    static bool http_method_is(const struct mg_http_message* message, const char* method)
+    // Engine change hook. Runs under the engine's state lock, so it only
+    // posts one wakeup per loop per burst of changes; each loop clears its
+    // wake_pending before looking at the engine again.
+    static void on_engine_change(void* context)
     {
-        if(!message || !method)
+        HttpServer* server = reinterpret_cast<HttpServer*>(context);
+        notify_change(server);
+        const HttpLoopSet* loops = reinterpret_cast<const HttpLoopSet*>(server->loops);
+        if(loops)
         {
-            return false;
+            for(size_t i = 0; i < loops->shards.size(); ++i)
+            {
+                notify_change(&loops->shards[i]->server);
+            }
         }
-        const struct mg_str expected = mg_str(method);
-        return mg_strcmp(message->method, expected) == 0;
     }
 
-    static bool http_uri_matches(const struct mg_http_message* message, const char* pattern)
+    static HttpPayloadCache* create_payload_cache(unsigned long long epoch)
     {
-        if(!message || !pattern)
+        HttpPayloadCache* cache = new (std::nothrow) HttpPayloadCache();
+        if(cache)
         {
-            return false;
+            cache->epoch = epoch;
+            cache->ws.topics = kWsTopicsAll;
+            cache->list_rows = SIZE_MAX;
         }
-        const struct mg_str uri = message->uri;
-        const struct mg_str pat = mg_str(pattern);
-        return mg_match(uri, pat, nullptr);
+        return cache;
     }
 
-    static void handle_add_torrent(struct mg_connection* connection, HttpServer* server, const struct mg_http_message* message)
+    static void destroy_payload_cache(HttpPayloadCache* cache)
     {
-        if(!server->config.engine)
-        {
-            respond_error(connection, 503, "engine-unavailable");
-            return;
-        }
-
-        char magnet[512];
-        char name[128];
-        magnet[0] = '\0';
-        name[0] = '\0';
-
-        if(!extract_json_string(message->body, "$.magnet", magnet, sizeof(magnet)))
+        if(cache)
         {
-            respond_error(connection, 400, "missing-magnet");
-            return;
+            release_ws_frames(cache->ws);
+            delete cache;
         }
+    }
 
-        EngineAddTorrentOptions options;
-        ZeroMemory(&options, sizeof(options));
-        options.magnet_uri = magnet;
-        if(extract_json_string(message->body, "$.name", name, sizeof(name)))
-        {
-            options.display_name = name;
-        }
-        options.size_bytes = 0;
-        double size_value = 0;
-        if(mg_json_get_num(message->body, "$.size", &size_value) && size_value > 0)
-        {
-            options.size_bytes = static_cast<unsigned long long>(size_value);
-        }
+    // Takes over the sockets the primary dealt to this loop. The primary's
+    // listener protocol handler makes them HTTP connections like its own.
+    static void adopt_handoffs(HttpLoopShard* shard, struct mg_mgr* mgr)
+    {
+        std::vector<SOCKET> sockets;
+        EnterCriticalSection(&shard->handoff_lock);
+        sockets.swap(shard->handoff);
+        LeaveCriticalSection(&shard->handoff_lock);
 
-        unsigned int torrent_id = 0;
-        if(engine_session_add_torrent(server->config.engine, &options, &torrent_id) != 0)
+        for(size_t i = 0; i < sockets.size(); ++i)
         {
-            respond_error(connection, 500, "add-failed");
-            return;
+            struct mg_connection* connection = mg_wrapfd(mgr, static_cast<int>(sockets[i]), handle_http_event, &shard->server);
+            if(!connection)
+            {
+                closesocket(sockets[i]);
+                continue;
+            }
+            connection->pfn = shard->http_protocol;
+            connection->is_accepted = 1;
         }
-
-        mg_http_reply(connection, 200,
-            "Content-Type: application/json\r\nCache-Control: no-cache\r\n",
-            "{ \"status\": \"ok\", \"id\": %u }\n", torrent_id);
     }
 
-    static void handle_modify_torrent(struct mg_connection* connection, HttpServer* server, unsigned int torrent_id, const std::string& action)
+    DWORD WINAPI http_loop_thread(LPVOID context)
     {
-        if(!server->config.engine)
-        {
-            respond_error(connection, 503, "engine-unavailable");
-            return;
-        }
+        HttpLoopShard* shard = reinterpret_cast<HttpLoopShard*>(context);
+        HttpServer* server = &shard->server;
 
-        int result = -1;
-        if(action == "pause")
-        {
-            result = engine_session_pause_torrent(server->config.engine, torrent_id);
-        }
-        else if(action == "resume")
-        {
-            result = engine_session_resume_torrent(server->config.engine, torrent_id);
-        }
-        else
+        struct mg_mgr mgr;
+        mg_mgr_init(&mgr);
+        if(mg_wakeup_init(&mgr))
         {
-            respond_error(connection, 404, "unknown-action");
-            return;
+            // No listener on this loop; a wakeup only has to end the poll.
+            // mg_wakeup wants a nonzero ID, and no connection has this one.
+            EnterCriticalSection(&server->wake_lock);
+            server->wake_mgr = &mgr;
+            server->wake_conn_id = ~0ul;
+            LeaveCriticalSection(&server->wake_lock);
         }
 
-        if(result != 0)
+        while(WaitForSingleObject(server->stop_event, 0) != WAIT_OBJECT_0)
         {
-            respond_error(connection, 404, "not-found");
-            return;
+            InterlockedExchange(&server->wake_pending, 0);
+            adopt_handoffs(shard, &mgr);
+            const unsigned int wait_ms = pump_event_feeds(&mgr, server, maybe_broadcast_updates(&mgr, server));
+            mg_mgr_poll(&mgr, static_cast<int>(wait_ms));
         }
 
-        respond_ok(connection);
+        EnterCriticalSection(&server->wake_lock);
+        server->wake_mgr = nullptr;
+        LeaveCriticalSection(&server->wake_lock);
+        mg_mgr_free(&mgr);
+        return 0;
     }
 
-    static void handle_remove_torrent(struct mg_connection* connection, HttpServer* server, unsigned int torrent_id)
+    // The shard's thread uses everything freed here, so this waits for it
+    // without a timeout. Callers have set the stop event or never started
+    // the thread, and the wakeup ends its current poll.
+    static void destroy_loop_shard(HttpLoopShard* shard)
     {
-        if(!server->config.engine)
+        if(shard->server.thread_handle)
         {
-            respond_error(connection, 503, "engine-unavailable");
-            return;
+            wake_server(&shard->server);
+            WaitForSingleObject(shard->server.thread_handle, INFINITE);
+            CloseHandle(shard->server.thread_handle);
         }
-
-        if(engine_session_remove_torrent(server->config.engine, torrent_id) != 0)
+        for(size_t i = 0; i < shard->handoff.size(); ++i)
         {
-            respond_error(connection, 404, "not-found");
-            return;
+            closesocket(shard->handoff[i]);
         }
-
-        respond_ok(connection);
-    }
-
-    static void handle_session_request(struct mg_connection* connection, HttpServer* server)
-    {
-        EngineSessionSnapshot snapshot;
-        reset_snapshot(&snapshot);
-        collect_snapshot(server, &snapshot);
-
-        std::string body;
-        build_session_payload(server, snapshot, body);
-        respond_json(connection, 200, body);
+        destroy_payload_cache(payload_cache(&shard->server));
+        DeleteCriticalSection(&shard->handoff_lock);
+        DeleteCriticalSection(&shard->server.wake_lock);
+        delete shard;
     }
 
-    static void handle_torrents_request(struct mg_connection* connection, HttpServer* server, const struct mg_http_message* message)
+    // Multi-loop mode: loops beyond this one get a shadow server and their
+    // own thread. They serialize inline; only this loop has the worker pool.
+    static void start_loop_shards(HttpServer* server, struct mg_connection* listener)
     {
-        std::string action;
-        unsigned int torrent_id = 0;
-        const bool has_id = parse_torrent_path(message, &torrent_id, action);
-
-        if(!has_id && http_method_is(message, "GET"))
+        if(server->config.loop_count <= 1)
         {
-            EngineSessionSnapshot snapshot;
-            reset_snapshot(&snapshot);
-            collect_snapshot(server, &snapshot);
-
-            std::string body;
-            build_torrents_payload(server, snapshot, body);
-            respond_json(connection, 200, body);
             return;
         }
-
-        if(!has_id && http_method_is(message, "POST"))
+        HttpLoopSet* loops = new (std::nothrow) HttpLoopSet();
+        if(!loops)
         {
-            handle_add_torrent(connection, server, message);
             return;
         }
+        loops->next = 0;
 
-        if(has_id && http_method_is(message, "DELETE"))
+        const HttpPayloadCache* primary_cache = payload_cache(server);
+        for(unsigned int i = 1; i < server->config.loop_count; ++i)
         {
-            handle_remove_torrent(connection, server, torrent_id);
-            return;
+            HttpLoopShard* shard = new (std::nothrow) HttpLoopShard();
+            if(!shard)
+            {
+                break;
+            }
+            HttpServer* shadow = &shard->server;
+            shadow->config = server->config;
+            memcpy(shadow->web_root_utf8, server->web_root_utf8, sizeof(shadow->web_root_utf8));
+            shadow->serve_embedded_assets = server->serve_embedded_assets;
+            shadow->stop_event = server->stop_event;
+            shadow->running = 1;
+            shadow->payload_cache = create_payload_cache(primary_cache->epoch);
+            InitializeCriticalSection(&shadow->wake_lock);
+            shadow->wake_lock_initialized = 1;
+            InitializeCriticalSection(&shard->handoff_lock);
+            shard->http_protocol = listener->pfn;
+            if(shadow->payload_cache)
+            {
+                shadow->thread_handle = CreateThread(nullptr, 0, http_loop_thread, shard, 0, nullptr);
+            }
+            if(!shadow->thread_handle)
+            {
+                destroy_loop_shard(shard);
+                break;
+            }
+            loops->shards.push_back(shard);
         }
 
-        if(has_id && http_method_is(message, "POST"))
+        if(loops->shards.empty())
         {
-            handle_modify_torrent(connection, server, torrent_id, action);
+            delete loops;
             return;
         }
-
-        respond_error(connection, 405, "unsupported-method");
+        server->loops = loops;
+        DebugOut("http_server: Running %u event loops.\n", static_cast<unsigned int>(loops->shards.size() + 1));
     }
 
-    static bool handle_api_request(struct mg_connection* connection, HttpServer* server, struct mg_http_message* message)
+    // Runs after the stop event is set, so every loop is already winding down.
+    static void stop_loop_shards(HttpServer* server)
     {
-        if(http_uri_matches(message, "/api/session"))
+        HttpLoopSet* loops = reinterpret_cast<HttpLoopSet*>(server->loops);
+        if(!loops)
         {
-            handle_session_request(connection, server);
-            return true;
+            return;
         }
-
-        if(http_uri_matches(message, "/api/torrents"))
+        server->loops = nullptr;
+        for(size_t i = 0; i < loops->shards.size(); ++i)
         {
-            handle_torrents_request(connection, server, message);
-            return true;
+            destroy_loop_shard(loops->shards[i]);
         }
+        delete loops;
+    }
 
-        if(http_uri_matches(message, "/api/torrents/*"))
+    // Accept thread hook. Only the first socket of a batch wakes the loop.
+    static void on_local_accept(void* context, SOCKET socket)
+    {
+        HttpLocalTransport* local = reinterpret_cast<HttpLocalTransport*>(context);
+        EnterCriticalSection(&local->accepted_lock);
+        const bool was_empty = local->accepted.empty();
+        local->accepted.push_back(socket);
+        LeaveCriticalSection(&local->accepted_lock);
+        if(was_empty)
         {
-            handle_torrents_request(connection, server, message);
-            return true;
+            wake_server(local->server);
         }
+    }
 
-        if(http_uri_matches(message, "/ws"))
+    // Local sockets join the primary loop as HTTP connections and, in
+    // multi-loop mode, are dealt on like TCP accepts.
+    static void adopt_local_connections(HttpServer* server, struct mg_mgr* mgr)
+    {
+        HttpLocalTransport* local = reinterpret_cast<HttpLocalTransport*>(server->local);
+        if(!local)
         {
-            mg_ws_upgrade(connection, message, nullptr);
-            return true;
+            return;
         }
+        std::vector<SOCKET> sockets;
+        EnterCriticalSection(&local->accepted_lock);
+        sockets.swap(local->accepted);
+        LeaveCriticalSection(&local->accepted_lock);
 
-        return false;
+        for(size_t i = 0; i < sockets.size(); ++i)
+        {
+            struct mg_connection* connection = mg_wrapfd(mgr, static_cast<int>(sockets[i]), handle_http_event, server);
+            if(!connection)
+            {
+                closesocket(sockets[i]);
+                continue;
+            }
+            connection->pfn = local->http_protocol;
+            connection->is_accepted = 1;
+            if(server->loops)
+            {
+                hand_off_connection(server, connection);
+            }
+        }
     }
 
-    static void maybe_broadcast_updates(struct mg_mgr* mgr, HttpServer* server)
+    static void start_local_listener(HttpServer* server, struct mg_connection* listener)
     {
-        if(!server || !mgr || !server->config.engine)
+        if(server->config.local_socket_path[0] == L'\0')
         {
             return;
         }
-
-        const unsigned int interval = server->config.broadcast_interval_ms ? server->config.broadcast_interval_ms : 1000;
-        const ULONGLONG now = GetTickCount64();
-        if(server->last_broadcast_tick != 0 && (now - server->last_broadcast_tick) < interval)
+        HttpLocalTransport* local = new (std::nothrow) HttpLocalTransport();
+        if(!local)
         {
             return;
         }
-        server->last_broadcast_tick = now;
-
-        EngineSessionSnapshot snapshot;
-        reset_snapshot(&snapshot);
-        collect_snapshot(server, &snapshot);
-
-        std::string payload;
-        build_torrents_payload(server, snapshot, payload);
-
-        for(struct mg_connection* conn = mgr->conns; conn != nullptr; conn = conn->next)
+        local->server = server;
+        local->http_protocol = listener->pfn;
+        InitializeCriticalSection(&local->accepted_lock);
+        // Published first: the accept thread may wake the loop at once.
+        server->local = local;
+        if(http_local_listener_init(&local->listener, server->config.local_socket_path, on_local_accept, local) != 0)
         {
-            if(conn->is_websocket)
-            {
-                mg_ws_send(conn, payload.c_str(), payload.size(), WEBSOCKET_OP_TEXT);
-            }
+            DebugOut("http_server: Local socket disabled.\n");
+            server->local = nullptr;
+            DeleteCriticalSection(&local->accepted_lock);
+            delete local;
+            return;
         }
+        DebugOut("http_server: Also listening on local socket %ls\n", server->config.local_socket_path);
     }
 
-    static void handle_http_event(struct mg_connection* connection, int event, void* event_data)
+    static void stop_local_listener(HttpServer* server)
     {
-        if(!connection)
+        HttpLocalTransport* local = reinterpret_cast<HttpLocalTransport*>(server->local);
+        if(!local)
         {
             return;
         }
-
-        HttpServer* server = reinterpret_cast<HttpServer*>(connection->fn_data);
-        if(!server)
+        http_local_listener_shutdown(&local->listener);
+        server->local = nullptr;
+        for(size_t i = 0; i < local->accepted.size(); ++i)
         {
-            return;
+            closesocket(local->accepted[i]);
         }
+        DeleteCriticalSection(&local->accepted_lock);
+        delete local;
+    }
 
-        switch(event)
-        {
-            case MG_EV_HTTP_MSG:
-            {
-                struct mg_http_message* message = reinterpret_cast<struct mg_http_message*>(event_data);
-                if(handle_api_request(connection, server, message))
-                {
-                    return;
-                }
-
-                struct mg_http_serve_opts opts;
-                memset(&opts, 0, sizeof(opts));
-                opts.root_dir = server->web_root_utf8[0] ? server->web_root_utf8 : ".";
-                mg_http_serve_dir(connection, message, &opts);
-                break;
-            }
-
-            case MG_EV_WS_OPEN:
-            {
-                DebugOut("http_server: WebSocket client connected.\n");
-                EngineSessionSnapshot snapshot;
-                reset_snapshot(&snapshot);
-                collect_snapshot(server, &snapshot);
-                std::string payload;
-                build_torrents_payload(server, snapshot, payload);
-                mg_ws_send(connection, payload.c_str(), payload.size(), WEBSOCKET_OP_TEXT);
-                break;
-            }
-
-            case MG_EV_WS_MSG:
-            {
-                // Ignore incoming messages for now; UI is write-only.
-                break;
-            }
-
-            default:
-                break;
-        }
+    // Worker pool hook: a finished job is waiting to be drained.
+    static void on_work_complete(void* context)
+    {
+        wake_server(reinterpret_cast<HttpServer*>(context));
     }
 
     DWORD WINAPI http_server_thread(LPVOID context)
@@ -583,8 +3908,21 @@ namespace
             return 0;
         }
 
+        HttpPayloadCache* cache = create_payload_cache(GetTickCount64());
+        if(!cache)
+        {
+            InterlockedExchange(&server->running, 0);
+            return 0;
+        }
+        server->payload_cache = cache;
+
         struct mg_mgr mgr;
         mg_mgr_init(&mgr);
+        const bool can_wake = mg_wakeup_init(&mgr);
+        if(!can_wake)
+        {
+            DebugOut("http_server: mg_wakeup unavailable; falling back to polling.\n");
+        }
 
         char address[64];
         _snprintf_s(address, sizeof(address), _TRUNCATE, "http://127.0.0.1:%hu", server->config.port);
@@ -595,20 +3933,75 @@ namespace
         {
             DebugOut("http_server: Failed to listen on %s\n", address);
             mg_mgr_free(&mgr);
+            server->payload_cache = nullptr;
+            delete cache;
             InterlockedExchange(&server->running, 0);
             return 0;
         }
 
-        server->last_broadcast_tick = GetTickCount64();
-        DebugOut("http_server: Listening on %s root=%s\n", address, server->web_root_utf8);
+        DebugOut("http_server: Listening on %s root=%s\n", address,
+            server->serve_embedded_assets ? "(embedded)" : server->web_root_utf8);
+        start_loop_shards(server, listener);
+        start_local_listener(server, listener);
+
+        if(can_wake)
+        {
+            EnterCriticalSection(&server->wake_lock);
+            server->wake_mgr = &mgr;
+            server->wake_conn_id = listener->id;
+            LeaveCriticalSection(&server->wake_lock);
+            if(server->config.engine)
+            {
+                engine_session_set_change_callback(server->config.engine, on_engine_change, server);
+            }
+        }
+
+        HttpWorkerPool* workers = new (std::nothrow) HttpWorkerPool();
+        if(workers && http_workers_init(workers, server->config.worker_threads, on_work_complete, server) == 0)
+        {
+            server->workers = workers;
+        }
+        else
+        {
+            DebugOut("http_server: Worker pool unavailable; serializing inline.\n");
+            delete workers;
+        }
 
         while(WaitForSingleObject(server->stop_event, 0) != WAIT_OBJECT_0)
         {
-            mg_mgr_poll(&mgr, server->config.poll_interval_ms);
-            maybe_broadcast_updates(&mgr, server);
+            InterlockedExchange(&server->wake_pending, 0);
+            adopt_local_connections(server, &mgr);
+            const unsigned int wait_ms = pump_event_feeds(&mgr, server, maybe_broadcast_updates(&mgr, server));
+            mg_mgr_poll(&mgr, static_cast<int>(wait_ms));
+            if(server->workers)
+            {
+                http_workers_drain(reinterpret_cast<HttpWorkerPool*>(server->workers), &mgr);
+            }
+        }
+
+        if(server->config.engine)
+        {
+            engine_session_set_change_callback(server->config.engine, nullptr, nullptr);
+        }
+        EnterCriticalSection(&server->wake_lock);
+        server->wake_mgr = nullptr;
+        LeaveCriticalSection(&server->wake_lock);
+        stop_local_listener(server);
+        stop_loop_shards(server);
+
+        // Jobs hold the cache and connection IDs; settle them before either goes.
+        if(server->workers)
+        {
+            HttpWorkerPool* pool = reinterpret_cast<HttpWorkerPool*>(server->workers);
+            http_workers_shutdown(pool);
+            http_workers_drain(pool, &mgr);
+            server->workers = nullptr;
+            delete pool;
         }
 
         mg_mgr_free(&mgr);
+        server->payload_cache = nullptr;
+        destroy_payload_cache(cache);
         InterlockedExchange(&server->running, 0);
         return 0;
     }
@@ -624,7 +4017,10 @@ void http_server_config_default(HttpServerConfig* config)
     config->port = 32145;
     config->poll_interval_ms = 250;
     config->broadcast_interval_ms = 750;
+    config->worker_threads = 0;
+    config->loop_count = 1;
     config->web_root[0] = L'\0';
+    config->local_socket_path[0] = L'\0';
     config->engine = nullptr;
 }
 
@@ -661,10 +4057,20 @@ int http_server_init(HttpServer* server, const HttpServerConfig* config)
     {
         local_config.port = 1;
     }
+    if(local_config.loop_count == 0)
+    {
+        local_config.loop_count = 1;
+    }
+    if(local_config.loop_count > kHttpMaxLoops)
+    {
+        local_config.loop_count = kHttpMaxLoops;
+    }
 
     determine_web_root(local_config.web_root, MAX_PATH, requested_root);
     server->config = local_config;
     wide_to_utf8(server->config.web_root, server->web_root_utf8, sizeof(server->web_root_utf8));
+    // The packed bundle wins unless a web root was asked for explicitly.
+    server->serve_embedded_assets = requested_root == nullptr && kHttpAssetCount != 0;
 
     server->stop_event = CreateEventW(nullptr, TRUE, FALSE, nullptr);
     if(!server->stop_event)
@@ -672,6 +4078,9 @@ int http_server_init(HttpServer* server, const HttpServerConfig* config)
         return -2;
     }
 
+    InitializeCriticalSection(&server->wake_lock);
+    server->wake_lock_initialized = 1;
+
     server->running = 1;
     server->thread_handle = CreateThread(nullptr, 0, http_server_thread, server, 0, nullptr);
     if(!server->thread_handle)
@@ -695,6 +4104,7 @@ void http_server_shutdown(HttpServer* server)
     if(server->stop_event)
     {
         SetEvent(server->stop_event);
+        wake_server(server);
     }
 
     if(server->thread_handle)
@@ -710,6 +4120,12 @@ void http_server_shutdown(HttpServer* server)
         server->stop_event = nullptr;
     }
 
+    if(server->wake_lock_initialized)
+    {
+        DeleteCriticalSection(&server->wake_lock);
+        server->wake_lock_initialized = 0;
+    }
+
     server->running = 0;
 }
 
@@ -4,13 +4,34 @@
 #include <stdint.h>
 
 struct EngineSession;
+struct mg_mgr;
+struct HttpWorkerPool;
+
+// Largest client WebSocket message accepted once inflated; a compressed
+// message that would grow past it is refused.
+const size_t kHttpWsMaxInflatedBytes = 64 * 1024;
 
 struct HttpServerConfig
 {
     unsigned short port;
+    // Poll period while WebSocket output is pending; idle loops block until
+    // woken.
     unsigned int poll_interval_ms;
+    // Minimum gap between shared-stream broadcasts. Engine changes are
+    // pushed as soon as this allows.
     unsigned int broadcast_interval_ms;
+    // Serialization threads for large torrent lists; 0 picks one per spare
+    // core.
+    unsigned int worker_threads;
+    // Event loops (threads) sharing the listening port; accepted
+    // connections are dealt round-robin. 1 keeps everything on one thread.
+    unsigned int loop_count;
+    // Serve UI files from this directory instead of the packed bundle
+    // (development override). Empty means the bundle.
     wchar_t web_root[MAX_PATH];
+    // AF_UNIX socket serving the same API and WebSocket to local scripts,
+    // guarded by its file DACL instead of a port. Empty means none.
+    wchar_t local_socket_path[MAX_PATH];
     EngineSession* engine;
 };
 
@@ -21,7 +42,24 @@ struct HttpServer
     HANDLE stop_event;
     volatile LONG running;
     char web_root_utf8[MAX_PATH];
+    int serve_embedded_assets;
     ULONGLONG last_broadcast_tick;
+    // Serialized payloads for the current engine version; server thread only.
+    void* payload_cache;
+    // Null when large lists are serialized inline; server thread only.
+    struct HttpWorkerPool* workers;
+    // Extra event loops in multi-loop mode; owned by the server thread.
+    void* loops;
+    // Local socket listener and the sockets it has accepted; owned by the
+    // server thread.
+    void* local;
+    // Lets other threads wake the poll loop; wake_mgr is null while it
+    // cannot be woken.
+    CRITICAL_SECTION wake_lock;
+    int wake_lock_initialized;
+    struct mg_mgr* wake_mgr;
+    unsigned long wake_conn_id;
+    volatile LONG wake_pending;
 };
 
 void http_server_config_default(HttpServerConfig* config);
@@ -0,0 +1,204 @@
+#include "net/http_workers.h"
+
+#include "debug.h"
+
+namespace
+{
+    static HttpWorkItem* pop_queued(HttpWorkerPool* pool)
+    {
+        EnterCriticalSection(&pool->queue_lock);
+        HttpWorkItem* item = pool->queue_head;
+        if(item)
+        {
+            pool->queue_head = item->next_queued;
+            if(!pool->queue_head)
+            {
+                pool->queue_tail = nullptr;
+            }
+            item->next_queued = nullptr;
+        }
+        LeaveCriticalSection(&pool->queue_lock);
+        return item;
+    }
+
+    // Only the push onto an empty list notifies; the drain flushes the whole
+    // list, so later pushes ride on the same wakeup.
+    static void push_completed(HttpWorkerPool* pool, HttpWorkItem* item)
+    {
+        if(InterlockedPushEntrySList(&pool->completed, &item->link) == nullptr && pool->notify)
+        {
+            pool->notify(pool->notify_context);
+        }
+    }
+
+    DWORD WINAPI http_worker_thread(LPVOID context)
+    {
+        HttpWorkerPool* pool = reinterpret_cast<HttpWorkerPool*>(context);
+        for(;;)
+        {
+            WaitForSingleObject(pool->queue_semaphore, INFINITE);
+            if(pool->stopping)
+            {
+                break;
+            }
+            HttpWorkItem* item = pop_queued(pool);
+            if(!item)
+            {
+                continue;
+            }
+            item->run(item);
+            push_completed(pool, item);
+        }
+        return 0;
+    }
+
+    static unsigned int default_thread_count()
+    {
+        SYSTEM_INFO info;
+        GetSystemInfo(&info);
+        const unsigned int spare = info.dwNumberOfProcessors > 1 ? info.dwNumberOfProcessors - 1 : 1;
+        return spare < kHttpWorkersMax ? spare : kHttpWorkersMax;
+    }
+}
+
+int http_workers_init(HttpWorkerPool* pool, unsigned int thread_count, HttpWorkNotifyFn notify, void* notify_context)
+{
+    if(!pool)
+    {
+        return -1;
+    }
+
+    ZeroMemory(pool, sizeof(*pool));
+    InitializeSListHead(&pool->completed);
+    pool->notify = notify;
+    pool->notify_context = notify_context;
+
+    if(thread_count == 0)
+    {
+        thread_count = default_thread_count();
+    }
+    if(thread_count > kHttpWorkersMax)
+    {
+        thread_count = kHttpWorkersMax;
+    }
+
+    pool->queue_semaphore = CreateSemaphoreW(nullptr, 0, 0x7fffffff, nullptr);
+    if(!pool->queue_semaphore)
+    {
+        return -2;
+    }
+    InitializeCriticalSection(&pool->queue_lock);
+    pool->queue_lock_initialized = 1;
+
+    for(unsigned int i = 0; i < thread_count; ++i)
+    {
+        pool->threads[i] = CreateThread(nullptr, 0, http_worker_thread, pool, 0, nullptr);
+        if(!pool->threads[i])
+        {
+            break;
+        }
+        pool->thread_count++;
+    }
+
+    if(pool->thread_count == 0)
+    {
+        http_workers_shutdown(pool);
+        return -3;
+    }
+
+    DebugOut("http_workers: started %u worker(s).\n", pool->thread_count);
+    return 0;
+}
+
+bool http_workers_submit(HttpWorkerPool* pool, HttpWorkItem* item)
+{
+    if(!pool || !item || pool->thread_count == 0 || pool->stopping)
+    {
+        return false;
+    }
+
+    item->next_queued = nullptr;
+    item->cancelled = 0;
+    EnterCriticalSection(&pool->queue_lock);
+    if(pool->queue_tail)
+    {
+        pool->queue_tail->next_queued = item;
+    }
+    else
+    {
+        pool->queue_head = item;
+    }
+    pool->queue_tail = item;
+    LeaveCriticalSection(&pool->queue_lock);
+
+    ReleaseSemaphore(pool->queue_semaphore, 1, nullptr);
+    return true;
+}
+
+unsigned int http_workers_drain(HttpWorkerPool* pool, void* context)
+{
+    if(!pool)
+    {
+        return 0;
+    }
+
+    // The list pops newest first; reverse it so completions keep their order.
+    PSLIST_ENTRY entry = InterlockedFlushSList(&pool->completed);
+    HttpWorkItem* ordered = nullptr;
+    while(entry)
+    {
+        HttpWorkItem* item = CONTAINING_RECORD(entry, HttpWorkItem, link);
+        entry = entry->Next;
+        item->next_queued = ordered;
+        ordered = item;
+    }
+
+    unsigned int count = 0;
+    while(ordered)
+    {
+        HttpWorkItem* item = ordered;
+        ordered = item->next_queued;
+        item->next_queued = nullptr;
+        item->complete(item, context);
+        ++count;
+    }
+    return count;
+}
+
+void http_workers_shutdown(HttpWorkerPool* pool)
+{
+    if(!pool)
+    {
+        return;
+    }
+
+    InterlockedExchange(&pool->stopping, 1);
+    if(pool->queue_semaphore && pool->thread_count != 0)
+    {
+        ReleaseSemaphore(pool->queue_semaphore, static_cast<LONG>(pool->thread_count), nullptr);
+    }
+    for(unsigned int i = 0; i < pool->thread_count; ++i)
+    {
+        WaitForSingleObject(pool->threads[i], INFINITE);
+        CloseHandle(pool->threads[i]);
+        pool->threads[i] = nullptr;
+    }
+    pool->thread_count = 0;
+
+    if(pool->queue_lock_initialized)
+    {
+        for(HttpWorkItem* item = pop_queued(pool); item != nullptr; item = pop_queued(pool))
+        {
+            item->cancelled = 1;
+            InterlockedPushEntrySList(&pool->completed, &item->link);
+        }
+        DeleteCriticalSection(&pool->queue_lock);
+        pool->queue_lock_initialized = 0;
+    }
+
+    if(pool->queue_semaphore)
+    {
+        CloseHandle(pool->queue_semaphore);
+        pool->queue_semaphore = nullptr;
+    }
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <windows.h>
+
+// Small thread pool for CPU-heavy HTTP handler work (snapshot serialization).
+// Items are queued by the I/O thread, run on a worker, and handed back on a
+// lock-free completion list that the I/O thread drains between polls.
+
+const unsigned int kHttpWorkersMax = 4;
+
+struct HttpWorkItem;
+typedef void (*HttpWorkRunFn)(HttpWorkItem* item);
+// Runs on the draining thread. `item->cancelled` is set for items the pool
+// shut down before running; the callback still owns and frees them.
+typedef void (*HttpWorkCompleteFn)(HttpWorkItem* item, void* context);
+// Called from a worker when the completion list goes from empty to non-empty.
+typedef void (*HttpWorkNotifyFn)(void* context);
+
+// Embed first in the caller's job struct.
+struct HttpWorkItem
+{
+    SLIST_ENTRY link;
+    HttpWorkItem* next_queued;
+    HttpWorkRunFn run;
+    HttpWorkCompleteFn complete;
+    int cancelled;
+};
+
+struct HttpWorkerPool
+{
+    HANDLE threads[kHttpWorkersMax];
+    unsigned int thread_count;
+    CRITICAL_SECTION queue_lock;
+    int queue_lock_initialized;
+    HttpWorkItem* queue_head;
+    HttpWorkItem* queue_tail;
+    HANDLE queue_semaphore;
+    volatile LONG stopping;
+    SLIST_HEADER completed;
+    HttpWorkNotifyFn notify;
+    void* notify_context;
+};
+
+// `thread_count` 0 means one per spare core, capped at kHttpWorkersMax.
+int http_workers_init(HttpWorkerPool* pool, unsigned int thread_count, HttpWorkNotifyFn notify, void* notify_context);
+// Returns false when the pool is not running; the caller keeps the item.
+bool http_workers_submit(HttpWorkerPool* pool, HttpWorkItem* item);
+// Completes finished items in the order they finished. Returns the count.
+unsigned int http_workers_drain(HttpWorkerPool* pool, void* context);
+// Joins the workers. Items still queued come back cancelled on the next drain.
+void http_workers_shutdown(HttpWorkerPool* pool);
@@ -0,0 +1,476 @@
+#include "net/json_reader.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+namespace
+{
+    enum JsonExpect
+    {
+        JsonExpect_Value = 0,
+        JsonExpect_KeyOrEnd,
+        JsonExpect_Key,
+        JsonExpect_CommaOrEnd,
+        JsonExpect_ValueOrEnd,
+        JsonExpect_Done
+    };
+
+    static void skip_whitespace(JsonReader* reader)
+    {
+        while(reader->cursor < reader->end)
+        {
+            const char ch = *reader->cursor;
+            if(ch != ' ' && ch != '\t' && ch != '\n' && ch != '\r')
+            {
+                break;
+            }
+            ++reader->cursor;
+        }
+    }
+
+    static bool fail(JsonReader* reader)
+    {
+        reader->failed = 1;
+        reader->cursor = reader->end;
+        return false;
+    }
+
+    static bool in_object(const JsonReader* reader)
+    {
+        return reader->depth != 0 && (reader->object_bits & (1u << (reader->depth - 1))) != 0;
+    }
+
+    // After a complete value: either the document ends or a separator follows.
+    static void value_finished(JsonReader* reader)
+    {
+        reader->expect = reader->depth == 0 ? JsonExpect_Done : JsonExpect_CommaOrEnd;
+    }
+
+    static int hex_value(char ch)
+    {
+        if(ch >= '0' && ch <= '9')
+        {
+            return ch - '0';
+        }
+        if(ch >= 'a' && ch <= 'f')
+        {
+            return ch - 'a' + 10;
+        }
+        if(ch >= 'A' && ch <= 'F')
+        {
+            return ch - 'A' + 10;
+        }
+        return -1;
+    }
+
+    static bool read_hex4(const char* text, const char* end, unsigned int* out)
+    {
+        if(end - text < 4)
+        {
+            return false;
+        }
+        unsigned int value = 0;
+        for(int i = 0; i < 4; ++i)
+        {
+            const int digit = hex_value(text[i]);
+            if(digit < 0)
+            {
+                return false;
+            }
+            value = (value << 4) | static_cast<unsigned int>(digit);
+        }
+        *out = value;
+        return true;
+    }
+
+    // `text` points just past a backslash.
+    static bool escape_is_valid(const char* text, const char* end)
+    {
+        unsigned int unit = 0;
+        switch(*text)
+        {
+            case '"': case '\\': case '/': case 'b': case 'f': case 'n': case 'r': case 't':
+                return true;
+            case 'u':
+                return read_hex4(text + 1, end, &unit);
+            default:
+                return false;
+        }
+    }
+
+    static bool scan_string(JsonReader* reader, JsonToken* token)
+    {
+        char* start = ++reader->cursor;
+        int escaped = 0;
+        while(reader->cursor < reader->end)
+        {
+            const char ch = *reader->cursor;
+            if(ch == '"')
+            {
+                token->type = JsonToken_String;
+                token->text = start;
+                token->len = static_cast<size_t>(reader->cursor - start);
+                token->escaped = escaped;
+                ++reader->cursor;
+                return true;
+            }
+            if(static_cast<unsigned char>(ch) < 0x20)
+            {
+                return fail(reader);
+            }
+            if(ch == '\\')
+            {
+                // Only the escapes RFC 8259 defines. Each decodes to no more
+                // bytes than it occupies, which unescape_in_place relies on.
+                escaped = 1;
+                if(++reader->cursor == reader->end || !escape_is_valid(reader->cursor, reader->end))
+                {
+                    return fail(reader);
+                }
+            }
+            ++reader->cursor;
+        }
+        return fail(reader);
+    }
+
+    static bool scan_literal(JsonReader* reader, const char* literal, JsonTokenType type, JsonToken* token)
+    {
+        const size_t len = strlen(literal);
+        if(static_cast<size_t>(reader->end - reader->cursor) < len || memcmp(reader->cursor, literal, len) != 0)
+        {
+            return fail(reader);
+        }
+        token->type = type;
+        token->text = reader->cursor;
+        token->len = len;
+        reader->cursor += len;
+        return true;
+    }
+
+    static bool scan_number(JsonReader* reader, JsonToken* token)
+    {
+        char* start = reader->cursor;
+        while(reader->cursor < reader->end)
+        {
+            const char ch = *reader->cursor;
+            if((ch < '0' || ch > '9') && ch != '-' && ch != '+' && ch != '.' && ch != 'e' && ch != 'E')
+            {
+                break;
+            }
+            ++reader->cursor;
+        }
+        token->type = JsonToken_Number;
+        token->text = start;
+        token->len = static_cast<size_t>(reader->cursor - start);
+        return true;
+    }
+
+    static char* put_utf8(char* dest, unsigned int cp)
+    {
+        if(cp < 0x80)
+        {
+            *dest++ = static_cast<char>(cp);
+        }
+        else if(cp < 0x800)
+        {
+            *dest++ = static_cast<char>(0xC0 | (cp >> 6));
+            *dest++ = static_cast<char>(0x80 | (cp & 0x3F));
+        }
+        else if(cp < 0x10000)
+        {
+            *dest++ = static_cast<char>(0xE0 | (cp >> 12));
+            *dest++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            *dest++ = static_cast<char>(0x80 | (cp & 0x3F));
+        }
+        else
+        {
+            *dest++ = static_cast<char>(0xF0 | (cp >> 18));
+            *dest++ = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+            *dest++ = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+            *dest++ = static_cast<char>(0x80 | (cp & 0x3F));
+        }
+        return dest;
+    }
+
+    // Decodes `token` onto itself. scan_string admitted only well-formed
+    // escapes: two-byte ones decode to one byte, and a 6-byte \uXXXX to at
+    // most 3 (4 for a 12-byte surrogate pair), so the write cursor never
+    // overtakes the read cursor. Lone surrogates decode to U+FFFD.
+    static void unescape_in_place(JsonToken* token)
+    {
+        const char* src = token->text;
+        const char* end = token->text + token->len;
+        char* dest = token->text;
+        while(src < end)
+        {
+            if(*src != '\\')
+            {
+                *dest++ = *src++;
+                continue;
+            }
+
+            ++src;
+            const char ch = src < end ? *src++ : '\0';
+            switch(ch)
+            {
+                case '"': *dest++ = '"'; break;
+                case '\\': *dest++ = '\\'; break;
+                case '/': *dest++ = '/'; break;
+                case 'b': *dest++ = '\b'; break;
+                case 'f': *dest++ = '\f'; break;
+                case 'n': *dest++ = '\n'; break;
+                case 'r': *dest++ = '\r'; break;
+                case 't': *dest++ = '\t'; break;
+                case 'u':
+                {
+                    unsigned int cp = 0;
+                    read_hex4(src, end, &cp);
+                    src += 4;
+                    unsigned int low = 0;
+                    if(cp >= 0xD800 && cp <= 0xDBFF && end - src >= 6 && src[0] == '\\' && src[1] == 'u' &&
+                        read_hex4(src + 2, end, &low) && low >= 0xDC00 && low <= 0xDFFF)
+                    {
+                        cp = 0x10000 + ((cp - 0xD800) << 10) + (low - 0xDC00);
+                        src += 6;
+                    }
+                    else if(cp >= 0xD800 && cp <= 0xDFFF)
+                    {
+                        cp = 0xFFFD;
+                    }
+                    dest = put_utf8(dest, cp);
+                    break;
+                }
+                default:
+                    break;
+            }
+        }
+        token->len = static_cast<size_t>(dest - token->text);
+        token->escaped = 0;
+    }
+}
+
+void json_reader_init(JsonReader* reader, char* text, size_t len)
+{
+    if(!reader)
+    {
+        return;
+    }
+    reader->cursor = text;
+    reader->end = text ? text + len : text;
+    reader->depth = 0;
+    reader->object_bits = 0;
+    reader->expect = JsonExpect_Value;
+    reader->failed = 0;
+}
+
+bool json_reader_next(JsonReader* reader, JsonToken* token)
+{
+    if(!reader || !token || reader->failed)
+    {
+        return false;
+    }
+
+    token->type = JsonToken_None;
+    token->text = nullptr;
+    token->len = 0;
+    token->escaped = 0;
+    token->is_key = 0;
+
+    skip_whitespace(reader);
+    if(reader->cursor == reader->end)
+    {
+        if(reader->expect != JsonExpect_Done)
+        {
+            reader->failed = 1;
+        }
+        return false;
+    }
+
+    char ch = *reader->cursor;
+    if(reader->expect == JsonExpect_Done)
+    {
+        return fail(reader);
+    }
+
+    if(reader->expect == JsonExpect_CommaOrEnd)
+    {
+        const char closer = in_object(reader) ? '}' : ']';
+        if(ch == ',')
+        {
+            ++reader->cursor;
+            skip_whitespace(reader);
+            if(reader->cursor == reader->end)
+            {
+                return fail(reader);
+            }
+            ch = *reader->cursor;
+            reader->expect = in_object(reader) ? JsonExpect_Key : JsonExpect_Value;
+        }
+        else if(ch != closer)
+        {
+            return fail(reader);
+        }
+    }
+
+    // Closers are legal right after a comma-free value or an opener.
+    if(ch == '}' || ch == ']')
+    {
+        const bool closes_object = ch == '}';
+        const bool allowed = closes_object
+            ? (reader->expect == JsonExpect_KeyOrEnd || reader->expect == JsonExpect_CommaOrEnd) && in_object(reader)
+            : (reader->expect == JsonExpect_ValueOrEnd || reader->expect == JsonExpect_CommaOrEnd) && reader->depth != 0 && !in_object(reader);
+        if(!allowed)
+        {
+            return fail(reader);
+        }
+        ++reader->cursor;
+        --reader->depth;
+        reader->object_bits &= ~(1u << reader->depth);
+        token->type = closes_object ? JsonToken_ObjectEnd : JsonToken_ArrayEnd;
+        value_finished(reader);
+        return true;
+    }
+
+    if(reader->expect == JsonExpect_Key || reader->expect == JsonExpect_KeyOrEnd)
+    {
+        if(ch != '"' || !scan_string(reader, token))
+        {
+            return fail(reader);
+        }
+        token->is_key = 1;
+        skip_whitespace(reader);
+        if(reader->cursor == reader->end || *reader->cursor != ':')
+        {
+            return fail(reader);
+        }
+        ++reader->cursor;
+        reader->expect = JsonExpect_Value;
+        return true;
+    }
+
+    // A value is expected.
+    switch(ch)
+    {
+        case '{':
+        case '[':
+            if(reader->depth == kJsonReaderMaxDepth)
+            {
+                return fail(reader);
+            }
+            ++reader->cursor;
+            if(ch == '{')
+            {
+                reader->object_bits |= 1u << reader->depth;
+            }
+            ++reader->depth;
+            token->type = ch == '{' ? JsonToken_ObjectBegin : JsonToken_ArrayBegin;
+            reader->expect = ch == '{' ? JsonExpect_KeyOrEnd : JsonExpect_ValueOrEnd;
+            return true;
+        case '"':
+            if(!scan_string(reader, token))
+            {
+                return false;
+            }
+            break;
+        case 't':
+            if(!scan_literal(reader, "true", JsonToken_True, token))
+            {
+                return false;
+            }
+            break;
+        case 'f':
+            if(!scan_literal(reader, "false", JsonToken_False, token))
+            {
+                return false;
+            }
+            break;
+        case 'n':
+            if(!scan_literal(reader, "null", JsonToken_Null, token))
+            {
+                return false;
+            }
+            break;
+        default:
+            if(ch != '-' && (ch < '0' || ch > '9'))
+            {
+                return fail(reader);
+            }
+            scan_number(reader, token);
+            break;
+    }
+
+    value_finished(reader);
+    return true;
+}
+
+bool json_reader_skip(JsonReader* reader, const JsonToken* first)
+{
+    if(!reader || !first)
+    {
+        return false;
+    }
+    if(first->type != JsonToken_ObjectBegin && first->type != JsonToken_ArrayBegin)
+    {
+        return !reader->failed;
+    }
+
+    const unsigned int target = reader->depth - 1;
+    JsonToken token;
+    while(json_reader_next(reader, &token))
+    {
+        if((token.type == JsonToken_ObjectEnd || token.type == JsonToken_ArrayEnd) && reader->depth == target)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool json_reader_done(JsonReader* reader)
+{
+    if(!reader || reader->failed)
+    {
+        return false;
+    }
+    skip_whitespace(reader);
+    return reader->expect == JsonExpect_Done && reader->cursor == reader->end;
+}
+
+const char* json_token_cstr(JsonToken* token)
+{
+    if(!token || token->type != JsonToken_String)
+    {
+        return "";
+    }
+    if(token->escaped)
+    {
+        unescape_in_place(token);
+    }
+    // The closing quote (or bytes freed by unescaping) sits at text[len].
+    token->text[token->len] = '\0';
+    return token->text;
+}
+
+bool json_token_equals(const JsonToken* token, const char* text)
+{
+    if(!token || !text || token->type != JsonToken_String || token->escaped)
+    {
+        return false;
+    }
+    const size_t len = strlen(text);
+    return token->len == len && memcmp(token->text, text, len) == 0;
+}
+
+bool json_token_number(const JsonToken* token, double* out_value)
+{
+    if(!token || !out_value || token->type != JsonToken_Number || token->len == 0 || token->len >= 64)
+    {
+        return false;
+    }
+    char buffer[64];
+    memcpy(buffer, token->text, token->len);
+    buffer[token->len] = '\0';
+    char* end_ptr = nullptr;
+    *out_value = strtod(buffer, &end_ptr);
+    return end_ptr == buffer + token->len;
+}
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Single-pass, in-place JSON tokenizer for request bodies. Tokens point into
+// the caller's buffer; nothing is allocated or copied. Strings are unescaped
+// lazily and in place, so only strings that actually contain escapes are
+// rewritten. Escapes RFC 8259 does not define fail the parse; the rest never
+// decode longer than their source.
+
+enum JsonTokenType
+{
+    JsonToken_None = 0,
+    JsonToken_ObjectBegin,
+    JsonToken_ObjectEnd,
+    JsonToken_ArrayBegin,
+    JsonToken_ArrayEnd,
+    JsonToken_String,
+    JsonToken_Number,
+    JsonToken_True,
+    JsonToken_False,
+    JsonToken_Null
+};
+
+struct JsonToken
+{
+    JsonTokenType type;
+    char* text;
+    size_t len;
+    // Set on strings that contain backslashes and have not been decoded yet.
+    int escaped;
+    // Set on strings that are object keys.
+    int is_key;
+};
+
+const unsigned int kJsonReaderMaxDepth = 32;
+
+struct JsonReader
+{
+    char* cursor;
+    char* end;
+    unsigned int depth;
+    // One bit per open container: 1 = object, 0 = array.
+    unsigned int object_bits;
+    // What the grammar allows next; see json_reader.cpp.
+    int expect;
+    int failed;
+};
+
+void json_reader_init(JsonReader* reader, char* text, size_t len);
+
+// Returns false at the end of input or on a syntax error (`failed` tells
+// which). Commas and colons are consumed and checked, not returned.
+bool json_reader_next(JsonReader* reader, JsonToken* token);
+
+// Skips the rest of the value that starts with `first` (a whole object or
+// array, or nothing for scalars).
+bool json_reader_skip(JsonReader* reader, const JsonToken* first);
+
+// True once the top-level value has been read completely and only whitespace
+// remains.
+bool json_reader_done(JsonReader* reader);
+
+// Decodes escapes in place, NUL-terminates the string inside the buffer and
+// returns it. Call only after the reader has moved past the token.
+const char* json_token_cstr(JsonToken* token);
+
+bool json_token_equals(const JsonToken* token, const char* text);
+bool json_token_number(const JsonToken* token, double* out_value);
@@ -0,0 +1,188 @@
+#include "net/json_writer.h"
+
+#include <charconv>
+
+#include <math.h>
+#include <string.h>
+
+#include <intrin.h>
+#include <emmintrin.h>
+
+namespace
+{
+    static const char kDigitPairs[] =
+        "00010203040506070809"
+        "10111213141516171819"
+        "20212223242526272829"
+        "30313233343536373839"
+        "40414243444546474849"
+        "50515253545556575859"
+        "60616263646566676869"
+        "70717273747576777879"
+        "80818283848586878889"
+        "90919293949596979899";
+
+    static const unsigned long long kPowersOf10[] = {
+        1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull,
+        100000000ull, 1000000000ull, 10000000000ull, 100000000000ull, 1000000000000ull,
+        10000000000000ull, 100000000000000ull, 1000000000000000ull, 10000000000000000ull,
+        100000000000000000ull, 1000000000000000000ull, 10000000000000000000ull
+    };
+
+    static const double kDecimalScales[] = { 1.0, 10.0, 100.0, 1000.0, 10000.0, 100000.0, 1000000.0 };
+
+    static const char kHexDigits[] = "0123456789abcdef";
+
+    // log10 from the bit length (1233/4096 ~ log10(2)), then one compare to
+    // correct the estimate; no data-dependent loop. Setting the low bit never
+    // changes the digit count and makes 0 count as one digit.
+    static unsigned int count_digits(unsigned long long value)
+    {
+        value |= 1ull;
+        unsigned long high_bit = 0;
+        _BitScanReverse64(&high_bit, value);
+        const unsigned int estimate = ((static_cast<unsigned int>(high_bit) + 1u) * 1233u) >> 12;
+        return estimate + (value >= kPowersOf10[estimate] ? 1u : 0u);
+    }
+
+    // Writes `value` right-aligned so its last digit lands just before `end`.
+    static void write_digits(char* end, unsigned long long value)
+    {
+        while(value >= 100)
+        {
+            const unsigned int pair = static_cast<unsigned int>(value % 100) * 2;
+            value /= 100;
+            end -= 2;
+            end[0] = kDigitPairs[pair];
+            end[1] = kDigitPairs[pair + 1];
+        }
+        if(value >= 10)
+        {
+            const unsigned int pair = static_cast<unsigned int>(value) * 2;
+            end -= 2;
+            end[0] = kDigitPairs[pair];
+            end[1] = kDigitPairs[pair + 1];
+        }
+        else
+        {
+            *--end = static_cast<char>('0' + value);
+        }
+    }
+
+    // Bitmask of bytes in the block that need escaping: '"', '\\' or < 0x20.
+    static unsigned int unsafe_mask(const char* block)
+    {
+        const __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block));
+        const __m128i control_max = _mm_set1_epi8(0x1F);
+        const __m128i is_control = _mm_cmpeq_epi8(_mm_max_epu8(bytes, control_max), control_max);
+        const __m128i is_quote = _mm_cmpeq_epi8(bytes, _mm_set1_epi8('"'));
+        const __m128i is_backslash = _mm_cmpeq_epi8(bytes, _mm_set1_epi8('\\'));
+        return static_cast<unsigned int>(_mm_movemask_epi8(_mm_or_si128(is_control, _mm_or_si128(is_quote, is_backslash))));
+    }
+
+    static bool is_unsafe(unsigned char ch)
+    {
+        return ch < 0x20 || ch == '"' || ch == '\\';
+    }
+
+    static void write_escape(std::string& out, unsigned char ch)
+    {
+        switch(ch)
+        {
+            case '\\': out.append("\\\\", 2); break;
+            case '"': out.append("\\\"", 2); break;
+            case '\b': out.append("\\b", 2); break;
+            case '\f': out.append("\\f", 2); break;
+            case '\n': out.append("\\n", 2); break;
+            case '\r': out.append("\\r", 2); break;
+            case '\t': out.append("\\t", 2); break;
+            default:
+            {
+                const char escaped[6] = { '\\', 'u', '0', '0', kHexDigits[(ch >> 4) & 0x0F], kHexDigits[ch & 0x0F] };
+                out.append(escaped, sizeof(escaped));
+                break;
+            }
+        }
+    }
+}
+
+void json_write_uint(std::string& out, unsigned long long value)
+{
+    const unsigned int digits = count_digits(value);
+    const size_t start = out.size();
+    out.resize(start + digits);
+    write_digits(&out[start] + digits, value);
+}
+
+void json_write_double(std::string& out, double value, int max_decimals)
+{
+    if(!isfinite(value))
+    {
+        out.push_back('0');
+        return;
+    }
+
+    if(max_decimals >= 0 && max_decimals < static_cast<int>(sizeof(kDecimalScales) / sizeof(kDecimalScales[0])))
+    {
+        const double scale = kDecimalScales[max_decimals];
+        value = floor(value * scale + 0.5) / scale;
+    }
+
+    char buffer[32];
+    const std::to_chars_result result = std::to_chars(buffer, buffer + sizeof(buffer), value);
+    out.append(buffer, static_cast<size_t>(result.ptr - buffer));
+}
+
+void json_write_bool(std::string& out, bool value)
+{
+    if(value)
+    {
+        out.append("true", 4);
+    }
+    else
+    {
+        out.append("false", 5);
+    }
+}
+
+void json_write_string(std::string& out, const char* text)
+{
+    json_write_string_n(out, text, text ? strlen(text) : 0);
+}
+
+void json_write_string_n(std::string& out, const char* text, size_t len)
+{
+    out.reserve(out.size() + len + 2);
+    out.push_back('"');
+
+    size_t run_start = 0;
+    size_t pos = 0;
+    while(pos < len)
+    {
+        if(pos + 16 <= len)
+        {
+            const unsigned int mask = unsafe_mask(text + pos);
+            if(mask == 0)
+            {
+                pos += 16;
+                continue;
+            }
+            unsigned long bit = 0;
+            _BitScanForward(&bit, mask);
+            pos += bit;
+        }
+        else if(!is_unsafe(static_cast<unsigned char>(text[pos])))
+        {
+            ++pos;
+            continue;
+        }
+
+        out.append(text + run_start, pos - run_start);
+        write_escape(out, static_cast<unsigned char>(text[pos]));
+        ++pos;
+        run_start = pos;
+    }
+
+    out.append(text + run_start, len - run_start);
+    out.push_back('"');
+}
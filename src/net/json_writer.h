@@ -0,0 +1,23 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+
+// Append-only JSON primitives. Callers keep one std::string per payload and
+// clear() it between builds, so the buffer's capacity is reused instead of
+// regrown. Nothing here goes through printf.
+
+void json_write_uint(std::string& out, unsigned long long value);
+
+// Shortest text that round-trips `value`. With `max_decimals` >= 0 the value
+// is first rounded to that many places (progress uses 4). Non-finite values
+// are written as 0, since JSON has no NaN/Inf.
+void json_write_double(std::string& out, double value, int max_decimals);
+
+void json_write_bool(std::string& out, bool value);
+
+// Quoted, escaped string. Safe bytes are skipped 16 at a time.
+void json_write_string(std::string& out, const char* text);
+void json_write_string_n(std::string& out, const char* text, size_t len);
@@ -0,0 +1,467 @@
+#include "net/torrent_schema.h"
+
+#include <string.h>
+
+#include <utility>
+
+#include "net/json_writer.h"
+
+namespace
+{
+    typedef void (*TorrentFieldWriter)(std::string& out, const EngineTorrentStatus& status);
+    typedef bool (*TorrentFieldEqual)(const EngineTorrentStatus& a, const EngineTorrentStatus& b);
+
+    // One schema entry. Each format gets its own writer, generated from the
+    // member's type by the codec templates below; rows are written by calling
+    // through these pointers instead of switching on the field.
+    struct TorrentFieldDesc
+    {
+        const char* name;
+        // Pre-encoded `,"name":`; the first column skips the comma.
+        const char* json_key;
+        size_t json_key_len;
+        TorrentFieldWriter write_json;
+        TorrentFieldWriter write_csv;
+        TorrentFieldWriter write_binary;
+        TorrentFieldEqual equal;
+    };
+
+    template <typename T>
+    static void write_le(std::string& out, T value)
+    {
+        unsigned char bytes[sizeof(T)];
+        memcpy(bytes, &value, sizeof(T));
+        out.append(reinterpret_cast<const char*>(bytes), sizeof(T));
+    }
+
+    static void write_csv_string(std::string& out, const char* text)
+    {
+        out.push_back('"');
+        for(const char* quote = strchr(text, '"'); quote; quote = strchr(text, '"'))
+        {
+            out.append(text, static_cast<size_t>(quote - text) + 1);
+            out.push_back('"');
+            text = quote + 1;
+        }
+        out.append(text);
+        out.push_back('"');
+    }
+
+    template <typename T, T EngineTorrentStatus::*Member>
+    struct UintCodec
+    {
+        static void json(std::string& out, const EngineTorrentStatus& status) { json_write_uint(out, status.*Member); }
+        static void binary(std::string& out, const EngineTorrentStatus& status) { write_le<T>(out, status.*Member); }
+        static bool equal(const EngineTorrentStatus& a, const EngineTorrentStatus& b) { return a.*Member == b.*Member; }
+    };
+
+    template <float EngineTorrentStatus::*Member>
+    struct FloatCodec
+    {
+        static void json(std::string& out, const EngineTorrentStatus& status) { json_write_double(out, status.*Member, 4); }
+        static void binary(std::string& out, const EngineTorrentStatus& status) { write_le<float>(out, status.*Member); }
+        static bool equal(const EngineTorrentStatus& a, const EngineTorrentStatus& b) { return a.*Member == b.*Member; }
+    };
+
+    template <int EngineTorrentStatus::*Member>
+    struct FlagCodec
+    {
+        static void json(std::string& out, const EngineTorrentStatus& status) { json_write_bool(out, status.*Member != 0); }
+        static void binary(std::string& out, const EngineTorrentStatus& status) { out.push_back(status.*Member ? 1 : 0); }
+        static bool equal(const EngineTorrentStatus& a, const EngineTorrentStatus& b) { return (a.*Member != 0) == (b.*Member != 0); }
+    };
+
+    template <size_t N, char (EngineTorrentStatus::*Member)[N]>
+    struct StringCodec
+    {
+        static void json(std::string& out, const EngineTorrentStatus& status) { json_write_string(out, status.*Member); }
+        static void csv(std::string& out, const EngineTorrentStatus& status) { write_csv_string(out, status.*Member); }
+        static void binary(std::string& out, const EngineTorrentStatus& status)
+        {
+            const size_t len = strnlen(status.*Member, N);
+            write_le<uint16_t>(out, static_cast<uint16_t>(len));
+            out.append(status.*Member, len);
+        }
+        static bool equal(const EngineTorrentStatus& a, const EngineTorrentStatus& b) { return strncmp(a.*Member, b.*Member, N) == 0; }
+    };
+
+    typedef UintCodec<unsigned int, &EngineTorrentStatus::id> IdCodec;
+    typedef StringCodec<sizeof(EngineTorrentStatus::name), &EngineTorrentStatus::name> NameCodec;
+    typedef StringCodec<sizeof(EngineTorrentStatus::magnet_uri), &EngineTorrentStatus::magnet_uri> MagnetCodec;
+    typedef FloatCodec<&EngineTorrentStatus::progress> ProgressCodec;
+    typedef UintCodec<unsigned long long, &EngineTorrentStatus::size_bytes> SizeCodec;
+    typedef UintCodec<unsigned long long, &EngineTorrentStatus::downloaded_bytes> DownloadedCodec;
+    typedef UintCodec<unsigned int, &EngineTorrentStatus::download_rate> DownloadRateCodec;
+    typedef UintCodec<unsigned int, &EngineTorrentStatus::upload_rate> UploadRateCodec;
+    typedef FlagCodec<&EngineTorrentStatus::is_paused> PausedCodec;
+    typedef FlagCodec<&EngineTorrentStatus::is_complete> CompleteCodec;
+
+    // Scalars print the same in CSV as in JSON.
+#define TORRENT_FIELD(name, Codec) { name, ",\"" name "\":", sizeof(",\"" name "\":") - 1, &Codec::json, &Codec::json, &Codec::binary, &Codec::equal }
+#define TORRENT_STRING_FIELD(name, Codec) { name, ",\"" name "\":", sizeof(",\"" name "\":") - 1, &Codec::json, &Codec::csv, &Codec::binary, &Codec::equal }
+
+    constexpr TorrentFieldDesc kTorrentFields[TorrentField_Count] = {
+        TORRENT_FIELD("id", IdCodec),
+        TORRENT_STRING_FIELD("name", NameCodec),
+        TORRENT_STRING_FIELD("magnet", MagnetCodec),
+        TORRENT_FIELD("progress", ProgressCodec),
+        TORRENT_FIELD("size", SizeCodec),
+        TORRENT_FIELD("downloaded", DownloadedCodec),
+        TORRENT_FIELD("download_rate", DownloadRateCodec),
+        TORRENT_FIELD("upload_rate", UploadRateCodec),
+        TORRENT_FIELD("paused", PausedCodec),
+        TORRENT_FIELD("complete", CompleteCodec),
+    };
+
+#undef TORRENT_FIELD
+#undef TORRENT_STRING_FIELD
+
+    static const char* const kFormatNames[TorrentFormat_Count] = { "json", "ndjson", "csv", "bin" };
+    static const char* const kContentTypes[TorrentFormat_Count] = {
+        "application/json", "application/x-ndjson", "text/csv; charset=utf-8", "application/octet-stream"
+    };
+
+    // Field mask resolved once per build into the ordered list of columns.
+    struct TorrentFieldPlan
+    {
+        const TorrentFieldDesc* fields[TorrentField_Count];
+        unsigned int count;
+    };
+
+    static void compile_field_plan(unsigned int mask, TorrentFieldPlan* plan)
+    {
+        if(mask == 0)
+        {
+            mask = kTorrentFieldsAll;
+        }
+        plan->count = 0;
+        for(unsigned int field = 0; field < TorrentField_Count; ++field)
+        {
+            if(mask & (1u << field))
+            {
+                plan->fields[plan->count++] = &kTorrentFields[field];
+            }
+        }
+    }
+
+    // Every column, unrolled at compile time so each writer call is direct
+    // and can be inlined. This is the common case (UI without projection).
+    template <size_t... I>
+    static void write_json_object_all(std::string& out, const EngineTorrentStatus& status, std::index_sequence<I...>)
+    {
+        out.push_back('{');
+        ((out.append(kTorrentFields[I].json_key + (I == 0 ? 1 : 0), kTorrentFields[I].json_key_len - (I == 0 ? 1 : 0)),
+          kTorrentFields[I].write_json(out, status)), ...);
+        out.push_back('}');
+    }
+
+    static void write_json_object(std::string& out, const EngineTorrentStatus& status, const TorrentFieldPlan& plan, bool all)
+    {
+        if(all)
+        {
+            write_json_object_all(out, status, std::make_index_sequence<TorrentField_Count>());
+            return;
+        }
+
+        out.push_back('{');
+        for(unsigned int f = 0; f < plan.count; ++f)
+        {
+            const TorrentFieldDesc* desc = plan.fields[f];
+            const size_t skip = f == 0 ? 1 : 0;
+            out.append(desc->json_key + skip, desc->json_key_len - skip);
+            desc->write_json(out, status);
+        }
+        out.push_back('}');
+    }
+
+    static void write_csv_header(std::string& out, const TorrentFieldPlan& plan)
+    {
+        for(unsigned int f = 0; f < plan.count; ++f)
+        {
+            if(f != 0)
+            {
+                out.push_back(',');
+            }
+            out.append(plan.fields[f]->name);
+        }
+        out.append("\r\n");
+    }
+
+    static void write_csv_row(std::string& out, const EngineTorrentStatus& status, const TorrentFieldPlan& plan)
+    {
+        for(unsigned int f = 0; f < plan.count; ++f)
+        {
+            if(f != 0)
+            {
+                out.push_back(',');
+            }
+            plan.fields[f]->write_csv(out, status);
+        }
+        out.append("\r\n");
+    }
+
+    static void write_csv(std::string& out, const std::vector<EngineTorrentStatus>& torrents, const TorrentFieldPlan& plan)
+    {
+        write_csv_header(out, plan);
+        for(size_t i = 0; i < torrents.size(); ++i)
+        {
+            write_csv_row(out, torrents[i], plan);
+        }
+    }
+
+    static void write_binary_header(std::string& out, unsigned int mask, size_t row_count)
+    {
+        write_le<uint32_t>(out, kTorrentBinaryMagic);
+        write_le<uint32_t>(out, mask);
+        write_le<uint32_t>(out, static_cast<uint32_t>(row_count));
+    }
+
+    static void write_binary_row(std::string& out, const EngineTorrentStatus& status, const TorrentFieldPlan& plan)
+    {
+        for(unsigned int f = 0; f < plan.count; ++f)
+        {
+            plan.fields[f]->write_binary(out, status);
+        }
+    }
+
+    static void write_binary(std::string& out, const std::vector<EngineTorrentStatus>& torrents, unsigned int mask, const TorrentFieldPlan& plan)
+    {
+        write_binary_header(out, mask, torrents.size());
+        for(size_t i = 0; i < torrents.size(); ++i)
+        {
+            write_binary_row(out, torrents[i], plan);
+        }
+    }
+}
+
+int torrent_schema_find_field(const char* name, size_t len)
+{
+    if(!name)
+    {
+        return -1;
+    }
+    for(unsigned int field = 0; field < TorrentField_Count; ++field)
+    {
+        const char* candidate = kTorrentFields[field].name;
+        if(strlen(candidate) == len && strncmp(candidate, name, len) == 0)
+        {
+            return static_cast<int>(field);
+        }
+    }
+    return -1;
+}
+
+const char* torrent_schema_field_name(unsigned int field)
+{
+    return field < TorrentField_Count ? kTorrentFields[field].name : "";
+}
+
+bool torrent_schema_parse_format(const char* text, TorrentFormat* out_format)
+{
+    if(!text || !out_format)
+    {
+        return false;
+    }
+    for(int format = 0; format < TorrentFormat_Count; ++format)
+    {
+        if(strcmp(text, kFormatNames[format]) == 0)
+        {
+            *out_format = static_cast<TorrentFormat>(format);
+            return true;
+        }
+    }
+    return false;
+}
+
+const char* torrent_schema_content_type(TorrentFormat format)
+{
+    return format < TorrentFormat_Count ? kContentTypes[format] : kContentTypes[TorrentFormat_Json];
+}
+
+void torrent_schema_write_json_array(std::string& out, const std::vector<EngineTorrentStatus>& torrents, unsigned int field_mask)
+{
+    if(field_mask == 0)
+    {
+        field_mask = kTorrentFieldsAll;
+    }
+    TorrentFieldPlan plan;
+    compile_field_plan(field_mask, &plan);
+    const bool all = field_mask == kTorrentFieldsAll;
+
+    out.push_back('[');
+    for(size_t i = 0; i < torrents.size(); ++i)
+    {
+        if(i != 0)
+        {
+            out.push_back(',');
+        }
+        write_json_object(out, torrents[i], plan, all);
+    }
+    out.push_back(']');
+}
+
+void torrent_schema_write_json_object(std::string& out, const EngineTorrentStatus& status, unsigned int field_mask)
+{
+    TorrentFieldPlan plan;
+    compile_field_plan(field_mask, &plan);
+    write_json_object(out, status, plan, plan.count == TorrentField_Count);
+}
+
+unsigned int torrent_schema_diff(const EngineTorrentStatus& a, const EngineTorrentStatus& b)
+{
+    unsigned int changed = 0;
+    for(unsigned int field = 0; field < TorrentField_Count; ++field)
+    {
+        if(!kTorrentFields[field].equal(a, b))
+        {
+            changed |= 1u << field;
+        }
+    }
+    return changed;
+}
+
+void torrent_schema_write_binary_record(std::string& out, const EngineTorrentStatus& status)
+{
+    unsigned int flags = 0;
+    if(status.is_paused)
+    {
+        flags |= kTorrentBinaryPaused;
+    }
+    if(status.is_complete)
+    {
+        flags |= kTorrentBinaryComplete;
+    }
+
+    write_le<uint32_t>(out, status.id);
+    write_le<uint32_t>(out, flags);
+    write_le<float>(out, status.progress);
+    write_le<uint32_t>(out, status.download_rate);
+    write_le<uint32_t>(out, status.upload_rate);
+    write_le<uint32_t>(out, 0);
+    write_le<uint64_t>(out, status.size_bytes);
+    write_le<uint64_t>(out, status.downloaded_bytes);
+}
+
+void torrent_schema_write_binary_strings(std::string& out, const EngineTorrentStatus& status, unsigned int field_mask)
+{
+    write_le<uint32_t>(out, status.id);
+    if(field_mask & (1u << TorrentField_Name))
+    {
+        NameCodec::binary(out, status);
+    }
+    else
+    {
+        write_le<uint16_t>(out, static_cast<uint16_t>(kTorrentBinaryStringAbsent));
+    }
+    if(field_mask & (1u << TorrentField_Magnet))
+    {
+        MagnetCodec::binary(out, status);
+    }
+    else
+    {
+        write_le<uint16_t>(out, static_cast<uint16_t>(kTorrentBinaryStringAbsent));
+    }
+}
+
+void torrent_schema_write_rows(std::string& out, const std::vector<EngineTorrentStatus>& torrents, unsigned int field_mask, TorrentFormat format)
+{
+    if(field_mask == 0)
+    {
+        field_mask = kTorrentFieldsAll;
+    }
+    TorrentFieldPlan plan;
+    compile_field_plan(field_mask, &plan);
+
+    switch(format)
+    {
+        case TorrentFormat_Ndjson:
+        {
+            const bool all = field_mask == kTorrentFieldsAll;
+            for(size_t i = 0; i < torrents.size(); ++i)
+            {
+                write_json_object(out, torrents[i], plan, all);
+                out.push_back('\n');
+            }
+            break;
+        }
+        case TorrentFormat_Csv:
+            write_csv(out, torrents, plan);
+            break;
+        case TorrentFormat_Binary:
+            write_binary(out, torrents, field_mask, plan);
+            break;
+        default:
+            torrent_schema_write_json_array(out, torrents, field_mask);
+            break;
+    }
+}
+
+void torrent_schema_cursor_init(TorrentRowCursor* cursor, unsigned int field_mask, TorrentFormat format)
+{
+    cursor->field_mask = field_mask == 0 ? kTorrentFieldsAll : field_mask;
+    cursor->format = format;
+    cursor->next_row = 0;
+    cursor->rows_written = 0;
+    cursor->started = false;
+}
+
+bool torrent_schema_write_rows_chunk(std::string& out, const std::vector<EngineTorrentStatus>& torrents,
+    TorrentRowCursor* cursor, size_t max_bytes, bool final_batch)
+{
+    TorrentFieldPlan plan;
+    compile_field_plan(cursor->field_mask, &plan);
+    const bool all = cursor->field_mask == kTorrentFieldsAll;
+    const size_t start = out.size();
+
+    if(!cursor->started)
+    {
+        if(cursor->format == TorrentFormat_Csv)
+        {
+            write_csv_header(out, plan);
+        }
+        else if(cursor->format == TorrentFormat_Binary)
+        {
+            write_binary_header(out, cursor->field_mask, torrents.size());
+        }
+        else if(cursor->format != TorrentFormat_Ndjson)
+        {
+            out.push_back('[');
+        }
+        cursor->started = true;
+    }
+
+    for(; cursor->next_row < torrents.size() && out.size() - start < max_bytes; ++cursor->next_row, ++cursor->rows_written)
+    {
+        const EngineTorrentStatus& status = torrents[cursor->next_row];
+        switch(cursor->format)
+        {
+            case TorrentFormat_Ndjson:
+                write_json_object(out, status, plan, all);
+                out.push_back('\n');
+                break;
+            case TorrentFormat_Csv:
+                write_csv_row(out, status, plan);
+                break;
+            case TorrentFormat_Binary:
+                write_binary_row(out, status, plan);
+                break;
+            default:
+                if(cursor->rows_written != 0)
+                {
+                    out.push_back(',');
+                }
+                write_json_object(out, status, plan, all);
+                break;
+        }
+    }
+
+    if(cursor->next_row < torrents.size())
+    {
+        return false;
+    }
+    if(final_batch && cursor->format == TorrentFormat_Json)
+    {
+        out.push_back(']');
+    }
+    return true;
+}
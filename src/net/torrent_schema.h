@@ -0,0 +1,103 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include "engine/engine_session.h"
+
+// Columns of EngineTorrentStatus as seen by clients. The order here is the
+// bit order of field masks and the column order of every output format.
+enum TorrentField
+{
+    TorrentField_Id = 0,
+    TorrentField_Name,
+    TorrentField_Magnet,
+    TorrentField_Progress,
+    TorrentField_Size,
+    TorrentField_Downloaded,
+    TorrentField_DownloadRate,
+    TorrentField_UploadRate,
+    TorrentField_Paused,
+    TorrentField_Complete,
+    TorrentField_Count
+};
+
+const unsigned int kTorrentFieldsAll = (1u << TorrentField_Count) - 1u;
+
+enum TorrentFormat
+{
+    TorrentFormat_Json = 0,
+    TorrentFormat_Ndjson,
+    TorrentFormat_Csv,
+    TorrentFormat_Binary,
+    TorrentFormat_Count
+};
+
+// Binary rows: "RBT1", u32 field mask, u32 row count, then per row the
+// selected fields in bit order, little-endian. id and rates are u32, sizes
+// u64, progress f32, flags u8, strings u16 length + UTF-8 bytes.
+const unsigned int kTorrentBinaryMagic = 0x31544252u;
+
+const unsigned int kTorrentStringFields = (1u << TorrentField_Name) | (1u << TorrentField_Magnet);
+
+// Fixed-width row of binary WebSocket frames, little-endian, 40 bytes: u32 id,
+// u32 flags (bit 0 paused, bit 1 complete), f32 progress, u32 download_rate,
+// u32 upload_rate, u32 reserved, u64 size, u64 downloaded.
+const unsigned int kTorrentBinaryRecordSize = 40;
+const unsigned int kTorrentBinaryPaused = 1u << 0;
+const unsigned int kTorrentBinaryComplete = 1u << 1;
+
+// Strings travel separately from records, as u32 id then name and magnet each
+// as u16 length + UTF-8 bytes. A column outside the mask is sent as length
+// 0xFFFF with no bytes.
+const unsigned int kTorrentBinaryStringAbsent = 0xFFFFu;
+
+int torrent_schema_find_field(const char* name, size_t len);
+const char* torrent_schema_field_name(unsigned int field);
+bool torrent_schema_parse_format(const char* text, TorrentFormat* out_format);
+const char* torrent_schema_content_type(TorrentFormat format);
+
+// JSON array of row objects, e.g. `[{"id":1,...},...]`. A zero mask means
+// every field.
+void torrent_schema_write_json_array(std::string& out, const std::vector<EngineTorrentStatus>& torrents, unsigned int field_mask);
+
+// One row object with exactly the fields in `field_mask`.
+void torrent_schema_write_json_object(std::string& out, const EngineTorrentStatus& status, unsigned int field_mask);
+
+// Mask of the fields whose values differ between two rows.
+unsigned int torrent_schema_diff(const EngineTorrentStatus& a, const EngineTorrentStatus& b);
+
+// Standalone row export in any format: NDJSON (one object per line), CSV
+// (header line plus rows) or the binary layout above. JSON is the bare array.
+void torrent_schema_write_rows(std::string& out, const std::vector<EngineTorrentStatus>& torrents, unsigned int field_mask, TorrentFormat format);
+
+// Resumable form of torrent_schema_write_rows() for streamed responses: the
+// chunks it writes, concatenated, are the same bytes.
+struct TorrentRowCursor
+{
+    unsigned int field_mask;
+    TorrentFormat format;
+    // Next row of the current batch.
+    size_t next_row;
+    // Rows written across all batches.
+    size_t rows_written;
+    // Set once the format's header (JSON '[', CSV column line, binary
+    // preamble) has been written.
+    bool started;
+};
+
+void torrent_schema_cursor_init(TorrentRowCursor* cursor, unsigned int field_mask, TorrentFormat format);
+
+// Appends whole rows from the cursor on until `out` has grown by at least
+// `max_bytes` or the rows run out. Returns true once the batch is used up,
+// after writing any closing bracket if `final_batch`. Otherwise the caller
+// resets `next_row` to 0 and passes the next batch. The binary preamble
+// counts only the first batch's rows, so binary output must come as one.
+bool torrent_schema_write_rows_chunk(std::string& out, const std::vector<EngineTorrentStatus>& torrents,
+    TorrentRowCursor* cursor, size_t max_bytes, bool final_batch);
+
+void torrent_schema_write_binary_record(std::string& out, const EngineTorrentStatus& status);
+void torrent_schema_write_binary_strings(std::string& out, const EngineTorrentStatus& status, unsigned int field_mask);
@@ -1,5 +1,7 @@
 #include <windows.h>
 #include <CommCtrl.h>
+#include <shellapi.h>
+#include <wchar.h>
 
 #include "app/app.h"
 #include "config.h"
@@ -7,6 +9,26 @@
 
 #pragma comment(linker,"/manifestdependency:\"type='win32' name='Microsoft.Windows.Common-Controls' version='6.0.0.0' processorArchitecture='*' publicKeyToken='6595b64144ccf1df' language='*'\"")
 
+// `--local-socket <path>` turns on the local automation socket.
+static void read_command_line(RawBitAppConfig* config)
+{
+    int count = 0;
+    LPWSTR* args = CommandLineToArgvW(GetCommandLineW(), &count);
+    if(!args)
+    {
+        return;
+    }
+    for(int i = 1; i + 1 < count; ++i)
+    {
+        if(wcscmp(args[i], L"--local-socket") == 0)
+        {
+            wcsncpy_s(config->http_local_socket, MAX_PATH, args[i + 1], _TRUNCATE);
+            ++i;
+        }
+    }
+    LocalFree(args);
+}
+
 int APIENTRY wWinMain(HINSTANCE instance, HINSTANCE, PWSTR, int)
 {
     InitializeDebugOutput();
@@ -25,6 +47,9 @@ int APIENTRY wWinMain(HINSTANCE instance, HINSTANCE, PWSTR, int)
     RawBitAppConfig config;
     config.http_port = 32145;
     config.engine_tick_ms = 500;
+    config.http_loops = 1;
+    config.http_local_socket[0] = L'\0';
+    read_command_line(&config);
 
     int init_result = rawbit_app_init(&app, &config, instance);
     if(init_result != 0)
@@ -0,0 +1,268 @@
+// deflate_test: round trips and hostile input for src/net/deflate.cpp.
+// Standalone; build and run from the repository root with e.g.
+// `cl /EHsc /Isrc tests\deflate_test.cpp src\net\deflate.cpp && deflate_test`.
+// Exits non-zero and names each failed check.
+
+#include <windows.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+
+#include "net/deflate.h"
+#include "net/http_server.h"
+
+namespace
+{
+    int g_failures = 0;
+
+    static void check(bool condition, const char* what)
+    {
+        if(!condition)
+        {
+            fprintf(stderr, "deflate_test: FAILED %s\n", what);
+            ++g_failures;
+        }
+    }
+
+    static std::string random_bytes(size_t size, unsigned int seed, unsigned int alphabet)
+    {
+        std::string out(size, '\0');
+        for(size_t i = 0; i < size; ++i)
+        {
+            seed = seed * 1103515245u + 12345u;
+            out[i] = static_cast<char>((seed >> 16) % alphabet);
+        }
+        return out;
+    }
+
+    // Hand-built streams: LSB-first bits, with Huffman codes written MSB-first
+    // as RFC 1951 requires.
+    struct TestBits
+    {
+        std::string out;
+        unsigned int bits;
+        unsigned int count;
+    };
+
+    static void put(TestBits& writer, unsigned int value, unsigned int count)
+    {
+        for(unsigned int i = 0; i < count; ++i)
+        {
+            writer.bits |= ((value >> i) & 1u) << writer.count;
+            if(++writer.count == 8)
+            {
+                writer.out.push_back(static_cast<char>(writer.bits));
+                writer.bits = 0;
+                writer.count = 0;
+            }
+        }
+    }
+
+    static void put_code(TestBits& writer, unsigned int code, unsigned int length)
+    {
+        for(unsigned int i = length; i-- > 0;)
+        {
+            put(writer, (code >> i) & 1u, 1);
+        }
+    }
+
+    static std::string finish(TestBits& writer)
+    {
+        if(writer.count != 0)
+        {
+            writer.out.push_back(static_cast<char>(writer.bits));
+        }
+        return writer.out;
+    }
+
+    // Fixed-Huffman literal/length codes (RFC 1951 3.2.6).
+    static void put_fixed_symbol(TestBits& writer, unsigned int symbol)
+    {
+        if(symbol < 144)
+        {
+            put_code(writer, 0x30 + symbol, 8);
+        }
+        else if(symbol < 256)
+        {
+            put_code(writer, 0x190 + symbol - 144, 9);
+        }
+        else if(symbol < 280)
+        {
+            put_code(writer, symbol - 256, 7);
+        }
+        else
+        {
+            put_code(writer, 0xC0 + symbol - 280, 8);
+        }
+    }
+
+    // One final fixed block: `literals`, then a length-3 match at
+    // `distance_symbol` (extra bits zero), then end of block.
+    static std::string fixed_match_stream(const char* literals, unsigned int distance_symbol)
+    {
+        TestBits writer = {};
+        put(writer, 1, 1);
+        put(writer, 1, 2);
+        for(const char* c = literals; *c; ++c)
+        {
+            put_fixed_symbol(writer, static_cast<unsigned char>(*c));
+        }
+        put_fixed_symbol(writer, 257);
+        put_code(writer, distance_symbol, 5);
+        put(writer, 0, 13);
+        put_fixed_symbol(writer, 256);
+        return finish(writer);
+    }
+
+    static bool inflate(const std::string& stream, size_t max_out, std::string& out)
+    {
+        out.clear();
+        return deflate_inflate_raw(stream.data(), stream.size(), max_out, out);
+    }
+
+    static void test_round_trips()
+    {
+        const size_t sizes[] = { 0, 1, 3, 4, 5, 100, 4096, 40000, 70000, 300000 };
+        const unsigned int alphabets[] = { 1, 4, 256 };
+        for(size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); ++s)
+        {
+            for(size_t a = 0; a < sizeof(alphabets) / sizeof(alphabets[0]); ++a)
+            {
+                const std::string data = random_bytes(sizes[s], static_cast<unsigned int>(s * 7 + a), alphabets[a]);
+                std::string stream;
+                std::string out;
+                deflate_raw(data.data(), data.size(), DeflateFlush_Finish, stream);
+                check(inflate(stream, data.size(), out) && out == data, "round trip (finish)");
+
+                stream.clear();
+                deflate_raw(data.data(), data.size(), DeflateFlush_Sync, stream);
+                check(stream.size() >= 4 && memcmp(stream.data() + stream.size() - 4, "\x00\x00\xFF\xFF", 4) == 0,
+                    "sync flush ends in 00 00 FF FF");
+                check(inflate(stream, data.size(), out) && out == data, "round trip (sync)");
+            }
+        }
+
+        // The match table is reused between calls; a stale entry from a
+        // previous input must never be taken for a match in the next one.
+        const std::string first = random_bytes(50000, 11, 3);
+        const std::string second = random_bytes(20000, 12, 3);
+        std::string stream;
+        std::string out;
+        deflate_raw(first.data(), first.size(), DeflateFlush_Finish, stream);
+        stream.clear();
+        deflate_raw(second.data(), second.size(), DeflateFlush_Finish, stream);
+        check(inflate(stream, second.size(), out) && out == second, "round trip after a larger input");
+
+        // Two sync-flushed messages back to back inflate as one stream.
+        stream.clear();
+        deflate_raw(first.data(), 1000, DeflateFlush_Sync, stream);
+        deflate_raw(second.data(), 1000, DeflateFlush_Sync, stream);
+        check(inflate(stream, 2000, out) && out == first.substr(0, 1000) + second.substr(0, 1000), "concatenated sync blocks");
+    }
+
+    static void test_gzip()
+    {
+        check(deflate_crc32("123456789", 9) == 0xCBF43926u, "crc32 check value");
+
+        const std::string data = random_bytes(5000, 3, 16);
+        std::string member;
+        deflate_gzip(data.data(), data.size(), member);
+        check(member.size() > 18 && static_cast<unsigned char>(member[0]) == 0x1F && static_cast<unsigned char>(member[1]) == 0x8B,
+            "gzip magic");
+        std::string out;
+        const std::string body = member.substr(10, member.size() - 18);
+        check(inflate(body, data.size(), out) && out == data, "gzip body inflates");
+    }
+
+    // A cut stream must fail or, if it stops on a block boundary, yield a
+    // strict prefix; it must never read past its end.
+    static void test_truncated()
+    {
+        const std::string data = random_bytes(3000, 5, 8);
+        std::string stream;
+        deflate_raw(data.data(), data.size(), DeflateFlush_Finish, stream);
+        bool prefixes_only = true;
+        for(size_t cut = 0; cut < stream.size(); ++cut)
+        {
+            std::string out;
+            const std::string part = stream.substr(0, cut);
+            if(inflate(part, data.size(), out) && (out.size() >= data.size() || data.compare(0, out.size(), out) != 0))
+            {
+                prefixes_only = false;
+            }
+        }
+        check(prefixes_only, "truncated streams fail or yield a prefix");
+
+        std::string out;
+        check(!inflate(std::string("\x01\x05\x00", 3), 16, out), "stored header cut short");
+        check(!inflate(std::string("\x01\x05\x00\xFA\xFF" "ab", 7), 16, out), "stored payload cut short");
+    }
+
+    static void test_oversized()
+    {
+        const std::string data = random_bytes(4096, 9, 256);
+        std::string stream;
+        deflate_raw(data.data(), data.size(), DeflateFlush_Finish, stream);
+        std::string out;
+        check(inflate(stream, data.size(), out), "exact limit accepted");
+        check(!inflate(stream, data.size() - 1, out), "one byte over the limit refused");
+        check(out.size() <= data.size() - 1, "refused output stays within the limit");
+
+        // Stored block larger than the limit.
+        std::string stored("\x01\x08\x00\xF7\xFF" "12345678", 13);
+        check(inflate(stored, 8, out) && out == "12345678", "stored block within the limit");
+        check(!inflate(stored, 7, out), "stored block over the limit refused");
+        stored[3] = 0;
+        check(!inflate(stored, 8, out), "stored block with bad NLEN refused");
+    }
+
+    static void test_bad_distances()
+    {
+        std::string out;
+        check(inflate(fixed_match_stream("ab", 1), 16, out) && out == "ababa", "match within output");
+        check(!inflate(fixed_match_stream("", 0), 16, out), "match before any output refused");
+        check(!inflate(fixed_match_stream("a", 1), 16, out), "distance past start refused");
+        check(!inflate(fixed_match_stream("abcd", 30), 16, out), "distance symbol 30 refused");
+        check(!inflate(fixed_match_stream("abcd", 31), 16, out), "distance symbol 31 refused");
+
+        // Reserved block type 3.
+        check(!inflate(std::string("\x07", 1), 16, out), "reserved block type refused");
+    }
+
+    // The WebSocket cap: a small message that inflates past
+    // kHttpWsMaxInflatedBytes is refused without producing more than that.
+    static void test_ws_cap()
+    {
+        const std::string at_cap(kHttpWsMaxInflatedBytes, 'x');
+        const std::string bomb(kHttpWsMaxInflatedBytes * 16, 'x');
+        std::string stream;
+        std::string out;
+        deflate_raw(at_cap.data(), at_cap.size(), DeflateFlush_Sync, stream);
+        check(inflate(stream, kHttpWsMaxInflatedBytes, out) && out == at_cap, "message at the cap accepted");
+
+        stream.clear();
+        deflate_raw(bomb.data(), bomb.size(), DeflateFlush_Sync, stream);
+        check(stream.size() < kHttpWsMaxInflatedBytes / 8, "bomb compresses well");
+        check(!inflate(stream, kHttpWsMaxInflatedBytes, out), "bomb refused");
+        check(out.size() <= kHttpWsMaxInflatedBytes, "bomb output stays within the cap");
+    }
+}
+
+int main()
+{
+    test_round_trips();
+    test_gzip();
+    test_truncated();
+    test_oversized();
+    test_bad_distances();
+    test_ws_cap();
+
+    if(g_failures != 0)
+    {
+        fprintf(stderr, "deflate_test: %d check(s) failed\n", g_failures);
+        return 1;
+    }
+    printf("deflate_test: ok\n");
+    return 0;
+}
@@ -0,0 +1,304 @@
+// engine_search_test: the trigram name index in src/engine/engine_name_index
+// against a brute-force reference, ranking and edge cases of
+// engine_session_search, and a timing run over a large index.
+// Standalone; build and run from the repository root with e.g.
+// `cl /EHsc /std:c++17 /Isrc tests\engine_search_test.cpp src\debug.cpp src\engine\*.cpp
+//   advapi32.lib && engine_search_test`.
+// Exits non-zero and names each failed check.
+
+#include <windows.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "engine/engine_name_index.h"
+#include "engine/engine_session.h"
+
+namespace
+{
+    const unsigned int kReferenceNames = 2000;
+    const unsigned int kTimingNames = 250000;
+    const unsigned int kTimingQueries = 200;
+
+    int g_failures = 0;
+
+    static void check(bool condition, const char* what)
+    {
+        if(!condition)
+        {
+            fprintf(stderr, "engine_search_test: FAILED %s\n", what);
+            ++g_failures;
+        }
+    }
+
+    static unsigned int next_random(unsigned int* state)
+    {
+        *state = *state * 1103515245u + 12345u;
+        return *state >> 8;
+    }
+
+    // A small mixed-case alphabet, so random names share many trigrams.
+    static std::string random_name(unsigned int* state, size_t min_len, size_t max_len)
+    {
+        static const char kAlphabet[] = "abcdeABCDE .-";
+        const size_t len = min_len + next_random(state) % (max_len - min_len + 1);
+        std::string name(len, ' ');
+        for(size_t i = 0; i < len; ++i)
+        {
+            name[i] = kAlphabet[next_random(state) % (sizeof(kAlphabet) - 1)];
+        }
+        return name;
+    }
+
+    static std::vector<std::string> folded_trigrams(const std::string& text)
+    {
+        std::vector<std::string> out;
+        for(size_t i = 0; i + 3 <= text.size(); ++i)
+        {
+            std::string trigram = text.substr(i, 3);
+            for(size_t j = 0; j < 3; ++j)
+            {
+                trigram[j] = engine_name_fold(trigram[j]);
+            }
+            out.push_back(trigram);
+        }
+        std::sort(out.begin(), out.end());
+        out.erase(std::unique(out.begin(), out.end()), out.end());
+        return out;
+    }
+
+    // What engine_name_index_query must return, computed name by name.
+    static void reference_query(const std::vector<std::string>& names, const std::vector<bool>& live, const std::string& query,
+        unsigned int percent, std::vector<EngineNameMatch>& out)
+    {
+        out.clear();
+        const std::vector<std::string> wanted = folded_trigrams(query);
+        const unsigned int total = static_cast<unsigned int>(wanted.size());
+        unsigned int min_matched = (total * percent + 99) / 100;
+        if(min_matched == 0)
+        {
+            min_matched = 1;
+        }
+        for(size_t i = 0; i < names.size(); ++i)
+        {
+            if(!live[i])
+            {
+                continue;
+            }
+            const std::vector<std::string> have = folded_trigrams(names[i]);
+            unsigned int matched = 0;
+            for(size_t t = 0; t < wanted.size(); ++t)
+            {
+                matched += std::binary_search(have.begin(), have.end(), wanted[t]) ? 1 : 0;
+            }
+            if(total != 0 && matched >= min_matched)
+            {
+                EngineNameMatch match;
+                match.id = static_cast<unsigned int>(i + 1);
+                match.matched_trigrams = matched;
+                out.push_back(match);
+            }
+        }
+    }
+
+    static bool same_matches(const std::vector<EngineNameMatch>& a, const std::vector<EngineNameMatch>& b)
+    {
+        if(a.size() != b.size())
+        {
+            return false;
+        }
+        for(size_t i = 0; i < a.size(); ++i)
+        {
+            if(a[i].id != b[i].id || a[i].matched_trigrams != b[i].matched_trigrams)
+            {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static void test_index_against_reference()
+    {
+        EngineNameIndex index;
+        std::vector<std::string> names;
+        std::vector<bool> live;
+        unsigned int state = 17;
+        for(unsigned int i = 0; i < kReferenceNames; ++i)
+        {
+            names.push_back(random_name(&state, 0, 24));
+            live.push_back(true);
+            engine_name_index_add(&index, i + 1, names.back().c_str());
+        }
+
+        bool agree = true;
+        std::vector<EngineNameMatch> expected;
+        std::vector<EngineNameMatch> actual;
+        for(int round = 0; round < 2; ++round)
+        {
+            for(unsigned int q = 0; q < 200; ++q)
+            {
+                const std::string query = random_name(&state, 0, 10);
+                const unsigned int percent = q % 3 == 0 ? 100 : 50;
+                reference_query(names, live, query, percent, expected);
+                const unsigned int total = engine_name_index_query(&index, query.c_str(), percent, actual);
+                agree = agree && total == folded_trigrams(query).size() && same_matches(expected, actual);
+            }
+            // Second round runs after removing a third of the names.
+            for(unsigned int i = 0; i < kReferenceNames; i += 3)
+            {
+                engine_name_index_remove(&index, i + 1, names[i].c_str());
+                live[i] = false;
+            }
+        }
+        check(agree, "index query matches brute force");
+
+        std::vector<EngineNameMatch> matches;
+        check(engine_name_index_query(&index, "ab", 50, matches) == 0 && matches.empty(), "short query has no trigrams");
+    }
+
+    static unsigned int add_torrent(EngineSession* session, const char* name, unsigned long long size_bytes)
+    {
+        EngineAddTorrentOptions options;
+        ZeroMemory(&options, sizeof(options));
+        options.magnet_uri = "magnet:?xt=urn:btih:0000000000000000000000000000000000000000";
+        options.display_name = name;
+        options.size_bytes = size_bytes;
+        unsigned int id = 0;
+        engine_session_add_torrent(session, &options, &id);
+        return id;
+    }
+
+    static unsigned int search(EngineSession* session, const char* query, EngineSearchHit* hits, unsigned int max_hits)
+    {
+        unsigned int total = 0;
+        const unsigned int count = engine_session_search(session, query, hits, max_hits, &total);
+        return count == total ? count : 0xFFFFFFFFu;
+    }
+
+    static void test_session_search()
+    {
+        EngineSessionConfig config;
+        engine_session_config_default(&config);
+        config.alert_interval_ms = 250;
+        config.cold_after_ms = 1;
+        config.stats_shm_capacity = 0;
+        EngineSession session;
+        if(engine_session_init(&session, &config) != 0)
+        {
+            check(false, "session starts");
+            return;
+        }
+
+        const unsigned int kubuntu = add_torrent(&session, "Kubuntu 24.04", 1ull << 40);
+        const unsigned int desktop = add_torrent(&session, "Ubuntu 24.04 Desktop", 1ull << 40);
+        const unsigned int server = add_torrent(&session, "ubuntu-server", 1ull << 40);
+        const unsigned int fuzzy = add_torrent(&session, "Ubuntoo", 1ull << 40);
+        const unsigned int debian = add_torrent(&session, "Debian netinst", 1ull << 40);
+        const unsigned int removed = add_torrent(&session, "Ubuntu removed", 1ull << 40);
+        const unsigned int cold = add_torrent(&session, "Archived Ubuntu ISO", 1);
+        engine_session_remove_torrent(&session, removed);
+
+        // Let the small torrent finish, pause it and wait for it to go cold.
+        Sleep(600);
+        engine_session_pause_torrent(&session, cold);
+        EngineSessionSnapshot snapshot;
+        const ULONGLONG deadline = GetTickCount64() + 5000;
+        do
+        {
+            Sleep(50);
+            engine_session_snapshot(&session, &snapshot);
+        } while(snapshot.stats.cold_count == 0 && GetTickCount64() < deadline);
+        check(snapshot.stats.cold_count == 1, "archived torrent is cold");
+
+        // Prefix hits, then substring hits (ID order breaks ties), then the
+        // fuzzy one; the removed torrent and Debian never appear.
+        EngineSearchHit hits[16];
+        const unsigned int count = search(&session, "UBUNTU", hits, 16);
+        const unsigned int expected[] = { desktop, server, kubuntu, cold, fuzzy };
+        bool ranked = count == sizeof(expected) / sizeof(expected[0]);
+        for(unsigned int i = 0; ranked && i < count; ++i)
+        {
+            ranked = hits[i].id == expected[i];
+        }
+        check(ranked, "ranking is prefix, substring, then fuzzy");
+        check(count >= 5 && hits[0].score == hits[1].score && hits[1].score > hits[2].score && hits[3].score > hits[4].score,
+            "scores follow the ranking");
+
+        check(search(&session, "ubuntu", hits, 2) == 0xFFFFFFFFu, "total counts past max_hits");
+        unsigned int total = 0;
+        check(engine_session_search(&session, "ubuntu", hits, 2, &total) == 2 && total == 5, "max_hits caps the hits");
+
+        // Two bytes carry no trigram and fall back to a substring scan.
+        check(search(&session, "de", hits, 16) == 2 && hits[0].id == debian && hits[1].id == desktop, "short query scans substrings");
+        check(search(&session, "iso", hits, 16) == 1 && hits[0].id == cold, "cold torrent found by trigram");
+        check(search(&session, "removed", hits, 16) == 0, "removed torrent not found");
+        check(search(&session, "", hits, 16) == 0, "empty query finds nothing");
+
+        std::string longest(kEngineSearchMaxQuery, 'u');
+        check(search(&session, longest.c_str(), hits, 16) == 0, "longest query is searched");
+        longest.push_back('u');
+        check(engine_session_search(&session, longest.c_str(), hits, 16, &total) == 0 && total == 0, "over-long query refused");
+
+        engine_session_shutdown(&session);
+    }
+
+    static void test_timing()
+    {
+        EngineNameIndex index;
+        // Each name carries a random eight-letter word, kept in `words`.
+        std::vector<std::string> words;
+        words.reserve(kTimingNames);
+        unsigned int state = 5;
+        for(unsigned int i = 0; i < kTimingNames; ++i)
+        {
+            char word[9];
+            for(size_t c = 0; c < 8; ++c)
+            {
+                word[c] = static_cast<char>('a' + next_random(&state) % 26);
+            }
+            word[8] = '\0';
+            char name[96];
+            _snprintf_s(name, sizeof(name), _TRUNCATE, "Distro %s %u.%u x86_64 %s", word, next_random(&state) % 40,
+                next_random(&state) % 12, (i % 3) ? "desktop" : "server");
+            words.push_back(word);
+            engine_name_index_add(&index, i + 1, name);
+        }
+
+        LARGE_INTEGER frequency;
+        LARGE_INTEGER start;
+        LARGE_INTEGER stop;
+        QueryPerformanceFrequency(&frequency);
+        std::vector<EngineNameMatch> matches;
+        size_t found = 0;
+        QueryPerformanceCounter(&start);
+        for(unsigned int q = 0; q < kTimingQueries; ++q)
+        {
+            // Selective queries: the random word of one name.
+            engine_name_index_query(&index, words[next_random(&state) % kTimingNames].c_str(), 50, matches);
+            found += matches.empty() ? 0 : 1;
+        }
+        QueryPerformanceCounter(&stop);
+
+        check(found == kTimingQueries, "timing queries find their names");
+        const double seconds = static_cast<double>(stop.QuadPart - start.QuadPart) / static_cast<double>(frequency.QuadPart);
+        printf("engine_search_test: %u names, %.3f ms per selective query\n", kTimingNames, seconds * 1e3 / kTimingQueries);
+    }
+}
+
+int main()
+{
+    test_index_against_reference();
+    test_session_search();
+    test_timing();
+
+    if(g_failures != 0)
+    {
+        fprintf(stderr, "engine_search_test: %d check(s) failed\n", g_failures);
+        return 1;
+    }
+    printf("engine_search_test: ok\n");
+    return 0;
+}
@@ -0,0 +1,284 @@
+// engine_session_test: tiering, paging and stats checks for src/engine. Runs a real
+// session, so the tier checks wait on engine ticks (a few seconds in all).
+// Standalone; build and run from the repository root with e.g.
+// `cl /EHsc /std:c++17 /Isrc tests\engine_session_test.cpp src\debug.cpp src\engine\*.cpp
+//   advapi32.lib && engine_session_test`.
+// Exits non-zero and names each failed check.
+
+#include <windows.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "engine/engine_session.h"
+
+namespace
+{
+    // Longest a check waits for the engine to tick a torrent into place.
+    const ULONGLONG kTickWaitMs = 5000;
+
+    int g_failures = 0;
+
+    static void check(bool condition, const char* what)
+    {
+        if(!condition)
+        {
+            fprintf(stderr, "engine_session_test: FAILED %s\n", what);
+            ++g_failures;
+        }
+    }
+
+    static bool start_session(EngineSession* session, unsigned int cold_after_ms)
+    {
+        EngineSessionConfig config;
+        engine_session_config_default(&config);
+        config.alert_interval_ms = 250;
+        config.cold_after_ms = cold_after_ms;
+        config.stats_shm_capacity = 0;
+        return engine_session_init(session, &config) == 0;
+    }
+
+    static unsigned int add_torrent(EngineSession* session, const char* name, unsigned long long size_bytes)
+    {
+        EngineAddTorrentOptions options;
+        ZeroMemory(&options, sizeof(options));
+        options.magnet_uri = "magnet:?xt=urn:btih:0000000000000000000000000000000000000000";
+        options.display_name = name;
+        options.size_bytes = size_bytes;
+        unsigned int id = 0;
+        engine_session_add_torrent(session, &options, &id);
+        return id;
+    }
+
+    static bool find_status(EngineSession* session, unsigned int id, EngineSessionSnapshot* snapshot, EngineTorrentStatus* status)
+    {
+        engine_session_snapshot(session, snapshot);
+        for(size_t i = 0; i < snapshot->torrents.size(); ++i)
+        {
+            if(snapshot->torrents[i].id == id)
+            {
+                *status = snapshot->torrents[i];
+                return true;
+            }
+        }
+        return false;
+    }
+
+    static bool wait_for_cold_count(EngineSession* session, unsigned int cold_count)
+    {
+        const ULONGLONG deadline = GetTickCount64() + kTickWaitMs;
+        EngineSessionSnapshot snapshot;
+        do
+        {
+            engine_session_snapshot(session, &snapshot);
+            if(snapshot.stats.cold_count == cold_count)
+            {
+                return true;
+            }
+            Sleep(50);
+        } while(GetTickCount64() < deadline);
+        return false;
+    }
+
+    // A complete torrent is paused, goes cold, and a resume brings it back
+    // to the hot tier seeding; pausing it again sends it back.
+    static void test_cold_round_trip()
+    {
+        EngineSession session;
+        if(!start_session(&session, 1))
+        {
+            check(false, "session starts");
+            return;
+        }
+
+        const unsigned int id = add_torrent(&session, "cold round trip", 1);
+        EngineSessionSnapshot snapshot;
+        EngineTorrentStatus status;
+        const ULONGLONG deadline = GetTickCount64() + kTickWaitMs;
+        while(!(find_status(&session, id, &snapshot, &status) && status.is_complete) && GetTickCount64() < deadline)
+        {
+            Sleep(50);
+        }
+        check(status.is_complete != 0, "small torrent completes");
+
+        check(engine_session_pause_torrent(&session, id) == 0, "pause complete torrent");
+        check(wait_for_cold_count(&session, 1), "paused complete torrent goes cold");
+
+        unsigned long long version = engine_session_version(&session);
+        check(engine_session_pause_torrent(&session, id) == 0, "pause cold torrent");
+        engine_session_snapshot(&session, &snapshot);
+        check(snapshot.stats.cold_count == 1 && engine_session_version(&session) == version, "pausing a paused cold torrent is a no-op");
+
+        check(engine_session_resume_torrent(&session, id) == 0, "resume cold torrent");
+        check(find_status(&session, id, &snapshot, &status), "resumed torrent listed");
+        check(snapshot.stats.cold_count == 0 && snapshot.stats.hot_count == 1, "resumed torrent is hot");
+        check(!status.is_paused && status.is_complete, "resumed torrent is running and complete");
+        check(engine_session_version(&session) > version, "resume bumps the version");
+
+        Sleep(600);
+        check(find_status(&session, id, &snapshot, &status) && status.upload_rate > 0 && status.download_rate == 0,
+            "resumed complete torrent seeds");
+        check(snapshot.stats.cold_count == 0, "seeding torrent stays hot");
+
+        version = engine_session_version(&session);
+        check(engine_session_resume_torrent(&session, id) == 0 && engine_session_version(&session) == version,
+            "resuming a running torrent is a no-op");
+
+        check(engine_session_pause_torrent(&session, id) == 0, "pause seeding torrent");
+        check(wait_for_cold_count(&session, 1), "paused again goes cold again");
+
+        engine_session_shutdown(&session);
+    }
+
+    // Walking ID order by `after_id` visits the same rows as one full page,
+    // across both tiers and around removed torrents.
+    static void test_keyset_pages()
+    {
+        EngineSession session;
+        if(!start_session(&session, 1))
+        {
+            check(false, "session starts");
+            return;
+        }
+
+        const unsigned int kTorrents = 40;
+        unsigned int ids[kTorrents];
+        for(unsigned int i = 0; i < kTorrents; ++i)
+        {
+            char name[32];
+            _snprintf_s(name, sizeof(name), _TRUNCATE, "keyset %u", i);
+            // Every third torrent is too large to finish and stays hot.
+            ids[i] = add_torrent(&session, name, i % 3 == 0 ? (1ull << 40) : 1);
+        }
+        Sleep(600);
+        unsigned int expected_cold = 0;
+        for(unsigned int i = 0; i < kTorrents; i += 2)
+        {
+            engine_session_pause_torrent(&session, ids[i]);
+            expected_cold += i % 3 != 0 ? 1 : 0;
+        }
+        check(wait_for_cold_count(&session, expected_cold), "paused complete torrents go cold");
+        engine_session_remove_torrent(&session, ids[4]);
+        engine_session_remove_torrent(&session, ids[9]);
+
+        EngineTorrentQuery query;
+        ZeroMemory(&query, sizeof(query));
+        query.sort_key = EngineSortKey_Id;
+        EngineSessionSnapshot full;
+        unsigned int total = 0;
+        engine_session_snapshot_page(&session, &query, &full, &total);
+        check(total == kTorrents - 2 && full.torrents.size() == total, "full page lists every torrent");
+
+        query.limit = 7;
+        EngineSessionSnapshot page;
+        size_t walked = 0;
+        bool same_order = true;
+        for(;;)
+        {
+            engine_session_snapshot_page(&session, &query, &page, nullptr);
+            for(size_t i = 0; i < page.torrents.size(); ++i, ++walked)
+            {
+                same_order = same_order && walked < full.torrents.size() && page.torrents[i].id == full.torrents[walked].id;
+            }
+            if(page.torrents.size() < query.limit)
+            {
+                break;
+            }
+            query.after_id = page.torrents.back().id;
+        }
+        check(same_order && walked == full.torrents.size(), "keyset pages match the full page");
+
+        query.after_id = 0xFFFFFFFFu;
+        engine_session_snapshot_page(&session, &query, &page, nullptr);
+        check(page.torrents.empty(), "cursor past the last ID yields nothing");
+
+        engine_session_shutdown(&session);
+    }
+
+    // The running totals that stats are read from must match what the rows
+    // add up to, through adds, ticks, pauses, resumes, removals and both
+    // directions of tiering.
+    static bool totals_match_rows(EngineSession* session)
+    {
+        EngineSessionSnapshot snapshot;
+        engine_session_snapshot(session, &snapshot);
+        unsigned int active = 0;
+        unsigned long long download_rate = 0;
+        unsigned long long upload_rate = 0;
+        for(size_t i = 0; i < snapshot.torrents.size(); ++i)
+        {
+            const EngineTorrentStatus& status = snapshot.torrents[i];
+            active += !status.is_complete && !status.is_paused ? 1 : 0;
+            download_rate += status.download_rate;
+            upload_rate += status.upload_rate;
+        }
+
+        EngineTorrentQuery query;
+        ZeroMemory(&query, sizeof(query));
+        query.sort_key = EngineSortKey_Size;
+        query.limit = 5;
+        EngineSessionSnapshot page;
+        engine_session_snapshot_page(session, &query, &page, nullptr);
+        const bool page_agrees = page.version != snapshot.version ||
+            memcmp(&page.stats, &snapshot.stats, sizeof(page.stats)) == 0;
+
+        return snapshot.stats.torrent_count == snapshot.torrents.size() &&
+            snapshot.stats.hot_count + snapshot.stats.cold_count == snapshot.stats.torrent_count &&
+            snapshot.stats.active_count == active && snapshot.stats.download_rate == download_rate &&
+            snapshot.stats.upload_rate == upload_rate && page_agrees;
+    }
+
+    static void test_running_totals()
+    {
+        EngineSession session;
+        if(!start_session(&session, 1))
+        {
+            check(false, "session starts");
+            return;
+        }
+
+        const unsigned int kTorrents = 30;
+        unsigned int ids[kTorrents];
+        for(unsigned int i = 0; i < kTorrents; ++i)
+        {
+            ids[i] = add_torrent(&session, "totals", i % 2 == 0 ? 1 : (1ull << 40));
+        }
+        check(totals_match_rows(&session), "totals after adds");
+        Sleep(600);
+        check(totals_match_rows(&session), "totals after ticks");
+
+        for(unsigned int i = 0; i < kTorrents; i += 3)
+        {
+            engine_session_pause_torrent(&session, ids[i]);
+        }
+        check(totals_match_rows(&session), "totals after pauses");
+        Sleep(600);
+        check(totals_match_rows(&session), "totals after archiving");
+
+        for(unsigned int i = 0; i < kTorrents; i += 6)
+        {
+            engine_session_resume_torrent(&session, ids[i]);
+        }
+        engine_session_remove_torrent(&session, ids[1]);
+        engine_session_remove_torrent(&session, ids[3]);
+        check(totals_match_rows(&session), "totals after resumes and removals");
+        Sleep(600);
+        check(totals_match_rows(&session), "totals after more ticks");
+
+        engine_session_shutdown(&session);
+    }
+}
+
+int main()
+{
+    test_cold_round_trip();
+    test_keyset_pages();
+    test_running_totals();
+
+    if(g_failures != 0)
+    {
+        fprintf(stderr, "engine_session_test: %d check(s) failed\n", g_failures);
+        return 1;
+    }
+    printf("engine_session_test: ok\n");
+    return 0;
+}
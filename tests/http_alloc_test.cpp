@@ -0,0 +1,226 @@
+// http_alloc_test: holds the API hot path to its "no heap allocation per
+// request" budget. Serves a warm-up, then counts heap allocations made by
+// this thread over 1000 rounds of session, list, projected list and page
+// requests, with engine changes in between so cached bodies get rebuilt.
+//
+// This file #includes src/net/http_server.cpp, so it calls the handlers and
+// their file-local helpers directly, without sockets; it is rebuilt with
+// that file rather than linked against it.
+//
+// What is counted: operator new always. With the debug CRT (/MDd, which
+// defines _DEBUG) an alloc hook also counts malloc, calloc and realloc,
+// which covers mongoose's send buffer and anything else that bypasses new.
+// A release build counts operator new only and says so.
+// Not covered: `?q=` search requests. engine_session_search builds local
+// vectors on every call, so they still allocate.
+//
+// Standalone; build and run from the repository root with e.g.
+// `cl /EHsc /MDd /std:c++17 /DWIN32_LEAN_AND_MEAN /D_WIN32_WINNT=0x0A00 /Isrc /Iexternal\mongoose
+//   tests\http_alloc_test.cpp src\debug.cpp src\engine\*.cpp src\net\deflate.cpp src\net\http_assets.cpp
+//   src\net\http_assets_data.cpp src\net\http_local.cpp src\net\http_routes.cpp src\net\http_workers.cpp
+//   src\net\json_reader.cpp src\net\json_writer.cpp src\net\torrent_schema.cpp external\mongoose\mongoose.c
+//   ws2_32.lib advapi32.lib && http_alloc_test`.
+
+#include "net/http_server.cpp"
+
+#include <crtdbg.h>
+
+namespace
+{
+    const unsigned int kTestTorrents = 200;
+    const unsigned int kWarmupRounds = 3;
+    const unsigned int kCountedRounds = 1000;
+    // Engine changes every this many rounds, outside the count: they rebuild
+    // cached bodies, whose buffers must be reused too.
+    const unsigned int kChangeEvery = 100;
+
+    thread_local bool t_counting = false;
+    thread_local unsigned long t_allocations = 0;
+    thread_local unsigned long t_crt_allocations = 0;
+
+    struct TestRequest
+    {
+        const char* uri;
+        const char* query;
+    };
+
+    const TestRequest kRequests[] = {
+        { "/api/session", "" },
+        { "/api/torrents", "" },
+        { "/api/torrents", "fields=id,name" },
+        { "/api/torrents", "offset=10&limit=20" },
+    };
+
+    static void* counted_alloc(size_t size)
+    {
+        if(t_counting)
+        {
+            ++t_allocations;
+        }
+        return malloc(size ? size : 1);
+    }
+
+#ifdef _DEBUG
+    // Sees every heap allocation, including the ones operator new makes.
+    // CRT-internal blocks are skipped, as the hook must not recurse into them.
+    static int __cdecl crt_alloc_hook(int type, void*, size_t, int block_type, long, const unsigned char*, int)
+    {
+        if(t_counting && block_type != _CRT_BLOCK && (type == _HOOK_ALLOC || type == _HOOK_REALLOC))
+        {
+            ++t_crt_allocations;
+        }
+        return TRUE;
+    }
+#endif
+
+    // Returns true for a 200; the send buffer stands in for the socket and
+    // is drained after each request, as the poll loop would.
+    static bool serve(struct mg_connection* connection, HttpServer* server, const TestRequest& request)
+    {
+        struct mg_http_message message;
+        ZeroMemory(&message, sizeof(message));
+        message.method = mg_str("GET");
+        message.uri = mg_str(request.uri);
+        message.query = mg_str(request.query);
+
+        connection->send.len = 0;
+        const bool handled = handle_api_request(connection, server, &message);
+        trim_request_scratch(&payload_cache(server)->scratch);
+        return handled && connection->send.len > 12 && memcmp(connection->send.buf, "HTTP/1.1 200", 12) == 0;
+    }
+
+    static void change_engine(EngineSession* session, unsigned int torrent_id)
+    {
+        engine_session_pause_torrent(session, torrent_id);
+        engine_session_resume_torrent(session, torrent_id);
+    }
+}
+
+void* operator new(size_t size)
+{
+    void* block = counted_alloc(size);
+    if(!block)
+    {
+        throw std::bad_alloc();
+    }
+    return block;
+}
+
+void* operator new[](size_t size)
+{
+    return operator new(size);
+}
+
+void* operator new(size_t size, const std::nothrow_t&) noexcept
+{
+    return counted_alloc(size);
+}
+
+void* operator new[](size_t size, const std::nothrow_t&) noexcept
+{
+    return counted_alloc(size);
+}
+
+void operator delete(void* block) noexcept
+{
+    free(block);
+}
+
+void operator delete[](void* block) noexcept
+{
+    free(block);
+}
+
+void operator delete(void* block, size_t) noexcept
+{
+    free(block);
+}
+
+void operator delete[](void* block, size_t) noexcept
+{
+    free(block);
+}
+
+int main()
+{
+    EngineSessionConfig config;
+    engine_session_config_default(&config);
+    config.stats_shm_capacity = 0;
+    EngineSession session;
+    if(engine_session_init(&session, &config) != 0)
+    {
+        fprintf(stderr, "http_alloc_test: engine_session_init failed\n");
+        return 1;
+    }
+
+    unsigned int torrent_id = 0;
+    for(unsigned int i = 0; i < kTestTorrents; ++i)
+    {
+        EngineAddTorrentOptions options;
+        ZeroMemory(&options, sizeof(options));
+        options.magnet_uri = "magnet:?xt=urn:btih:0000000000000000000000000000000000000000";
+        options.display_name = "torrent";
+        options.size_bytes = 1024ull * 1024ull * (i + 1);
+        engine_session_add_torrent(&session, &options, &torrent_id);
+    }
+
+    static HttpServer server;
+    ZeroMemory(&server, sizeof(server));
+    server.config.engine = &session;
+    server.config.port = 1;
+    server.payload_cache = create_payload_cache(1);
+
+    static struct mg_connection connection;
+    ZeroMemory(&connection, sizeof(connection));
+    connection.id = 1;
+    connection.send.align = MG_IO_SIZE;
+
+    bool ok = server.payload_cache != nullptr;
+    for(unsigned int round = 0; ok && round < kWarmupRounds; ++round)
+    {
+        for(size_t r = 0; r < sizeof(kRequests) / sizeof(kRequests[0]); ++r)
+        {
+            ok = ok && serve(&connection, &server, kRequests[r]);
+        }
+        change_engine(&session, torrent_id);
+    }
+
+#ifdef _DEBUG
+    _CrtSetAllocHook(crt_alloc_hook);
+#else
+    printf("http_alloc_test: release CRT, counting operator new only (build with /MDd to count malloc too)\n");
+#endif
+    t_counting = true;
+    for(unsigned int round = 0; ok && round < kCountedRounds; ++round)
+    {
+        for(size_t r = 0; r < sizeof(kRequests) / sizeof(kRequests[0]); ++r)
+        {
+            ok = ok && serve(&connection, &server, kRequests[r]);
+        }
+        if(round % kChangeEvery == 0)
+        {
+            t_counting = false;
+            change_engine(&session, torrent_id);
+            t_counting = true;
+        }
+    }
+    t_counting = false;
+
+    mg_iobuf_free(&connection.send);
+    destroy_payload_cache(reinterpret_cast<HttpPayloadCache*>(server.payload_cache));
+    engine_session_shutdown(&session);
+
+    if(!ok)
+    {
+        fprintf(stderr, "http_alloc_test: a request did not return 200\n");
+        return 1;
+    }
+    if(t_allocations != 0 || t_crt_allocations != 0)
+    {
+        fprintf(stderr, "http_alloc_test: %lu operator new and %lu CRT heap allocations over %u rounds\n",
+            t_allocations, t_crt_allocations, kCountedRounds);
+        return 1;
+    }
+    printf("http_alloc_test: ok\n");
+    return 0;
+}
@@ -0,0 +1,174 @@
+// http_routes_test: matches, method checks and ID parsing for the route
+// trie in src/net/http_routes.cpp, plus a timing loop over typical paths.
+// A path that matches with method_allowed false is what the server answers
+// with 405.
+// Standalone; build and run from the repository root with e.g.
+// `cl /EHsc /std:c++17 /Isrc tests\http_routes_test.cpp src\net\http_routes.cpp && http_routes_test`.
+// Exits non-zero and names each failed check.
+
+#include <windows.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "net/http_routes.h"
+
+namespace
+{
+    const unsigned int kTimingMatches = 2000000;
+
+    int g_failures = 0;
+
+    static void check(bool condition, const char* what)
+    {
+        if(!condition)
+        {
+            fprintf(stderr, "http_routes_test: FAILED %s\n", what);
+            ++g_failures;
+        }
+    }
+
+    static bool match(const char* method, const char* path, HttpRouteMatch* out)
+    {
+        return http_routes_match(http_method_parse(method, strlen(method)), path, strlen(path), out);
+    }
+
+    static bool matches_route(const char* method, const char* path, HttpRouteId route)
+    {
+        HttpRouteMatch result;
+        return match(method, path, &result) && result.route == route && result.method_allowed;
+    }
+
+    static bool method_refused(const char* method, const char* path)
+    {
+        HttpRouteMatch result;
+        return match(method, path, &result) && !result.method_allowed;
+    }
+
+    static bool no_route(const char* method, const char* path)
+    {
+        HttpRouteMatch result;
+        return !match(method, path, &result) && result.route == HttpRoute_None;
+    }
+
+    static void test_routes()
+    {
+        check(matches_route("GET", "/api/session", HttpRoute_Session), "GET session");
+        check(matches_route("HEAD", "/api/session", HttpRoute_Session), "HEAD session");
+        check(matches_route("GET", "/api/debug/connections", HttpRoute_DebugConnections), "GET debug connections");
+        check(matches_route("GET", "/api/torrents", HttpRoute_Torrents), "GET torrents");
+        check(matches_route("POST", "/api/torrents", HttpRoute_Torrents), "POST torrents");
+        check(matches_route("DELETE", "/api/torrents/7", HttpRoute_Torrent), "DELETE torrent");
+        check(matches_route("POST", "/api/torrents/7/pause", HttpRoute_TorrentAction), "POST torrent action");
+        check(matches_route("GET", "/ws", HttpRoute_WebSocket), "GET ws");
+        check(matches_route("GET", "/api/events", HttpRoute_Events), "GET events");
+        check(matches_route("POST", "/api/rpc", HttpRoute_Rpc), "POST rpc");
+
+        HttpRouteMatch result;
+        check(match("POST", "/api/torrents/12/resume", &result) && result.id == 12 && result.action_len == 6 &&
+            memcmp(result.action, "resume", 6) == 0, "action captured in place");
+        check(match("POST", "/api/torrents/12/x", &result) && result.action_len == 1, "any action segment captured");
+    }
+
+    static void test_methods()
+    {
+        check(method_refused("POST", "/api/session"), "POST session refused");
+        check(method_refused("DELETE", "/api/torrents"), "DELETE torrents refused");
+        check(method_refused("GET", "/api/torrents/7"), "GET torrent refused");
+        check(method_refused("GET", "/api/torrents/7/pause"), "GET torrent action refused");
+        check(method_refused("POST", "/ws"), "POST ws refused");
+        check(method_refused("GET", "/api/rpc"), "GET rpc refused");
+        check(method_refused("PATCH", "/api/session"), "unknown method refused");
+        check(method_refused("get", "/api/session"), "methods are case-sensitive");
+
+        check(http_method_parse("DELETE", 6) == HttpMethod_Delete, "DELETE parses");
+        check(http_method_parse("DELETEX", 7) == HttpMethod_Other, "longer name is other");
+        check(http_method_parse("GE", 2) == HttpMethod_Other, "prefix is other");
+        check(http_method_parse(nullptr, 0) == HttpMethod_Other, "null method is other");
+    }
+
+    static void test_ids()
+    {
+        HttpRouteMatch result;
+        check(match("DELETE", "/api/torrents/1", &result) && result.id == 1, "smallest id");
+        check(match("DELETE", "/api/torrents/4294967295", &result) && result.id == 4294967295u, "largest id");
+        check(match("DELETE", "/api/torrents/0000000042", &result) && result.id == 42, "leading zeros within 10 digits");
+        check(no_route("DELETE", "/api/torrents/4294967296"), "id past 32 bits refused");
+        check(no_route("DELETE", "/api/torrents/99999999999"), "11-digit id refused");
+        check(no_route("DELETE", "/api/torrents/0"), "zero id refused");
+        check(no_route("DELETE", "/api/torrents/-1"), "negative id refused");
+        check(no_route("DELETE", "/api/torrents/12a"), "trailing letter refused");
+        check(no_route("DELETE", "/api/torrents/+1"), "sign refused");
+        check(no_route("POST", "/api/torrents/abc/pause"), "non-numeric id refused");
+    }
+
+    static void test_misses()
+    {
+        check(no_route("GET", ""), "empty path");
+        check(no_route("GET", "/"), "root");
+        check(no_route("GET", "api/session"), "no leading slash");
+        check(no_route("GET", "/api"), "interior node only");
+        check(no_route("GET", "/api/"), "trailing slash on interior node");
+        check(no_route("GET", "/api/session/"), "trailing slash on leaf");
+        check(no_route("GET", "/api/torrents/"), "empty id");
+        check(no_route("POST", "/api/torrents/1/"), "empty action");
+        check(no_route("POST", "/api/torrents/1/pause/x"), "extra segment");
+        check(no_route("GET", "/api/torrentsx"), "literal prefix");
+        check(no_route("GET", "/api/sessio"), "literal truncated");
+        check(no_route("GET", "//api/session"), "doubled slash");
+        check(no_route("GET", "/index.html"), "static asset");
+
+        // Matching stops at path_len, so a query string never reaches it.
+        HttpRouteMatch result;
+        const char* path = "/api/session?x=1";
+        check(http_routes_match(HttpMethod_Get, path, 12, &result) && result.route == HttpRoute_Session, "path_len bounds the match");
+        check(!http_routes_match(HttpMethod_Get, "/api/session", 12, nullptr), "null result refused");
+    }
+
+    static void test_timing()
+    {
+        const char* const paths[] = {
+            "/api/session", "/api/torrents", "/api/torrents/123/resume", "/api/debug/connections", "/ws", "/app.js"
+        };
+        const size_t path_count = sizeof(paths) / sizeof(paths[0]);
+        size_t lengths[path_count];
+        for(size_t i = 0; i < path_count; ++i)
+        {
+            lengths[i] = strlen(paths[i]);
+        }
+
+        LARGE_INTEGER frequency;
+        LARGE_INTEGER start;
+        LARGE_INTEGER stop;
+        QueryPerformanceFrequency(&frequency);
+        QueryPerformanceCounter(&start);
+        unsigned long long matched = 0;
+        for(unsigned int i = 0; i < kTimingMatches; ++i)
+        {
+            HttpRouteMatch result;
+            const size_t p = i % path_count;
+            matched += http_routes_match(HttpMethod_Get, paths[p], lengths[p], &result) ? 1 : 0;
+        }
+        QueryPerformanceCounter(&stop);
+
+        check(matched == kTimingMatches / path_count * (path_count - 1) + (kTimingMatches % path_count), "timing loop matches");
+        const double seconds = static_cast<double>(stop.QuadPart - start.QuadPart) / static_cast<double>(frequency.QuadPart);
+        printf("http_routes_test: %u matches, %.1f ns each\n", kTimingMatches, seconds * 1e9 / kTimingMatches);
+    }
+}
+
+int main()
+{
+    test_routes();
+    test_methods();
+    test_ids();
+    test_misses();
+    test_timing();
+
+    if(g_failures != 0)
+    {
+        fprintf(stderr, "http_routes_test: %d check(s) failed\n", g_failures);
+        return 1;
+    }
+    printf("http_routes_test: ok\n");
+    return 0;
+}
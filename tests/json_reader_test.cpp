@@ -0,0 +1,182 @@
+// json_reader_test: malformed and hostile bodies for src/net/json_reader.cpp,
+// plus a timing run over a large add-torrent batch.
+// Standalone; build and run from the repository root with e.g.
+// `cl /EHsc /Isrc tests\json_reader_test.cpp src\net\json_reader.cpp && json_reader_test`.
+// Bodies are copied into exactly-sized heap buffers with no terminator, so a
+// checked build catches any write past the end. Exits non-zero and names
+// each failed check.
+
+#include <windows.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <string>
+
+#include "net/json_reader.h"
+
+namespace
+{
+    const unsigned int kBatchItems = 100000;
+
+    int g_failures = 0;
+
+    static void check(bool condition, const char* what)
+    {
+        if(!condition)
+        {
+            fprintf(stderr, "json_reader_test: FAILED %s\n", what);
+            ++g_failures;
+        }
+    }
+
+    // Tokenizes `body` to the end, decoding every string. Returns true if the
+    // document parsed completely; `strings` gets the decoded strings, each
+    // followed by '|'.
+    static bool parse(const std::string& body, std::string* strings)
+    {
+        char* buffer = new char[body.size() ? body.size() : 1];
+        memcpy(buffer, body.data(), body.size());
+
+        JsonReader reader;
+        json_reader_init(&reader, buffer, body.size());
+        JsonToken token;
+        while(json_reader_next(&reader, &token))
+        {
+            if(token.type == JsonToken_String && strings)
+            {
+                strings->append(json_token_cstr(&token));
+                strings->push_back('|');
+            }
+        }
+        const bool done = json_reader_done(&reader);
+        delete[] buffer;
+        return done;
+    }
+
+    static std::string decode(const std::string& body)
+    {
+        std::string strings;
+        return parse(body, &strings) ? strings : std::string("<failed>");
+    }
+
+    static void test_escapes()
+    {
+        check(decode("[\"a\\\"b\\\\c\\/d\\b\\f\\n\\r\\t\"]") == "a\"b\\c/d\b\f\n\r\t|", "simple escapes decode");
+        check(decode("[\"\\u0041\\u00e9\\u20AC\"]") == "A\xC3\xA9\xE2\x82\xAC|", "\\u escapes decode to UTF-8");
+        check(decode("[\"\\ud83d\\ude00\"]") == "\xF0\x9F\x98\x80|", "surrogate pair decodes");
+
+        check(!parse("{\"magnet\":\"\\q\",\"name\":\"x\"}", nullptr), "unknown escape \\q refused");
+        check(!parse("[\"\\x41\"]", nullptr), "unknown escape \\x refused");
+        check(!parse("[\"\\'\"]", nullptr), "unknown escape \\' refused");
+        check(!parse("[\"\\u12\"]", nullptr), "short \\u refused");
+        check(!parse("[\"\\u12G4\"]", nullptr), "non-hex \\u refused");
+        check(!parse("[\"\\u\"]", nullptr), "bare \\u refused");
+        check(!parse("[\"abc\\", nullptr), "backslash at the end of input refused");
+        check(!parse("[\"\\u00", nullptr), "\\u cut by the end of input refused");
+
+        // The same object with a valid escape in place of \q parses whole.
+        check(decode("{\"magnet\":\"\\u0071\",\"name\":\"x\"}") == "magnet|q|name|x|", "members after an escape intact");
+    }
+
+    static void test_surrogates()
+    {
+        check(decode("[\"\\ud800\"]") == "\xEF\xBF\xBD|", "lone high surrogate becomes U+FFFD");
+        check(decode("[\"\\udc00x\"]") == "\xEF\xBF\xBDx|", "lone low surrogate becomes U+FFFD");
+        check(decode("[\"\\ud800\\u0041\"]") == "\xEF\xBF\xBD" "A|", "high surrogate before a non-surrogate");
+        check(decode("[\"\\ud800\\ud800\"]") == "\xEF\xBF\xBD\xEF\xBF\xBD|", "two high surrogates");
+    }
+
+    static void test_buffer_end()
+    {
+        // The string's closing quote is the last byte of the buffer; decoding
+        // writes its terminator there and nowhere further.
+        check(decode("\"tail\\n\"") == "tail\n|", "escaped string ending at the buffer end");
+        check(decode("\"\\u00e9\"") == "\xC3\xA9|", "\\u string ending at the buffer end");
+        check(!parse("\"unterminated", nullptr), "unterminated string refused");
+        check(!parse("\"", nullptr), "lone quote refused");
+    }
+
+    static void test_nesting()
+    {
+        std::string ok_depth(kJsonReaderMaxDepth, '[');
+        ok_depth.append(kJsonReaderMaxDepth, ']');
+        check(parse(ok_depth, nullptr), "nesting at the limit accepted");
+
+        std::string too_deep(kJsonReaderMaxDepth + 1, '[');
+        too_deep.append(kJsonReaderMaxDepth + 1, ']');
+        check(!parse(too_deep, nullptr), "nesting past the limit refused");
+
+        std::string very_deep(100000, '{');
+        check(!parse(very_deep, nullptr), "unbounded nesting refused");
+    }
+
+    static void test_truncated()
+    {
+        const std::string body =
+            "[{\"magnet\":\"magnet:?xt=urn:btih:00\",\"name\":\"a \\u00e9 \\ud83d\\ude00\",\"size\":123},"
+            "{\"magnet\":\"m\",\"flags\":[true,false,null],\"extra\":{\"k\":-1.5e3}}]";
+        check(parse(body, nullptr), "reference body parses");
+        bool all_refused = true;
+        for(size_t cut = 0; cut < body.size(); ++cut)
+        {
+            if(parse(body.substr(0, cut), nullptr))
+            {
+                all_refused = false;
+            }
+        }
+        check(all_refused, "every truncated body refused");
+
+        check(!parse("", nullptr), "empty body refused");
+        check(!parse("{\"a\":1,}", nullptr), "trailing comma refused");
+        check(!parse("{\"a\" 1}", nullptr), "missing colon refused");
+        check(!parse("[1] [2]", nullptr), "two documents refused");
+        check(!parse("[\"a\x01\"]", nullptr), "control character in string refused");
+    }
+
+    static void test_batch_timing()
+    {
+        std::string body("[");
+        for(unsigned int i = 0; i < kBatchItems; ++i)
+        {
+            char item[160];
+            _snprintf_s(item, sizeof(item), _TRUNCATE,
+                "%s{\"magnet\":\"magnet:?xt=urn:btih:%040u\",\"name\":\"torrent \\u00e9 %u\",\"size\":%u}",
+                i ? "," : "", i, i, 1024u + i);
+            body.append(item);
+        }
+        body.push_back(']');
+
+        LARGE_INTEGER frequency;
+        LARGE_INTEGER start;
+        LARGE_INTEGER stop;
+        QueryPerformanceFrequency(&frequency);
+        QueryPerformanceCounter(&start);
+        std::string strings;
+        strings.reserve(body.size());
+        const bool parsed = parse(body, &strings);
+        QueryPerformanceCounter(&stop);
+
+        check(parsed, "large batch parses");
+        const double seconds = static_cast<double>(stop.QuadPart - start.QuadPart) / static_cast<double>(frequency.QuadPart);
+        printf("json_reader_test: %u-item batch, %.1f MB in %.1f ms (%.0f MB/s)\n", kBatchItems,
+            body.size() / 1e6, seconds * 1e3, seconds > 0 ? body.size() / 1e6 / seconds : 0.0);
+    }
+}
+
+int main()
+{
+    test_escapes();
+    test_surrogates();
+    test_buffer_end();
+    test_nesting();
+    test_truncated();
+    test_batch_timing();
+
+    if(g_failures != 0)
+    {
+        fprintf(stderr, "json_reader_test: %d check(s) failed\n", g_failures);
+        return 1;
+    }
+    printf("json_reader_test: ok\n");
+    return 0;
+}
@@ -0,0 +1,195 @@
+// stats_shm_test: the header-only reader in src/engine/rawbit_stats_shm.h
+// against well-formed and hostile regions it maps from this process.
+// Standalone; build and run from the repository root with e.g.
+// `cl /EHsc /Isrc tests\stats_shm_test.cpp && stats_shm_test`.
+// Exits non-zero and names each failed check.
+
+#include <windows.h>
+#include <stdio.h>
+#include <string.h>
+
+#include "engine/rawbit_stats_shm.h"
+
+namespace
+{
+    const uint32_t kRegionRows = 8;
+
+    int g_failures = 0;
+
+    static void check(bool condition, const char* what)
+    {
+        if(!condition)
+        {
+            fprintf(stderr, "stats_shm_test: FAILED %s\n", what);
+            ++g_failures;
+        }
+    }
+
+    // A writable region laid out as the engine lays out its export, with
+    // `row_count` rows published.
+    struct TestRegion
+    {
+        HANDLE mapping;
+        RawBitShmHeader* header;
+        RawBitShmTorrent* rows;
+        // Rows the whole view could hold, page rounding included.
+        size_t view_rows;
+    };
+
+    static bool create_region(TestRegion* region, const wchar_t* name, uint32_t row_count)
+    {
+        const DWORD size = static_cast<DWORD>(sizeof(RawBitShmHeader) + kRegionRows * sizeof(RawBitShmTorrent));
+        region->mapping = CreateFileMappingW(INVALID_HANDLE_VALUE, nullptr, PAGE_READWRITE, 0, size, name);
+        region->header = region->mapping ?
+            static_cast<RawBitShmHeader*>(MapViewOfFile(region->mapping, FILE_MAP_ALL_ACCESS, 0, 0, 0)) : nullptr;
+        if(!region->header)
+        {
+            return false;
+        }
+        MEMORY_BASIC_INFORMATION view;
+        VirtualQuery(region->header, &view, sizeof(view));
+        region->view_rows = (view.RegionSize - sizeof(RawBitShmHeader)) / sizeof(RawBitShmTorrent);
+        region->rows = reinterpret_cast<RawBitShmTorrent*>(region->header + 1);
+
+        region->header->magic = RAWBIT_SHM_MAGIC;
+        region->header->version = RAWBIT_SHM_VERSION;
+        region->header->header_size = sizeof(RawBitShmHeader);
+        region->header->record_size = sizeof(RawBitShmTorrent);
+        region->header->capacity = kRegionRows;
+        region->header->record_count = row_count;
+        for(uint32_t i = 0; i < row_count; ++i)
+        {
+            region->rows[i].id = i + 1;
+        }
+        return true;
+    }
+
+    static void destroy_region(TestRegion* region)
+    {
+        if(region->header)
+        {
+            UnmapViewOfFile(region->header);
+        }
+        if(region->mapping)
+        {
+            CloseHandle(region->mapping);
+        }
+    }
+
+    // Opens `name` with the reader, reads once into `rows` and closes it.
+    // Returns the open error, or else the read result.
+    static int open_and_read(const wchar_t* name, RawBitShmTorrent* rows, uint32_t max_rows)
+    {
+        RawBitShmReader reader;
+        const int opened = rawbit_shm_open(&reader, name);
+        if(opened != 0)
+        {
+            return opened * 100;
+        }
+        RawBitShmHeader header;
+        const int count = rawbit_shm_read(&reader, &header, rows, max_rows, 10);
+        rawbit_shm_close(&reader);
+        return count;
+    }
+
+    static void test_well_formed()
+    {
+        TestRegion region;
+        if(!create_region(&region, L"Local\\rawBit.stats.test.ok", 3))
+        {
+            check(false, "region created");
+            return;
+        }
+        RawBitShmTorrent rows[kRegionRows];
+        check(open_and_read(L"Local\\rawBit.stats.test.ok", rows, kRegionRows) == 3 && rows[0].id == 1 && rows[2].id == 3,
+            "published rows read back");
+        check(open_and_read(L"Local\\rawBit.stats.test.ok", rows, 2) == 2, "max_records caps the copy");
+
+        // A record count past capacity is cut to capacity, never read on.
+        region.header->record_count = kRegionRows + 1000;
+        check(open_and_read(L"Local\\rawBit.stats.test.ok", rows, kRegionRows) == static_cast<int>(kRegionRows),
+            "record count clamped to capacity");
+        destroy_region(&region);
+        check(open_and_read(L"Local\\rawBit.stats.test.ok", rows, kRegionRows) == -200, "closed region not found");
+    }
+
+    static void test_refused_at_open()
+    {
+        RawBitShmTorrent rows[kRegionRows];
+        TestRegion region;
+        if(create_region(&region, L"Local\\rawBit.stats.test.magic", 1))
+        {
+            region.header->magic = 0;
+            check(open_and_read(L"Local\\rawBit.stats.test.magic", rows, kRegionRows) == -300, "bad magic refused");
+            destroy_region(&region);
+        }
+        if(create_region(&region, L"Local\\rawBit.stats.test.header", 1))
+        {
+            region.header->header_size = sizeof(RawBitShmHeader) + 8;
+            check(open_and_read(L"Local\\rawBit.stats.test.header", rows, kRegionRows) == -300, "wrong header_size refused");
+            destroy_region(&region);
+        }
+        if(create_region(&region, L"Local\\rawBit.stats.test.record", 1))
+        {
+            region.header->record_size = sizeof(RawBitShmTorrent) - 8;
+            check(open_and_read(L"Local\\rawBit.stats.test.record", rows, kRegionRows) == -300, "wrong record_size refused");
+            destroy_region(&region);
+        }
+        if(create_region(&region, L"Local\\rawBit.stats.test.capacity", 1))
+        {
+            region.header->capacity = static_cast<uint32_t>(region.view_rows + 1);
+            check(open_and_read(L"Local\\rawBit.stats.test.capacity", rows, kRegionRows) == -300,
+                "capacity past the view refused");
+            destroy_region(&region);
+        }
+    }
+
+    // The writer is not trusted after open either: every read re-checks the
+    // header it copied before touching rows.
+    static void test_refused_at_read()
+    {
+        TestRegion region;
+        if(!create_region(&region, L"Local\\rawBit.stats.test.read", 2))
+        {
+            check(false, "region created");
+            return;
+        }
+        RawBitShmReader reader;
+        check(rawbit_shm_open(&reader, L"Local\\rawBit.stats.test.read") == 0, "reader opens");
+        RawBitShmHeader header;
+        RawBitShmTorrent rows[kRegionRows];
+
+        region.header->capacity = static_cast<uint32_t>(region.view_rows + 1);
+        region.header->record_count = region.header->capacity;
+        check(rawbit_shm_read(&reader, &header, rows, kRegionRows, 10) == -2, "capacity grown past the view refused");
+
+        region.header->capacity = kRegionRows;
+        region.header->record_count = 2;
+        region.header->record_size = 0;
+        check(rawbit_shm_read(&reader, &header, rows, kRegionRows, 10) == -2, "record_size changed after open refused");
+
+        region.header->record_size = sizeof(RawBitShmTorrent);
+        check(rawbit_shm_read(&reader, &header, rows, kRegionRows, 10) == 2, "restored region reads");
+
+        region.header->sequence = 1;
+        check(rawbit_shm_read(&reader, &header, rows, kRegionRows, 10) == -1, "region held busy gives up");
+
+        rawbit_shm_close(&reader);
+        destroy_region(&region);
+    }
+}
+
+int main()
+{
+    test_well_formed();
+    test_refused_at_open();
+    test_refused_at_read();
+
+    if(g_failures != 0)
+    {
+        fprintf(stderr, "stats_shm_test: %d check(s) failed\n", g_failures);
+        return 1;
+    }
+    printf("stats_shm_test: ok\n");
+    return 0;
+}
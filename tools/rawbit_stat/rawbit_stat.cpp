@@ -0,0 +1,90 @@
+// rawbit_stat: prints the stats a running rawBit publishes to shared memory.
+// Standalone; build with e.g. `cl /EHsc /I..\..\src tools\rawbit_stat\rawbit_stat.cpp`.
+//
+//   rawbit_stat            one-shot summary plus every torrent row
+//   rawbit_stat -w [ms]    refresh the summary every `ms` (default 1000)
+
+#include <windows.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <vector>
+
+#include "engine/rawbit_stats_shm.h"
+
+namespace
+{
+    const unsigned int kReadAttempts = 1000;
+
+    static int print_once(const RawBitShmReader* reader, bool rows)
+    {
+        RawBitShmHeader header;
+        std::vector<RawBitShmTorrent> records(rows ? reader->header->capacity : 0);
+        const int count = rawbit_shm_read(reader, &header, records.empty() ? nullptr : records.data(),
+            static_cast<uint32_t>(records.size()), kReadAttempts);
+        if(count == -2)
+        {
+            fprintf(stderr, "rawbit_stat: stats region layout does not match this build.\n");
+            return 1;
+        }
+        if(count < 0)
+        {
+            fprintf(stderr, "rawbit_stat: region busy, try again.\n");
+            return 1;
+        }
+
+        printf("publish #%llu  torrents %u (active %u, hot %u, cold %u)  down %llu B/s  up %llu B/s%s\n",
+            static_cast<unsigned long long>(header.publish_count), header.torrent_count, header.active_count,
+            header.hot_count, header.cold_count, static_cast<unsigned long long>(header.download_rate),
+            static_cast<unsigned long long>(header.upload_rate), header.truncated ? "  (rows truncated)" : "");
+
+        for(int i = 0; i < count; ++i)
+        {
+            const RawBitShmTorrent& t = records[static_cast<size_t>(i)];
+            printf("%8u  %6.2f%%  %10u  %10u  %c%c%c\n", t.id, t.progress * 100.0f, t.download_rate, t.upload_rate,
+                (t.flags & RawBitShmTorrent_Paused) ? 'P' : '-',
+                (t.flags & RawBitShmTorrent_Complete) ? 'C' : '-',
+                (t.flags & RawBitShmTorrent_Cold) ? 'Z' : '-');
+        }
+        return 0;
+    }
+}
+
+int main(int argc, char** argv)
+{
+    bool watch = false;
+    unsigned long interval_ms = 1000;
+    if(argc > 1 && strcmp(argv[1], "-w") == 0)
+    {
+        watch = true;
+        if(argc > 2)
+        {
+            interval_ms = strtoul(argv[2], nullptr, 10);
+        }
+    }
+
+    RawBitShmReader reader;
+    if(rawbit_shm_open(&reader, RAWBIT_SHM_DEFAULT_NAME) != 0)
+    {
+        fprintf(stderr, "rawbit_stat: rawBit is not running or the stats export is disabled.\n");
+        return 1;
+    }
+
+    int result = 0;
+    if(!watch)
+    {
+        result = print_once(&reader, true);
+    }
+    else
+    {
+        while(result == 0)
+        {
+            result = print_once(&reader, false);
+            Sleep(interval_ms);
+        }
+    }
+
+    rawbit_shm_close(&reader);
+    return result;
+}
@@ -19,6 +19,12 @@ const appState = {
     ws: null,
     reconnectHandle: null
 };
+// State held from the WebSocket stream, keyed by torrent ID.
+const live = {
+    seq: 0,
+    stats: null,
+    torrents: new Map()
+};
 function formatBytes(value) {
     if (!value || value <= 0) {
         return "0 B";
@@ -188,6 +194,131 @@ function applySnapshot(snapshot) {
     updateStats(snapshot.stats);
     renderTorrents(snapshot.torrents);
 }
+// Binary frames (see build_ws_binary_frame in src/net/http_server.cpp) are
+// decoded into the same shapes as the JSON frames.
+const binaryProtocol = "rawbit.bin.v1";
+const binaryFrameMagic = 0x31574252;
+const binaryFrameKinds = ["full", "resync", "patch"];
+const binaryStringAbsent = 0xffff;
+const utf8 = new TextDecoder();
+function readUint64(view, offset) {
+    return view.getUint32(offset, true) + view.getUint32(offset + 4, true) * 4294967296;
+}
+function decodeBinaryFrame(buffer) {
+    var _a;
+    const view = new DataView(buffer);
+    if (view.getUint32(0, true) !== binaryFrameMagic) {
+        throw new Error("Unknown binary frame");
+    }
+    const type = binaryFrameKinds[view.getUint8(4)];
+    const flags = view.getUint8(5);
+    const recordSize = view.getUint16(6, true);
+    const seq = readUint64(view, 8);
+    let offset = 16;
+    let stats;
+    if (flags & 1) {
+        stats = {
+            port: view.getUint32(offset, true),
+            torrent_count: view.getUint32(offset + 4, true),
+            active: view.getUint32(offset + 8, true),
+            download_rate: readUint64(view, offset + 16),
+            upload_rate: readUint64(view, offset + 24)
+        };
+        offset += 32;
+    }
+    const rows = new Map();
+    const recordCount = view.getUint32(offset, true);
+    offset += 4;
+    for (let i = 0; i < recordCount; i++, offset += recordSize) {
+        const id = view.getUint32(offset, true);
+        const recordFlags = view.getUint32(offset + 4, true);
+        rows.set(id, {
+            id,
+            progress: view.getFloat32(offset + 8, true),
+            download_rate: view.getUint32(offset + 12, true),
+            upload_rate: view.getUint32(offset + 16, true),
+            size: readUint64(view, offset + 24),
+            downloaded: readUint64(view, offset + 32),
+            paused: (recordFlags & 1) !== 0,
+            complete: (recordFlags & 2) !== 0
+        });
+    }
+    const removed = [];
+    const removedCount = view.getUint32(offset, true);
+    offset += 4;
+    for (let i = 0; i < removedCount; i++, offset += 4) {
+        removed.push(view.getUint32(offset, true));
+    }
+    if (flags & 2) {
+        const readString = () => {
+            const length = view.getUint16(offset, true);
+            offset += 2;
+            if (length === binaryStringAbsent) {
+                return undefined;
+            }
+            const text = utf8.decode(new Uint8Array(buffer, offset, length));
+            offset += length;
+            return text;
+        };
+        const stringCount = view.getUint32(offset, true);
+        offset += 4;
+        for (let i = 0; i < stringCount; i++) {
+            const id = view.getUint32(offset, true);
+            offset += 4;
+            const row = (_a = rows.get(id)) !== null && _a !== void 0 ? _a : { id };
+            const name = readString();
+            const magnet = readString();
+            if (name !== undefined) {
+                row.name = name;
+            }
+            if (magnet !== undefined) {
+                row.magnet = magnet;
+            }
+            rows.set(id, row);
+        }
+    }
+    if (type === "patch") {
+        // Records do not say whether a row is new; applyLiveFrame upserts.
+        return { type, seq, stats, added: [], updated: Array.from(rows.values()), removed };
+    }
+    const torrents = Array.from(rows.values()).map((row) => (Object.assign({ name: "", magnet: "" }, row)));
+    return { type, seq, stats: stats, torrents };
+}
+function publishLiveState() {
+    if (!live.stats) {
+        return;
+    }
+    const torrents = Array.from(live.torrents.values()).sort((a, b) => a.id - b.id);
+    const snapshot = { stats: live.stats, torrents };
+    appState.snapshot = snapshot;
+    applySnapshot(snapshot);
+}
+function applyLiveFrame(socket, frame) {
+    if (frame.type === "full" || frame.type === "resync") {
+        live.seq = frame.seq;
+        live.stats = frame.stats;
+        live.torrents.clear();
+        frame.torrents.forEach((torrent) => live.torrents.set(torrent.id, torrent));
+        publishLiveState();
+        return;
+    }
+    if (frame.seq !== live.seq + 1) {
+        // Missed a patch; ask for the whole state instead of guessing.
+        socket.send(JSON.stringify({ type: "resync" }));
+        return;
+    }
+    live.seq = frame.seq;
+    if (frame.stats) {
+        live.stats = frame.stats;
+    }
+    frame.removed.forEach((id) => live.torrents.delete(id));
+    frame.added.forEach((torrent) => live.torrents.set(torrent.id, torrent));
+    frame.updated.forEach((changes) => {
+        const current = live.torrents.get(changes.id);
+        live.torrents.set(changes.id, Object.assign(Object.assign({}, current), changes));
+    });
+    publishLiveState();
+}
 function readSizeInBytes() {
     if (!sizeInput) {
         return 0;
@@ -247,14 +378,17 @@ function connectWebSocket() {
         appState.ws.close();
         appState.ws = null;
     }
-    const socket = new WebSocket(url);
+    const socket = new WebSocket(url, [binaryProtocol]);
+    socket.binaryType = "arraybuffer";
     appState.ws = socket;
+    live.seq = 0;
     socket.addEventListener("open", () => showToast("Live updates connected", "info"));
     socket.addEventListener("message", (event) => {
         try {
-            const snapshot = JSON.parse(event.data);
-            appState.snapshot = snapshot;
-            applySnapshot(snapshot);
+            const frame = typeof event.data === "string"
+                ? JSON.parse(event.data)
+                : decodeBinaryFrame(event.data);
+            applyLiveFrame(socket, frame);
         }
         catch (error) {
             console.error("Failed to parse WS payload", error);
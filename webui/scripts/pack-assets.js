@@ -0,0 +1,119 @@
+// Packs webui/dist into src/net/http_assets_data.cpp so the server can answer
+// UI requests from memory. Each file gets gzip and brotli variants (kept only
+// when smaller), a strong ETag and a short version tag; index.html references
+// to other assets are rewritten to carry that tag as `?v=`.
+const fs = require("fs");
+const path = require("path");
+const crypto = require("crypto");
+const zlib = require("zlib");
+
+const kContentTypes = {
+    ".html": "text/html; charset=utf-8",
+    ".js": "text/javascript; charset=utf-8",
+    ".css": "text/css; charset=utf-8",
+    ".json": "application/json",
+    ".svg": "image/svg+xml",
+    ".png": "image/png",
+    ".ico": "image/x-icon",
+    ".woff2": "font/woff2"
+};
+
+const kBytesPerLine = 24;
+
+function listFiles(root, dir, out) {
+    for(const entry of fs.readdirSync(dir).sort()) {
+        const fullPath = path.join(dir, entry);
+        if(fs.statSync(fullPath).isDirectory()) {
+            listFiles(root, fullPath, out);
+        } else {
+            out.push("/" + path.relative(root, fullPath).split(path.sep).join("/"));
+        }
+    }
+    return out;
+}
+
+function digest(bytes) {
+    return crypto.createHash("sha256").update(bytes).digest("hex");
+}
+
+function smallerOrNull(raw, packed) {
+    return packed.length < raw.length ? packed : null;
+}
+
+// Pins every asset an HTML page names by href/src to its current version.
+function pinReferences(html, versions) {
+    return html.replace(/(href|src)="([^":?#]+)"/g, (match, attribute, target) => {
+        const key = "/" + target.replace(/^\.?\//, "");
+        return versions.has(key) ? `${attribute}="${target}?v=${versions.get(key)}"` : match;
+    });
+}
+
+function cString(text) {
+    return "\"" + text.replace(/\\/g, "\\\\").replace(/"/g, "\\\"") + "\"";
+}
+
+function cArray(name, bytes) {
+    const lines = [];
+    for(let i = 0; i < bytes.length; i += kBytesPerLine) {
+        lines.push("        " + Array.from(bytes.subarray(i, i + kBytesPerLine)).join(",") + ",");
+    }
+    return `    const unsigned char ${name}[] = {\n${lines.join("\n")}\n    };\n`;
+}
+
+function main() {
+    const dist = path.join(__dirname, "..", "dist");
+    const output = path.join(__dirname, "..", "..", "src", "net", "http_assets_data.cpp");
+    const paths = listFiles(dist, dist, []).sort();
+    if(paths.length === 0) {
+        console.error("pack-assets: webui/dist is empty; run the TypeScript build first.");
+        process.exit(1);
+    }
+
+    const raw = new Map();
+    const versions = new Map();
+    for(const assetPath of paths) {
+        raw.set(assetPath, fs.readFileSync(path.join(dist, assetPath)));
+    }
+    // Pages are pinned last so their own tags cover the rewritten bytes.
+    for(const assetPath of paths.filter((p) => !p.endsWith(".html"))) {
+        versions.set(assetPath, digest(raw.get(assetPath)).slice(0, 12));
+    }
+    for(const assetPath of paths.filter((p) => p.endsWith(".html"))) {
+        raw.set(assetPath, Buffer.from(pinReferences(raw.get(assetPath).toString("utf8"), versions), "utf8"));
+    }
+
+    let arrays = "";
+    const rows = [];
+    paths.forEach((assetPath, index) => {
+        const bytes = raw.get(assetPath);
+        const hash = digest(bytes);
+        const gzip = smallerOrNull(bytes, zlib.gzipSync(bytes, { level: 9 }));
+        const brotli = smallerOrNull(bytes, zlib.brotliCompressSync(bytes, {
+            params: { [zlib.constants.BROTLI_PARAM_QUALITY]: zlib.constants.BROTLI_MAX_QUALITY }
+        }));
+        const contentType = kContentTypes[path.extname(assetPath).toLowerCase()] || "application/octet-stream";
+
+        arrays += cArray(`kAsset${index}`, bytes);
+        if(gzip) {
+            arrays += cArray(`kAsset${index}Gzip`, gzip);
+        }
+        if(brotli) {
+            arrays += cArray(`kAsset${index}Brotli`, brotli);
+        }
+        const variant = (name, bytesOrNull) => bytesOrNull ? `${name}, sizeof(${name})` : "nullptr, 0";
+        rows.push(`    { ${cString(assetPath)}, ${cString(contentType)}, ${cString("\"" + hash.slice(0, 32) + "\"")}, ` +
+            `${cString(hash.slice(0, 12))},\n        kAsset${index}, sizeof(kAsset${index}), ` +
+            `${variant(`kAsset${index}Gzip`, gzip)}, ${variant(`kAsset${index}Brotli`, brotli)} },`);
+    });
+
+    const source = "// Generated by webui/scripts/pack-assets.js from webui/dist. Do not edit.\n" +
+        "#include \"net/http_assets.h\"\n\n" +
+        "namespace\n{\n" + arrays + "}\n\n" +
+        "// Sorted by path for http_assets_find().\n" +
+        "extern const HttpAsset kHttpAssets[] = {\n" + rows.join("\n") + "\n};\n\n" +
+        "extern const size_t kHttpAssetCount = sizeof(kHttpAssets) / sizeof(kHttpAssets[0]);\n";
+    fs.writeFileSync(output, source);
+    console.log(`pack-assets: ${paths.length} file(s) -> ${path.relative(process.cwd(), output)}`);
+}
+
+main();
@@ -24,6 +24,24 @@ type Snapshot = {
     torrents: Torrent[];
 };
 
+// Live stream frames: "full"/"resync" carry the whole state, "patch" only
+// what changed since the previous sequence.
+type FullFrame = Snapshot & {
+    type: "full" | "resync";
+    seq: number;
+};
+
+type PatchFrame = {
+    type: "patch";
+    seq: number;
+    stats?: EngineStats;
+    added: Torrent[];
+    updated: Array<Partial<Torrent> & { id: number }>;
+    removed: number[];
+};
+
+type LiveFrame = FullFrame | PatchFrame;
+
 type TorrentAction = "pause" | "resume" | "remove";
 type ToastKind = "info" | "error" | "success";
 
@@ -51,6 +69,13 @@ const appState: { snapshot: Snapshot | null; ws: WebSocket | null; reconnectHand
     reconnectHandle: null
 };
 
+// State held from the WebSocket stream, keyed by torrent ID.
+const live: { seq: number; stats: EngineStats | null; torrents: Map<number, Torrent> } = {
+    seq: 0,
+    stats: null,
+    torrents: new Map<number, Torrent>()
+};
+
 function formatBytes(value: number): string
 {
     if(!value || value <= 0)
@@ -273,6 +298,160 @@ function applySnapshot(snapshot: Snapshot): void
     renderTorrents(snapshot.torrents);
 }
 
+// Binary frames (see build_ws_binary_frame in src/net/http_server.cpp) are
+// decoded into the same shapes as the JSON frames.
+const binaryProtocol = "rawbit.bin.v1";
+const binaryFrameMagic = 0x31574252;
+const binaryFrameKinds: Array<LiveFrame["type"]> = ["full", "resync", "patch"];
+const binaryStringAbsent = 0xffff;
+const utf8 = new TextDecoder();
+
+function readUint64(view: DataView, offset: number): number
+{
+    return view.getUint32(offset, true) + view.getUint32(offset + 4, true) * 4294967296;
+}
+
+function decodeBinaryFrame(buffer: ArrayBuffer): LiveFrame
+{
+    const view = new DataView(buffer);
+    if(view.getUint32(0, true) !== binaryFrameMagic)
+    {
+        throw new Error("Unknown binary frame");
+    }
+    const type = binaryFrameKinds[view.getUint8(4)];
+    const flags = view.getUint8(5);
+    const recordSize = view.getUint16(6, true);
+    const seq = readUint64(view, 8);
+    let offset = 16;
+
+    let stats: EngineStats | undefined;
+    if(flags & 1)
+    {
+        stats = {
+            port: view.getUint32(offset, true),
+            torrent_count: view.getUint32(offset + 4, true),
+            active: view.getUint32(offset + 8, true),
+            download_rate: readUint64(view, offset + 16),
+            upload_rate: readUint64(view, offset + 24)
+        };
+        offset += 32;
+    }
+
+    const rows = new Map<number, Partial<Torrent> & { id: number }>();
+    const recordCount = view.getUint32(offset, true);
+    offset += 4;
+    for(let i = 0; i < recordCount; i++, offset += recordSize)
+    {
+        const id = view.getUint32(offset, true);
+        const recordFlags = view.getUint32(offset + 4, true);
+        rows.set(id, {
+            id,
+            progress: view.getFloat32(offset + 8, true),
+            download_rate: view.getUint32(offset + 12, true),
+            upload_rate: view.getUint32(offset + 16, true),
+            size: readUint64(view, offset + 24),
+            downloaded: readUint64(view, offset + 32),
+            paused: (recordFlags & 1) !== 0,
+            complete: (recordFlags & 2) !== 0
+        });
+    }
+
+    const removed: number[] = [];
+    const removedCount = view.getUint32(offset, true);
+    offset += 4;
+    for(let i = 0; i < removedCount; i++, offset += 4)
+    {
+        removed.push(view.getUint32(offset, true));
+    }
+
+    if(flags & 2)
+    {
+        const readString = (): string | undefined => {
+            const length = view.getUint16(offset, true);
+            offset += 2;
+            if(length === binaryStringAbsent)
+            {
+                return undefined;
+            }
+            const text = utf8.decode(new Uint8Array(buffer, offset, length));
+            offset += length;
+            return text;
+        };
+        const stringCount = view.getUint32(offset, true);
+        offset += 4;
+        for(let i = 0; i < stringCount; i++)
+        {
+            const id = view.getUint32(offset, true);
+            offset += 4;
+            const row = rows.get(id) ?? { id };
+            const name = readString();
+            const magnet = readString();
+            if(name !== undefined)
+            {
+                row.name = name;
+            }
+            if(magnet !== undefined)
+            {
+                row.magnet = magnet;
+            }
+            rows.set(id, row);
+        }
+    }
+
+    if(type === "patch")
+    {
+        // Records do not say whether a row is new; applyLiveFrame upserts.
+        return { type, seq, stats, added: [], updated: Array.from(rows.values()), removed };
+    }
+    const torrents = Array.from(rows.values()).map((row) => ({ name: "", magnet: "", ...row }) as Torrent);
+    return { type, seq, stats: stats as EngineStats, torrents };
+}
+
+function publishLiveState(): void
+{
+    if(!live.stats)
+    {
+        return;
+    }
+    const torrents = Array.from(live.torrents.values()).sort((a, b) => a.id - b.id);
+    const snapshot: Snapshot = { stats: live.stats, torrents };
+    appState.snapshot = snapshot;
+    applySnapshot(snapshot);
+}
+
+function applyLiveFrame(socket: WebSocket, frame: LiveFrame): void
+{
+    if(frame.type === "full" || frame.type === "resync")
+    {
+        live.seq = frame.seq;
+        live.stats = frame.stats;
+        live.torrents.clear();
+        frame.torrents.forEach((torrent) => live.torrents.set(torrent.id, torrent));
+        publishLiveState();
+        return;
+    }
+
+    if(frame.seq !== live.seq + 1)
+    {
+        // Missed a patch; ask for the whole state instead of guessing.
+        socket.send(JSON.stringify({ type: "resync" }));
+        return;
+    }
+
+    live.seq = frame.seq;
+    if(frame.stats)
+    {
+        live.stats = frame.stats;
+    }
+    frame.removed.forEach((id) => live.torrents.delete(id));
+    frame.added.forEach((torrent) => live.torrents.set(torrent.id, torrent));
+    frame.updated.forEach((changes) => {
+        const current = live.torrents.get(changes.id);
+        live.torrents.set(changes.id, { ...current, ...changes } as Torrent);
+    });
+    publishLiveState();
+}
+
 function readSizeInBytes(): number
 {
     if(!sizeInput)
@@ -353,16 +532,19 @@ function connectWebSocket(): void
         appState.ws = null;
     }
 
-    const socket = new WebSocket(url);
+    const socket = new WebSocket(url, [binaryProtocol]);
+    socket.binaryType = "arraybuffer";
     appState.ws = socket;
+    live.seq = 0;
 
     socket.addEventListener("open", () => showToast("Live updates connected", "info"));
     socket.addEventListener("message", (event) => {
         try
         {
-            const snapshot: Snapshot = JSON.parse(event.data as string);
-            appState.snapshot = snapshot;
-            applySnapshot(snapshot);
+            const frame: LiveFrame = typeof event.data === "string"
+                ? JSON.parse(event.data)
+                : decodeBinaryFrame(event.data as ArrayBuffer);
+            applyLiveFrame(socket, frame);
         }
         catch(error)
         {